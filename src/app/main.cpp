@@ -1,16 +1,64 @@
 #include <QApplication>
+#include <QCommandLineParser>
+#include <QTimer>
+#include <QElapsedTimer>
 #include "ui/mainwindow.h"
 #include "core/StockAPI.h"
+#include "core/ReplayAPI.h"
+#include "core/Endpoints.h"
 #include <qdebug.h>
 #include "core/StockCodeMap.h"
 
 int main(int argc, char* argv[])
 {
+    // 시작 ~ 첫 화면 시간 측정 기준
+    QElapsedTimer launchTimer;
+    launchTimer.start();
+
     QApplication app(argc, argv);
 
+    // 실행 옵션
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption replayOption("replay", "기록된 시세(NDJSON 또는 틱 저널)로 실행", "path");
+    QCommandLineOption speedOption("speed", "재생 배속 (0 = 최대 속도)", "factor", "1");
+    QCommandLineOption exitOption("exit-when-done", "재생이 끝나면 종료");
+    QCommandLineOption finnhubOption("finnhub-url", "Finnhub 서버 주소", "url");
+    QCommandLineOption kisOption("kis-url", "한국투자증권 서버 주소", "url");
+    parser.addOptions({ replayOption, speedOption, exitOption, finnhubOption, kisOption });
+    parser.process(app);
+
+    // 서버 주소 (명령행 > 환경 변수 > 설정 > Config.h)
+    Endpoints::loadOverrides();
+    if (parser.isSet(finnhubOption))
+        Endpoints::setFinnhubBaseUrl(parser.value(finnhubOption));
+    if (parser.isSet(kisOption))
+        Endpoints::setKisBaseUrl(parser.value(kisOption));
+
     StockCodeMap::loadFromMstFiles();
 
-    MainWindow w;
+    ReplayAPI* replay = nullptr;
+    if (parser.isSet(replayOption))
+    {
+        // 부모 없이 만들어 MainWindow에 넘김 (시세 I/O 스레드로 옮겨짐)
+        replay = new ReplayAPI(parser.value(replayOption), parser.value(speedOption).toDouble());
+        if (!replay->load())
+        {
+            qCritical() << "재생 파일을 읽을 수 없습니다:" << parser.value(replayOption);
+            delete replay;
+            return 1;
+        }
+        if (parser.isSet(exitOption))
+            QObject::connect(replay, &ReplayAPI::finished, &app, &QApplication::quit);
+    }
+
+    MainWindow w(nullptr, replay);
+    w.setLaunchTimer(launchTimer);
     w.show();
+
+    // 첫 화면이 뜬 다음 재생 시작
+    if (replay)
+        QTimer::singleShot(0, replay, &ReplayAPI::start);
+
     return app.exec();
-}
\ No newline at end of file
+}
@@ -0,0 +1,105 @@
+#include "BenchRunner.h"
+#include "BenchData.h"
+#include "core/AlertEngine.h"
+#include <QJsonObject>
+#include <random>
+
+namespace
+{
+	constexpr int SymbolCount = 2000;
+	constexpr int RuleCount = 100000;	// 종목당 50개
+	constexpr int TickCount = 100000;	// 미리 만들어둔 랜덤워크 틱
+
+	QString symbolName(int i)
+	{
+		return QString("S%1").arg(i, 4, 10, QChar('0'));
+	}
+}
+
+void registerAlertEngineBenchmarks(BenchRunner& runner)
+{
+	// 규칙/틱 준비가 무거우므로 걸러진 경우 건너뜀
+	if (!runner.isEnabled("AlertEngine/addRule/100k") && !runner.isEnabled("AlertEngine/onTick/100k_rules")
+		&& !runner.isEnabled("AlertEngine/load_at_1k_tps"))
+		return;
+
+	std::mt19937 rng(42);
+
+	// 종목별 기준가 주변 +-10%에 규칙을 고르게 뿌림
+	std::vector<double> basePrice(SymbolCount);
+	std::uniform_real_distribution<double> priceDist(10.0, 500.0);
+	for (double& price : basePrice)
+		price = priceDist(rng);
+
+	auto buildRules = [&basePrice](AlertEngine& engine)
+	{
+		std::mt19937 ruleRng(7);
+		std::uniform_real_distribution<double> offset(-0.1, 0.1);
+		std::uniform_int_distribution<int> kindDist(0, 5);
+		for (int i = 0; i < RuleCount; ++i)
+		{
+			const int s = i % SymbolCount;
+			AlertRule rule;
+			rule.symbol = symbolName(s);
+			rule.kind = static_cast<AlertKind>(kindDist(ruleRng));
+			const bool percent = rule.kind == AlertKind::PercentAbove || rule.kind == AlertKind::PercentBelow;
+			rule.level = percent ? offset(ruleRng) * 100.0 : basePrice[s] * (1.0 + offset(ruleRng));
+			rule.hysteresis = percent ? 0.2 : rule.level * 0.002;
+			rule.cooldownMs = 60000;
+			engine.addRule(rule);
+		}
+	};
+
+	runner.run("AlertEngine/addRule/100k", [&buildRules]()
+	{
+		AlertEngine engine;
+		buildRules(engine);
+		doNotOptimize(engine.ruleCount());
+	}, RuleCount);
+
+	AlertEngine engine;
+	buildRules(engine);
+	quint64 fired = 0;
+	QObject::connect(&engine, &AlertEngine::alertTriggered, [&fired](const AlertEvent&) { ++fired; });
+
+	// 틱 간 변동 +-0.3% 랜덤워크, 1ms 간격 (1000틱/초)
+	std::vector<StockData> ticks(TickCount);
+	std::vector<double> price = basePrice;
+	std::normal_distribution<double> step(0.0, 0.003);
+	std::uniform_int_distribution<int> symbolDist(0, SymbolCount - 1);
+	for (int i = 0; i < TickCount; ++i)
+	{
+		const int s = symbolDist(rng);
+		price[s] *= 1.0 + step(rng);
+
+		StockData& tick = ticks[i];
+		tick.symbol = symbolName(s);
+		tick.currentPrice = price[s];
+		tick.prevClose = basePrice[s];
+		tick.timestamp = 1700000000000LL + i;
+	}
+
+	int next = 0;
+	runner.run("AlertEngine/onTick/100k_rules", [&]()
+	{
+		engine.onTick(ticks[next]);
+		next = (next + 1) % TickCount;
+	});
+
+	// 1000틱/초일 때 한 코어에서 차지하는 비율 (run 결과 대신 한 바퀴 직접 측정)
+	QElapsedTimer timer;
+	const quint64 firedBefore = fired;
+	timer.start();
+	for (const StockData& tick : ticks)
+		engine.onTick(tick);
+	const double nsPerTick = double(timer.nsecsElapsed()) / TickCount;
+
+	runner.addMetric("AlertEngine/load_at_1k_tps", QJsonObject{
+		{ "rules", RuleCount },
+		{ "symbols", SymbolCount },
+		{ "ns_per_tick", nsPerTick },
+		{ "cpu_percent_at_1000_tps", nsPerTick * 1000.0 / 1e9 * 100.0 },
+		{ "alerts_per_1000_ticks", double(fired - firedBefore) * 1000.0 / TickCount },
+		{ "suppressed_total", static_cast<qint64>(engine.suppressedCount()) }
+	});
+}
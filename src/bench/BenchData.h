@@ -0,0 +1,35 @@
+#pragma once
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+// 캡처해둔 응답 본문 (src/bench/data)
+inline QByteArray readBenchData(const QString& name)
+{
+	QFile file(QString(STOCKFLOW_BENCH_DATA_DIR) + "/" + name);
+	if (!file.open(QIODevice::ReadOnly)) return QByteArray();
+	return file.readAll();
+}
+
+// 저장소 루트의 MST 파일
+inline QString benchMstPath(const QString& name)
+{
+	return QString(STOCKFLOW_MST_DIR) + "/" + name;
+}
+
+// KOSPI/KOSDAQ MST + 가짜 미국 종목으로 실제 규모(약 35k)의 종목 사전 구성
+void loadBenchUniverse(int usCount = 31000);
+
+// 벤치마크 등록 함수 (파일별)
+class BenchRunner;
+void registerStockCodeMapBenchmarks(BenchRunner& runner);
+void registerQuoteParseBenchmarks(BenchRunner& runner);
+void registerOrderBookBenchmarks(BenchRunner& runner);
+void registerTickPathBenchmarks(BenchRunner& runner);
+void registerTableModelBenchmarks(BenchRunner& runner);
+void registerAlertEngineBenchmarks(BenchRunner& runner);
+void registerQuoteBoardBenchmarks(BenchRunner& runner);
+void registerScreenerBenchmarks(BenchRunner& runner);
+void registerResponsivenessBenchmarks(BenchRunner& runner);
+void registerMstTableBenchmarks(BenchRunner& runner);
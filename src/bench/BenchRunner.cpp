@@ -0,0 +1,79 @@
+#include "BenchRunner.h"
+#include <QDateTime>
+#include <QSysInfo>
+#include <QThread>
+#include <QTextStream>
+#include <QJsonDocument>
+
+BenchRunner::BenchRunner(const QString& filter, int minTimeMs)
+	: m_filter(filter), m_minTimeMs(minTimeMs)
+{
+}
+
+bool BenchRunner::isEnabled(const QString& name) const
+{
+	return m_filter.pattern().isEmpty() || m_filter.match(name).hasMatch();
+}
+
+void BenchRunner::addResult(const QString& name, qint64 iterations, std::vector<double>& samples, qint64 itemsPerCall)
+{
+	std::sort(samples.begin(), samples.end());
+
+	double sum = 0.0;
+	for (double s : samples) sum += s;
+	const double mean = sum / samples.size();
+	const double median = samples[samples.size() / 2];
+	const double p90 = samples[qMin(samples.size() - 1, samples.size() * 9 / 10)];
+
+	QJsonObject result{
+		{ "name", name },
+		{ "iterations", iterations },
+		{ "mean_ns", mean },
+		{ "median_ns", median },
+		{ "p90_ns", p90 },
+		{ "min_ns", samples.front() },
+		{ "max_ns", samples.back() },
+		{ "items_per_call", itemsPerCall },
+		{ "items_per_second", median > 0 ? itemsPerCall * 1e9 / median : 0.0 }
+	};
+	m_results.append(result);
+
+	// 진행 상황은 stderr로 (stdout은 JSON 전용)
+	QTextStream(stderr) << QString("%1  %2 ns/op  p90 %3  (%4 iters)\n")
+		.arg(name, -60).arg(median, 12, 'f', 1).arg(p90, 12, 'f', 1).arg(iterations);
+}
+
+void BenchRunner::addMetric(const QString& name, const QJsonObject& values)
+{
+	if (!isEnabled(name)) return;
+
+	QJsonObject result = values;
+	result.insert("name", name);
+	m_results.append(result);
+
+	QTextStream(stderr) << name << "  " << QJsonDocument(values).toJson(QJsonDocument::Compact) << "\n";
+}
+
+void BenchRunner::addFailure(const QString& name, const QString& reason)
+{
+	m_failures.append(QJsonObject{ { "name", name }, { "reason", reason } });
+	QTextStream(stderr) << "FAILED " << name << ": " << reason << "\n";
+}
+
+QJsonObject BenchRunner::toJson() const
+{
+	QJsonObject context{
+		{ "date", QDateTime::currentDateTimeUtc().toString(Qt::ISODate) },
+		{ "qt_version", QT_VERSION_STR },
+		{ "os", QSysInfo::prettyProductName() },
+		{ "cpu_arch", QSysInfo::currentCpuArchitecture() },
+		{ "num_cpus", QThread::idealThreadCount() },
+#ifdef NDEBUG
+		{ "build_type", "release" },
+#else
+		{ "build_type", "debug" },
+#endif
+	};
+
+	return QJsonObject{ { "context", context }, { "benchmarks", m_results }, { "failures", m_failures } };
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <QString>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QRegularExpression>
+#include <QElapsedTimer>
+#include <algorithm>
+#include <vector>
+
+// 컴파일러가 결과를 안 쓴다고 계산을 지워버리지 않도록
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "g"(&value) : "memory");
+#else
+	static volatile const void* sink;
+	sink = &value;
+#endif
+}
+
+// 간단한 마이크로벤치마크 실행기
+// 결과를 JSON으로 모아서 버전 간 비교에 씀
+class BenchRunner
+{
+public:
+	explicit BenchRunner(const QString& filter = QString(), int minTimeMs = 200);
+
+	bool isEnabled(const QString& name) const;
+
+	// fn() 한 번 = 1회. itemsPerCall: 1회에 처리하는 항목 수 (처리량 계산용)
+	template <typename Fn>
+	void run(const QString& name, Fn&& fn, qint64 itemsPerCall = 1)
+	{
+		if (!isEnabled(name)) return;
+
+		// 워밍업 겸 1회 시간 측정 -> 샘플 하나가 약 1ms 가 되도록 묶음 크기 결정
+		QElapsedTimer timer;
+		timer.start();
+		fn();
+		const qint64 once = qMax<qint64>(timer.nsecsElapsed(), 1);
+		const qint64 batch = qMax<qint64>(1, 1000000 / once);
+
+		std::vector<double> samples;	// 1회당 ns
+		qint64 iterations = 0;
+		QElapsedTimer total;
+		total.start();
+		while (total.elapsed() < m_minTimeMs || samples.size() < 5)
+		{
+			timer.restart();
+			for (qint64 i = 0; i < batch; ++i)
+				fn();
+			samples.push_back(static_cast<double>(timer.nsecsElapsed()) / batch);
+			iterations += batch;
+		}
+
+		addResult(name, iterations, samples, itemsPerCall);
+	}
+
+	// 시간 외 측정값 (메모리 등)
+	void addMetric(const QString& name, const QJsonObject& values);
+
+	// 벤치마크가 지켜야 할 조건을 어김 (결과 JSON에 남고 실행 파일이 실패로 끝남)
+	void addFailure(const QString& name, const QString& reason);
+	bool hasFailures() const { return !m_failures.isEmpty(); }
+
+	QJsonObject toJson() const;
+	int resultCount() const { return static_cast<int>(m_results.size()); }
+
+private:
+	QRegularExpression m_filter;
+	int m_minTimeMs;
+	QJsonArray m_results;
+	QJsonArray m_failures;
+
+	void addResult(const QString& name, qint64 iterations, std::vector<double>& samples, qint64 itemsPerCall);
+};
@@ -0,0 +1,86 @@
+#include "BenchRunner.h"
+#include "BenchData.h"
+#include "core/MstTable.h"
+#include <QJsonObject>
+
+namespace
+{
+	void loadBoth(MstTable& table)
+	{
+		table.load(benchMstPath("kospi_code.mst"), Market::Kospi);
+		table.load(benchMstPath("kosdaq_code.mst"), Market::Kosdaq);
+	}
+
+	void decodeAll(const MstTable& table)
+	{
+		for (int f = 0; f < MstSchema::FieldCount; ++f)
+		{
+			const MstField field = static_cast<MstField>(f);
+			const MstFieldSpec* spec = MstSchema::find(Market::Kospi, field);
+			if (!spec) spec = MstSchema::find(Market::Kosdaq, field);
+			if (!spec) continue;
+			if (spec->type == MstFieldType::Integer) doNotOptimize(table.integers(field));
+			else if (spec->type == MstFieldType::Decimal) doNotOptimize(table.decimals(field));
+			else if (spec->type == MstFieldType::Flag) doNotOptimize(table.flags(field));
+		}
+	}
+}
+
+void registerMstTableBenchmarks(BenchRunner& runner)
+{
+	runner.run("MstTable/load", []()
+	{
+		MstTable table;
+		loadBoth(table);
+		doNotOptimize(table.count());
+	});
+
+	MstTable table;
+	loadBoth(table);
+	const int rows = table.count();
+
+	runner.run("MstTable/decode/one_column", [&table]()
+	{
+		MstTable copy = table;		// 캐시가 빈 상태에서 한 열
+		doNotOptimize(copy.integers(MstField::ListedShares));
+	}, rows);
+
+	runner.run("MstTable/decode/all_columns", [&table]()
+	{
+		MstTable copy = table;
+		decodeAll(copy);
+	}, rows);
+
+	int next = 0;
+	runner.run("MstTable/indexOf", [&table, &next, rows]()
+	{
+		doNotOptimize(table.indexOf(table.code(next)));
+		next = (next + 1) % rows;
+	});
+
+	if (!runner.isEnabled("MstTable/memory")) return;
+
+	const qsizetype lazyBytes = table.memoryUsage();
+	decodeAll(table);
+	const qsizetype decodedBytes = table.memoryUsage();
+
+	// 비교용: 모든 필드를 QHash<QString, QString>처럼 QString으로 들고 있을 때 추정치
+	// (UTF-16 본문 + QArrayData 헤더 24B + 해시 노드의 키/값 QString 2개)
+	qint64 stringBytes = 0;
+	for (int row = 0; row < rows; ++row)
+	{
+		const Market market = table.market(row);
+		const MstFieldSpec* specs = market == Market::Kospi ? MstSchema::Kospi.data() : MstSchema::Kosdaq.data();
+		const size_t fieldCount = market == Market::Kospi ? MstSchema::Kospi.size() : MstSchema::Kosdaq.size();
+		for (size_t i = 0; i < fieldCount; ++i)
+			stringBytes += (specs[i].width + 1) * 2 + 24 + 2 * qint64(sizeof(QString));
+		stringBytes += (table.name(row).size() + 1) * 2 + 24 + 2 * qint64(sizeof(QString));
+	}
+
+	runner.addMetric("MstTable/memory", QJsonObject{
+		{ "rows", rows },
+		{ "bytes_loaded", qint64(lazyBytes) },
+		{ "bytes_all_columns_decoded", qint64(decodedBytes) },
+		{ "bytes_qstring_per_field_estimate", stringBytes }
+	});
+}
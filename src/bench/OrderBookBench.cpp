@@ -0,0 +1,150 @@
+#include "BenchRunner.h"
+#include "BenchData.h"
+#include "core/KisAPI.h"
+#include "core/QuoteParser.h"
+#include "ui/DepthLadderWidget.h"
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QImage>
+#include <memory>
+
+namespace
+{
+	// 비교 기준: 문서 전체를 QJsonDocument로 만들고 키 문자열로 찾음
+	bool parseOrderBookDom(const QByteArray& json, OrderBook& book)
+	{
+		QJsonObject output = QJsonDocument::fromJson(json).object()["output1"].toObject();
+		if (output.isEmpty()) return false;
+
+		for (int level = 0; level < OrderBook::Depth; ++level)
+		{
+			const QString n = QString::number(level + 1);
+			book.asks[level].price = output["askp" + n].toString().toDouble();
+			book.bids[level].price = output["bidp" + n].toString().toDouble();
+			book.asks[level].quantity = output["askp_rsqn" + n].toString().toLongLong();
+			book.bids[level].quantity = output["bidp_rsqn" + n].toString().toLongLong();
+		}
+		book.totalAskQuantity = output["total_askp_rsqn"].toString().toLongLong();
+		book.totalBidQuantity = output["total_bidp_rsqn"].toString().toLongLong();
+		return true;
+	}
+
+	bool sameLevels(const OrderBook& a, const OrderBook& b)
+	{
+		return a.asks == b.asks && a.bids == b.bids
+			&& a.totalAskQuantity == b.totalAskQuantity && a.totalBidQuantity == b.totalBidQuantity;
+	}
+
+	// 실시간 프레임 데이터 부분 (H0STASP0, 59개 값 '^' 구분)
+	QByteArray makeFrame(const OrderBook& book)
+	{
+		QByteArrayList fields;
+		fields << "005930" << "093730" << "0";
+		for (const OrderBookLevel& level : book.asks) fields << QByteArray::number(level.price, 'f', 0);
+		for (const OrderBookLevel& level : book.bids) fields << QByteArray::number(level.price, 'f', 0);
+		for (const OrderBookLevel& level : book.asks) fields << QByteArray::number(level.quantity);
+		for (const OrderBookLevel& level : book.bids) fields << QByteArray::number(level.quantity);
+		fields << QByteArray::number(book.totalAskQuantity) << QByteArray::number(book.totalBidQuantity);
+		while (fields.size() < 59)
+			fields << "0";
+		return fields.join('^');
+	}
+}
+
+void registerOrderBookBenchmarks(BenchRunner& runner)
+{
+	const QByteArray rest = readBenchData("kis_asking_price.json");
+
+	OrderBook base;
+	OrderBook dom;
+	KisAPI::parseOrderBook(rest, base);
+	parseOrderBookDom(rest, dom);
+	if (!sameLevels(base, dom))
+		runner.addFailure("OrderBook/parse/Schema", "KIS 호가 스키마 파서 결과가 QJsonDocument 경로와 다름");
+
+	const QByteArray frame = makeFrame(base);
+	OrderBook fromFrame;
+	if (!QuoteParser::parseKisOrderBookFrame(frame, 1, fromFrame) || !sameLevels(base, fromFrame))
+		runner.addFailure("OrderBook/parse/Frame", "KIS 실시간 호가 프레임 파싱 결과가 조회 응답과 다름");
+
+	runner.run("OrderBook/parse/QJsonDocument", [&rest]()
+	{
+		OrderBook book;
+		parseOrderBookDom(rest, book);
+		doNotOptimize(book);
+	});
+
+	runner.run("OrderBook/parse/Schema", [&rest]()
+	{
+		OrderBook book;
+		QuoteParser::parseKisOrderBook(rest, book);
+		doNotOptimize(book);
+	});
+
+	runner.run("OrderBook/parse/Frame", [&frame]()
+	{
+		OrderBook book;
+		QuoteParser::parseKisOrderBookFrame(frame, 1, book);
+		doNotOptimize(book);
+	});
+
+	// 보통의 호가 변경: 한두 단계 잔량만 바뀜
+	OrderBook book = base;
+	OrderBook update = base;
+	int tick = 0;
+	runner.run("OrderBook/apply/one_level", [&]()
+	{
+		update.bids[tick % OrderBook::Depth].quantity += (tick & 1) ? 100 : -100;
+		doNotOptimize(book.apply(update));
+		++tick;
+	});
+
+	// 호가창 8개가 한 프레임에 동시에 움직일 때: 바뀐 행만 그리기 vs 전체 그리기
+	const int books = 8;
+	std::vector<std::unique_ptr<DepthLadderWidget>> ladders;
+	std::vector<OrderBook> updates(books, base);
+	for (int i = 0; i < books; ++i)
+	{
+		ladders.push_back(std::make_unique<DepthLadderWidget>(QString("%1").arg(i, 6, 10, QChar('0')), QString()));
+		ladders.back()->resize(320, 520);
+		ladders.back()->applyOrderBook(base);
+	}
+	QImage target(320, 520, QImage::Format_ARGB32_Premultiplied);
+
+	tick = 0;
+	runner.run(QString("OrderBook/ladder/%1_books/changed_rows").arg(books), [&]()
+	{
+		for (int i = 0; i < books; ++i)
+		{
+			DepthLadderWidget& ladder = *ladders[i];
+			OrderBook& next = updates[i];
+			const int level = (tick + i) % OrderBook::Depth;
+			next.asks[level].quantity += (tick & 1) ? 100 : -100;
+			next.totalAskQuantity += (tick & 1) ? 100 : -100;
+
+			ladder.applyOrderBook(next);
+
+			const QRect row = ladder.rowRect(OrderBook::askRow(level));
+			ladder.render(&target, row.topLeft(), QRegion(row), QWidget::RenderFlags());
+			const QRect totals = ladder.totalsRect();
+			ladder.render(&target, totals.topLeft(), QRegion(totals), QWidget::RenderFlags());
+		}
+		++tick;
+	}, books);
+
+	runner.run(QString("OrderBook/ladder/%1_books/full").arg(books), [&]()
+	{
+		for (int i = 0; i < books; ++i)
+		{
+			DepthLadderWidget& ladder = *ladders[i];
+			OrderBook& next = updates[i];
+			const int level = (tick + i) % OrderBook::Depth;
+			next.asks[level].quantity += (tick & 1) ? 100 : -100;
+			next.totalAskQuantity += (tick & 1) ? 100 : -100;
+
+			ladder.applyOrderBook(next);
+			ladder.render(&target, QPoint(), QRegion(ladder.rect()), QWidget::RenderFlags());
+		}
+		++tick;
+	}, books);
+}
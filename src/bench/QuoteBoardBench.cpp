@@ -0,0 +1,147 @@
+#include "BenchRunner.h"
+#include "BenchData.h"
+#include "quoteboard/QuoteBoardWriter.h"
+#include "quoteboard/QuoteBoardReader.h"
+#include <QCoreApplication>
+#include <QJsonObject>
+#include <QThread>
+#include <QVector>
+#include <atomic>
+#include <random>
+
+namespace
+{
+	constexpr int SymbolCount = 1000;
+	constexpr int ContendedMs = 500;
+
+	QString symbolName(int i)
+	{
+		return QString("Q%1").arg(i, 4, 10, QChar('0'));
+	}
+
+	// 모든 필드를 같은 값으로 채움 -> 읽은 쪽에서 필드가 섞였는지(찢어진 읽기) 바로 확인 가능
+	QuoteBoardQuote stampedQuote(qint64 n)
+	{
+		QuoteBoardQuote quote;
+		quote.timestamp = n;
+		quote.price = double(n);
+		quote.open = double(n);
+		quote.high = double(n);
+		quote.low = double(n);
+		quote.prevClose = double(n);
+		quote.volume = n;
+		return quote;
+	}
+
+	bool isTorn(const QuoteBoardQuote& quote)
+	{
+		const double n = double(quote.timestamp);
+		return quote.price != n || quote.open != n || quote.high != n || quote.low != n
+			|| quote.prevClose != n || double(quote.volume) != n;
+	}
+}
+
+void registerQuoteBoardBenchmarks(BenchRunner& runner)
+{
+	if (!runner.isEnabled("QuoteBoard/publish") && !runner.isEnabled("QuoteBoard/read/by_slot")
+		&& !runner.isEnabled("QuoteBoard/read/by_symbol") && !runner.isEnabled("QuoteBoard/contended"))
+		return;
+
+	// 실행 중인 StockFlow와 겹치지 않는 키
+	const QString key = QString("StockFlowBench-%1").arg(QCoreApplication::applicationPid());
+	QuoteBoardWriter writer(key, SymbolCount);
+	if (!writer.open()) return;
+
+	QStringList symbols;
+	for (int i = 0; i < SymbolCount; ++i)
+	{
+		symbols << symbolName(i);
+		writer.publish(symbols.last(), stampedQuote(1));
+	}
+
+	QuoteBoardReader reader(key);
+	if (!reader.open()) return;
+
+	// 슬롯 번호는 읽는 쪽이 찾은 것만 씀 (찾을 때의 generation에 묶임)
+	QVector<int> slotOf;
+	for (const QString& symbol : symbols)
+		slotOf << reader.indexOf(symbol);
+
+	qint64 n = 1;
+	int next = 0;
+	runner.run("QuoteBoard/publish", [&]()
+	{
+		writer.publish(symbols[next], stampedQuote(++n));
+		next = (next + 1) % SymbolCount;
+	});
+
+	QuoteBoardQuote quote;
+	next = 0;
+	runner.run("QuoteBoard/read/by_slot", [&]()
+	{
+		reader.read(slotOf[next], quote);
+		doNotOptimize(quote);
+		next = (next + 1) % SymbolCount;
+	});
+
+	next = 0;
+	runner.run("QuoteBoard/read/by_symbol", [&]()
+	{
+		reader.read(symbols[next], quote);
+		doNotOptimize(quote);
+		next = (next + 1) % SymbolCount;
+	});
+
+	if (!runner.isEnabled("QuoteBoard/contended")) return;
+
+	// 쓰는 스레드가 쉬지 않고 갱신하는 동안 다른 스레드가 무작위 슬롯을 읽음
+	std::atomic<bool> stop{ false };
+	std::atomic<qint64> writes{ 0 };
+	QThread* writerThread = QThread::create([&]()
+	{
+		qint64 count = 0;
+		int slot = 0;
+		while (!stop.load(std::memory_order_relaxed))
+		{
+			writer.publish(symbols[slot], stampedQuote(++n));
+			slot = (slot + 1) % SymbolCount;
+			++count;
+		}
+		writes.store(count);
+	});
+
+	std::mt19937 rng(3);
+	std::uniform_int_distribution<int> slotDist(0, SymbolCount - 1);
+	const quint64 retriesBefore = reader.retryCount();
+	qint64 reads = 0;
+	qint64 torn = 0;
+	qint64 failed = 0;
+
+	writerThread->start();
+	QElapsedTimer timer;
+	timer.start();
+	while (timer.elapsed() < ContendedMs)
+	{
+		for (int i = 0; i < 1000; ++i)
+		{
+			if (!reader.read(slotOf[slotDist(rng)], quote))
+				++failed;
+			else if (isTorn(quote))
+				++torn;
+			++reads;
+		}
+	}
+	const double seconds = timer.nsecsElapsed() / 1e9;
+	stop.store(true);
+	writerThread->wait();
+	delete writerThread;
+
+	runner.addMetric("QuoteBoard/contended", QJsonObject{
+		{ "symbols", SymbolCount },
+		{ "writes_per_sec", writes.load() / seconds },
+		{ "reads_per_sec", reads / seconds },
+		{ "retries_per_1k_reads", double(reader.retryCount() - retriesBefore) * 1000.0 / qMax<qint64>(reads, 1) },
+		{ "failed_reads", failed },
+		{ "torn_reads", torn }
+	});
+}
@@ -0,0 +1,96 @@
+#include "BenchRunner.h"
+#include "BenchData.h"
+#include "core/FinnhubAPI.h"
+#include "core/KisAPI.h"
+#include "core/QuoteParser.h"
+#include <QJsonDocument>
+#include <QJsonObject>
+
+namespace
+{
+	// 예전 경로: 문서 전체를 QJsonDocument로 만들고 키 문자열로 찾음 (비교 기준)
+	bool parseFinnhubDom(const QByteArray& json, StockData& data)
+	{
+		QJsonObject jsonObj = QJsonDocument::fromJson(json).object();
+		if (!jsonObj.contains("c"))
+			return false;
+
+		data.currentPrice = jsonObj["c"].toDouble();
+		data.highPrice = jsonObj["h"].toDouble();
+		data.lowPrice = jsonObj["l"].toDouble();
+		data.openPrice = jsonObj["o"].toDouble();
+		data.prevClose = jsonObj["pc"].toDouble();
+		return true;
+	}
+
+	bool parseKisDom(const QByteArray& json, StockData& data)
+	{
+		QJsonObject output = QJsonDocument::fromJson(json).object()["output"].toObject();
+		if (output.isEmpty()) return false;
+
+		data.currentPrice = output["stck_prpr"].toString().toDouble();
+		data.highPrice = output["stck_hgpr"].toString().toDouble();
+		data.lowPrice = output["stck_lwpr"].toString().toDouble();
+		data.openPrice = output["stck_oprc"].toString().toDouble();
+		data.prevClose = data.currentPrice - output["prdy_vrss"].toString().toDouble();
+		data.volume = output["acml_vol"].toString().toLongLong();
+		return true;
+	}
+
+	// 두 경로 결과가 다르면 파서가 틀린 것이고 벤치 숫자도 의미 없으므로 먼저 확인 (다르면 실패)
+	void checkSame(BenchRunner& runner, const QString& provider, const StockData& dom, const StockData& schema)
+	{
+		if (dom.currentPrice != schema.currentPrice || dom.highPrice != schema.highPrice
+			|| dom.lowPrice != schema.lowPrice || dom.openPrice != schema.openPrice
+			|| dom.prevClose != schema.prevClose || dom.volume != schema.volume)
+		{
+			runner.addFailure("QuoteParse/" + provider, "스키마 파서 결과가 QJsonDocument 경로와 다름");
+		}
+	}
+}
+
+void registerQuoteParseBenchmarks(BenchRunner& runner)
+{
+	const QByteArray finnhub = readBenchData("finnhub_quote.json");
+	const QByteArray kis = readBenchData("kis_inquire_price.json");
+
+	StockData dom;
+	StockData schema;
+	parseFinnhubDom(finnhub, dom);
+	FinnhubAPI::parseQuote(finnhub, schema);
+	checkSame(runner, "Finnhub", dom, schema);
+
+	dom = StockData();
+	schema = StockData();
+	parseKisDom(kis, dom);
+	KisAPI::parseQuote(kis, schema);
+	checkSame(runner, "KIS", dom, schema);
+
+	runner.run("QuoteParse/Finnhub/QJsonDocument", [&finnhub]()
+	{
+		StockData data;
+		parseFinnhubDom(finnhub, data);
+		doNotOptimize(data);
+	});
+
+	runner.run("QuoteParse/Finnhub/Schema", [&finnhub]()
+	{
+		StockData data;
+		QuoteParser::parse(finnhub, QuoteSchema::Finnhub, data);
+		doNotOptimize(data);
+	});
+
+	runner.run("QuoteParse/KIS/QJsonDocument", [&kis]()
+	{
+		StockData data;
+		parseKisDom(kis, data);
+		doNotOptimize(data);
+	});
+
+	runner.run("QuoteParse/KIS/Schema", [&kis]()
+	{
+		StockData data;
+		QuoteParser::parse(kis, QuoteSchema::Kis, data);
+		doNotOptimize(data);
+	});
+}
@@ -0,0 +1,154 @@
+#include "BenchRunner.h"
+#include "BenchData.h"
+#include "MockServer.h"
+#include "core/Endpoints.h"
+#include "core/ProviderService.h"
+#include "core/QuoteMailbox.h"
+#include "ui/StockTableModel.h"
+#include <QCoreApplication>
+#include <QEventLoop>
+#include <QJsonObject>
+#include <QKeyEvent>
+#include <QLineEdit>
+#include <QMutex>
+#include <QThread>
+#include <QTimer>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+
+namespace
+{
+	constexpr int SymbolCount = 1000;
+	constexpr int KeyIntervalMs = 5;		// 빠르게 타이핑하는 사람 (200타/초)
+	constexpr int TimeoutMs = 30000;
+
+	// values는 정렬된 상태
+	double percentile(const std::vector<qint64>& values, double p)
+	{
+		if (values.empty()) return 0.0;
+		const size_t index = std::min(values.size() - 1, static_cast<size_t>(p / 100.0 * values.size()));
+		return values[index] / 1000.0;
+	}
+
+	// 1000종목 갱신을 한 번 보내고, 끝날 때까지 다른 스레드에서 검색창에 키 입력을 넣음
+	// 입력 지연 = 키 이벤트를 넣은 시각 ~ 검색창이 textEdited를 낸 시각 (GUI 이벤트 루프가 막힌 만큼 늘어남)
+	QJsonObject measure(bool threaded, const QStringList& symbols)
+	{
+		ProviderService provider(nullptr, threaded);
+		QuoteMailbox mailbox;
+		provider.setMailbox(&mailbox);
+
+		// 실제 화면처럼 테이블 모델까지 반영
+		StockTableModel model;
+		QObject::connect(&mailbox, &QuoteMailbox::dataReceived, &model, &StockTableModel::updateOrInsert);
+
+		QLineEdit edit;
+		edit.show();
+
+		QElapsedTimer clock;
+		QMutex mutex;
+		std::deque<qint64> pending;		// 아직 처리 안 된 키 입력 시각
+		std::vector<qint64> latencies;	// ns
+		QObject::connect(&edit, &QLineEdit::textEdited, [&]()
+		{
+			const qint64 now = clock.nsecsElapsed();
+			QMutexLocker locker(&mutex);
+			if (pending.empty()) return;
+			latencies.push_back(now - pending.front());
+			pending.pop_front();
+		});
+
+		// 갱신이 끝나면 (모든 종목 수신) 루프 종료
+		QEventLoop loop;
+		int received = 0;
+		QObject::connect(&provider, &ProviderService::quotesReceived, [&](const QVector<StockData>& quotes)
+		{
+			received += quotes.size();
+			if (received >= symbols.size())
+				loop.quit();
+		});
+		QTimer::singleShot(TimeoutMs, &loop, &QEventLoop::quit);
+
+		// 타이핑은 GUI 루프와 무관한 스레드에서 일정 간격으로
+		std::atomic<bool> stop{ false };
+		QThread* typist = QThread::create([&]()
+		{
+			while (!stop.load())
+			{
+				{
+					QMutexLocker locker(&mutex);
+					pending.push_back(clock.nsecsElapsed());
+				}
+				QCoreApplication::postEvent(&edit, new QKeyEvent(QEvent::KeyPress, Qt::Key_A, Qt::NoModifier, "a"));
+				QThread::msleep(KeyIntervalMs);
+			}
+		});
+
+		clock.start();
+		typist->start();
+		provider.fetchStocks(symbols);
+		loop.exec();
+		const double refreshMs = clock.nsecsElapsed() / 1e6;
+
+		stop.store(true);
+		typist->wait();
+		delete typist;
+		QCoreApplication::sendPostedEvents(&edit);
+		provider.stop();
+
+		std::sort(latencies.begin(), latencies.end());
+		const qint64 keys = static_cast<qint64>(latencies.size());
+		return QJsonObject{
+			{ "symbols", symbols.size() },
+			{ "quotes_received", received },
+			{ "refresh_ms", refreshMs },
+			{ "keystrokes", keys },
+			{ "input_latency_p50_us", percentile(latencies, 50) },
+			{ "input_latency_p99_us", percentile(latencies, 99) },
+			{ "input_latency_max_us", percentile(latencies, 100) },
+			{ "conflated", static_cast<qint64>(mailbox.stats().conflated) }
+		};
+	}
+}
+
+void registerResponsivenessBenchmarks(BenchRunner& runner)
+{
+	const bool guiThread = runner.isEnabled("Responsiveness/search_input/gui_thread");
+	const bool ioThread = runner.isEnabled("Responsiveness/search_input/io_thread");
+	if (!guiThread && !ioThread) return;
+
+	// 대역 서버는 따로 스레드에서 (서버 처리가 재려는 GUI 루프를 막지 않게)
+	MockServerConfig config;
+	config.port = 0;
+	config.seed = 1;
+	MockServer* server = new MockServer(config);
+	QThread serverThread;
+	server->moveToThread(&serverThread);
+	QObject::connect(&serverThread, &QThread::finished, server, &QObject::deleteLater);
+	serverThread.start();
+
+	bool listening = false;
+	QMetaObject::invokeMethod(server, [&]() { listening = server->listen(); }, Qt::BlockingQueuedConnection);
+	if (!listening)
+	{
+		serverThread.quit();
+		serverThread.wait();
+		return;
+	}
+	Endpoints::setFinnhubBaseUrl(server->baseUrl());
+
+	// 인증이 필요 없는 Finnhub 경로로만 (KIS 토큰 설정을 건드리지 않게)
+	QStringList symbols;
+	for (int i = 0; i < SymbolCount; ++i)
+		symbols << QString("R%1").arg(i, 4, 10, QChar('0'));
+
+	// 예전 구조 (제공자가 GUI 스레드) / I/O 스레드
+	if (guiThread)
+		runner.addMetric("Responsiveness/search_input/gui_thread", measure(false, symbols));
+	if (ioThread)
+		runner.addMetric("Responsiveness/search_input/io_thread", measure(true, symbols));
+
+	serverThread.quit();
+	serverThread.wait();
+}
@@ -0,0 +1,76 @@
+#include "BenchRunner.h"
+#include "BenchData.h"
+#include "core/Screener.h"
+#include <random>
+
+void registerScreenerBenchmarks(BenchRunner& runner)
+{
+	// MST 로드가 무거우므로 걸러진 경우 건너뜀
+	if (!runner.isEnabled("Screener/onTick") && !runner.isEnabled("Screener/query/change_gt_5pct")
+		&& !runner.isEnabled("Screener/query/kosdaq_volume_cap") && !runner.isEnabled("Screener/query/sort_all"))
+		return;
+
+	// 실제 MST 전 종목 (약 4.3k)
+	MstTable master;
+	master.load(benchMstPath("kospi_code.mst"), Market::Kospi);
+	master.load(benchMstPath("kosdaq_code.mst"), Market::Kosdaq);
+	Screener screener;
+	screener.loadUniverse(master);
+	const int count = screener.count();
+	if (count == 0) return;
+
+	// 전 종목에 시세 한 번씩 (+-15% 등락, 거래량 무작위)
+	std::mt19937 rng(11);
+	std::uniform_real_distribution<double> changeDist(-0.15, 0.15);
+	std::uniform_int_distribution<long long> volumeDist(0, 5000000);
+	std::vector<StockData> ticks(static_cast<size_t>(count));
+	for (int i = 0; i < count; ++i)
+	{
+		StockData& tick = ticks[i];
+		tick.symbol = screener.code(i);
+		tick.prevClose = qMax(1.0, screener.value(i, ScreenerField::Price));
+		tick.currentPrice = tick.prevClose * (1.0 + changeDist(rng));
+		tick.volume = volumeDist(rng);
+		screener.onTick(tick);
+	}
+
+	int next = 0;
+	runner.run("Screener/onTick", [&]()
+	{
+		screener.onTick(ticks[next]);
+		next = (next + 1) % count;
+	});
+
+	// 등락률 5% 초과, 등락률 순 상위 100
+	ScreenerQuery gainers;
+	gainers.range(ScreenerField::ChangePercent).enabled = true;
+	gainers.range(ScreenerField::ChangePercent).min = 5.0;
+	runner.run("Screener/query/change_gt_5pct", [&]()
+	{
+		doNotOptimize(screener.query(gainers));
+	}, count);
+
+	// 코스닥, 거래량 100만 이상, 시가총액 1000억 이상, 거래량 순 전부
+	ScreenerQuery active;
+	active.markets = 1 << static_cast<int>(Market::Kosdaq);
+	active.range(ScreenerField::Volume).enabled = true;
+	active.range(ScreenerField::Volume).min = 1000000;
+	active.range(ScreenerField::MarketCap).enabled = true;
+	active.range(ScreenerField::MarketCap).min = 1000;
+	active.sortBy = ScreenerField::Volume;
+	active.limit = 0;
+	runner.run("Screener/query/kosdaq_volume_cap", [&]()
+	{
+		doNotOptimize(screener.query(active));
+	}, count);
+
+	// 조건 없이 전 종목 정렬 (최악의 경우)
+	ScreenerQuery all;
+	all.excludeHalted = false;
+	all.sortBy = ScreenerField::MarketCap;
+	all.limit = 0;
+	runner.run("Screener/query/sort_all", [&]()
+	{
+		doNotOptimize(screener.query(all));
+	}, count);
+}
@@ -0,0 +1,171 @@
+#include "BenchRunner.h"
+#include "BenchData.h"
+#include "core/StockCodeMap.h"
+#include "core/SymbolTable.h"
+#include "core/SymbolSearchIndex.h"
+#include "core/MstTable.h"
+#include <QHash>
+#include <QJsonObject>
+#include <bit>
+#include <memory>
+#include <vector>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace
+{
+	// 4글자 티커 (AAAA, AAAB, ...) + 영문 회사명
+	QString usTicker(int i)
+	{
+		QString ticker;
+		int n = i;
+		for (int k = 0; k < 4; ++k)
+		{
+			ticker.prepend(QChar('A' + n % 26));
+			n /= 26;
+		}
+		return ticker;
+	}
+
+	QString usName(int i)
+	{
+		static const char* suffixes[] = { "INC", "CORP", "HOLDINGS INC", "LTD", "ETF", "TRUST", "GROUP INC" };
+		return QString("%1 %2 %3").arg(usTicker(i), "COMPANY", suffixes[i % 7]);
+	}
+
+	// QString 하나가 힙에서 차지하는 크기 추정 (QArrayData 헤더 16B + UTF-16 본문, malloc 16B 단위 + 헤더 8B)
+	qint64 qstringHeapBytes(const QString& text)
+	{
+		const qint64 bytes = 16 + (text.size() + 1) * 2 + 8;
+		return (bytes + 15) / 16 * 16;
+	}
+
+	// 지금 힙에서 쓰고 있는 바이트 (glibc만, 나머지는 -1)
+	qint64 heapInUse()
+	{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+		return static_cast<qint64>(mallinfo2().uordblks);
+#else
+		return -1;
+#endif
+	}
+}
+
+void loadBenchUniverse(int usCount)
+{
+	StockCodeMap::clear();
+	StockCodeMap::parseMstFile(benchMstPath("kospi_code.mst"));
+	StockCodeMap::parseMstFile(benchMstPath("kosdaq_code.mst"));
+
+	// 실제 Finnhub 목록처럼 대문자 티커 + 영문 회사명
+	const char* real[][2] = {
+		{ "AAPL", "APPLE INC" }, { "NVDA", "NVIDIA CORP" }, { "GOOGL", "ALPHABET INC-CL A" },
+		{ "MSFT", "MICROSOFT CORP" }, { "AMZN", "AMAZON.COM INC" }, { "TSLA", "TESLA INC" },
+		{ "META", "META PLATFORMS INC-CLASS A" }, { "NFLX", "NETFLIX INC" }
+	};
+	for (const auto& pair : real)
+		StockCodeMap::addStock(pair[0], pair[1]);
+
+	for (int i = 0; i < usCount; ++i)
+		StockCodeMap::addStock(usTicker(i), usName(i));
+}
+
+void registerStockCodeMapBenchmarks(BenchRunner& runner)
+{
+	runner.run("StockCodeMap/parseMstFile/kospi", []()
+	{
+		StockCodeMap::clear();
+		StockCodeMap::parseMstFile(benchMstPath("kospi_code.mst"));
+	});
+
+	runner.run("StockCodeMap/parseMstFile/kosdaq", []()
+	{
+		StockCodeMap::clear();
+		StockCodeMap::parseMstFile(benchMstPath("kosdaq_code.mst"));
+	});
+
+	loadBenchUniverse();
+
+	// 실제 입력 패턴: 한글 종목명 일부, 종목코드, 영문 티커, 소문자, 한 글자, 오타, 초성
+	const QStringList queries = {
+		"삼성", "삼성전자", "현대차", "카카오", "전자", "005930", "00",
+		"AAPL", "nv", "apple", "corp", "A", "없는종목",
+		"NVIDA", "microsft", "삼성전저",
+		"ㅅㅅㅈㅈ", "ㅅㅅ", "ㅋㅋㅇ", "삼ㅅㅈ"
+	};
+	for (const QString& query : queries)
+	{
+		runner.run("StockCodeMap/searchKeywords/" + query, [&query]()
+		{
+			doNotOptimize(StockCodeMap::searchKeywords(query));
+		});
+	}
+
+	// 오타 허용을 끈 기존 부분 문자열 검색과 비교
+	for (const QString& query : { QString("microsft"), QString("삼성전자") })
+	{
+		runner.run("StockCodeMap/searchKeywords/exact/" + query, [query]()
+		{
+			doNotOptimize(StockCodeMap::searchKeywords(query, 25, false));
+		});
+	}
+
+	const QStringList names = { "삼성전자", "APPLE INC", "없는종목" };
+	for (const QString& name : names)
+	{
+		runner.run("StockCodeMap/getCodeByName/" + name, [&name]()
+		{
+			doNotOptimize(StockCodeMap::getCodeByName(name));
+		});
+	}
+
+	runner.run("StockCodeMap/getName", []()
+	{
+		doNotOptimize(StockCodeMap::getName("005930"));
+	});
+
+	if (!runner.isEnabled("StockCodeMap/memory")) return;
+
+	// 같은 종목 목록 (KR MST 전체 + 가짜 US 31k)을 예전 QHash와 SymbolTable에 각각 담아 비교
+	// 검색은 SymbolTable arena를 그대로 훑고, 따로 두는 건 한글 이름의 초성 키뿐 (둘을 합쳐서 비교)
+	MstTable master;
+	master.load(benchMstPath("kospi_code.mst"), Market::Kospi);
+	master.load(benchMstPath("kosdaq_code.mst"), Market::Kosdaq);
+	std::vector<std::pair<QString, QString>> universe;
+	for (int row = 0; row < master.count(); ++row)
+		universe.emplace_back(master.code(row), master.name(row));
+	for (int i = 0; i < 31000; ++i)
+		universe.emplace_back(usTicker(i), usName(i));
+
+	qint64 heapBefore = heapInUse();
+	auto hash = std::make_unique<QHash<QString, QString>>();
+	for (const auto& [code, name] : universe)
+		hash->insert(QString(code.constData(), code.size()), QString(name.constData(), name.size()));	// 공유 없이 새로 할당
+	const qint64 hashHeap = heapBefore >= 0 ? heapInUse() - heapBefore : -1;
+
+	// 추정: 노드 (키/값 QString) + 128칸 span마다 오프셋 배열, 적재율 0.5 + 문자열 본문 두 개
+	const qint64 buckets = static_cast<qint64>(std::bit_ceil(static_cast<quint64>(hash->size()) * 2));
+	qint64 hashEstimate = hash->size() * 2 * qint64(sizeof(QString)) + buckets / 128 * (128 + 16);
+	for (auto it = hash->cbegin(); it != hash->cend(); ++it)
+		hashEstimate += qstringHeapBytes(it.key()) + qstringHeapBytes(it.value());
+
+	heapBefore = heapInUse();
+	auto table = std::make_unique<SymbolTable>();
+	auto index = std::make_unique<SymbolSearchIndex>();
+	for (const auto& [code, name] : universe)
+		index->set(table->insert(code, name), name);
+	const qint64 tableHeap = heapBefore >= 0 ? heapInUse() - heapBefore : -1;
+	const qint64 indexBytes = index->memoryUsage();
+	const qint64 tableBytes = table->memoryUsage() + indexBytes;
+
+	runner.addMetric("StockCodeMap/memory", QJsonObject{
+		{ "symbols", table->size() },
+		{ "qhash_bytes_estimate", hashEstimate },
+		{ "qhash_heap_bytes", hashHeap },
+		{ "symbol_table_bytes", tableBytes },
+		{ "search_index_bytes", indexBytes },
+		{ "symbol_table_heap_bytes", tableHeap },
+		{ "ratio", double(hashEstimate) / qMax<qint64>(tableBytes, 1) }
+	});
+}
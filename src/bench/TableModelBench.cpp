@@ -0,0 +1,65 @@
+#include "BenchRunner.h"
+#include "BenchData.h"
+#include "ui/StockTableModel.h"
+#include <memory>
+
+namespace
+{
+	StockData makeStock(int i, double price)
+	{
+		StockData data;
+		data.symbol = QString("S%1").arg(i, 5, 10, QChar('0'));
+		data.name = data.symbol;
+		data.currentPrice = price;
+		data.openPrice = price;
+		data.highPrice = price * 1.01;
+		data.lowPrice = price * 0.99;
+		data.prevClose = price * 0.995;
+		data.volume = 1000 + i;
+		data.timestamp = 1700000000000LL + i;
+		return data;
+	}
+}
+
+void registerTableModelBenchmarks(BenchRunner& runner)
+{
+	for (int rows : { 100, 1000, 10000 })
+	{
+		auto model = std::make_unique<StockTableModel>();
+		std::vector<StockData> quotes;
+		quotes.reserve(rows);
+		for (int i = 0; i < rows; ++i)
+		{
+			quotes.push_back(makeStock(i, 100.0 + i % 50));
+			model->updateOrInsert(quotes.back());
+		}
+
+		// 이미 있는 종목 갱신 (전체 행을 골고루)
+		int next = 0;
+		runner.run(QString("StockTableModel/updateOrInsert/%1").arg(rows), [&]()
+		{
+			StockData& quote = quotes[next];
+			quote.currentPrice += (next & 1) ? 0.01 : -0.01;
+			model->updateOrInsert(quote);
+			next = (next + 1) % rows;
+		});
+
+		// 화면 한 장 분량(30행) 다시 그릴 때 뷰가 요청하는 역할들
+		const int visible = qMin(rows, 30);
+		const int roles[] = { Qt::DisplayRole, Qt::DecorationRole, Qt::ForegroundRole, Qt::TextAlignmentRole };
+		int top = 0;
+		runner.run(QString("StockTableModel/data/%1").arg(rows), [&]()
+		{
+			for (int r = 0; r < visible; ++r)
+			{
+				for (int c = 0; c < StockTableModel::ColumnCount; ++c)
+				{
+					const QModelIndex idx = model->index((top + r) % rows, c);
+					for (int role : roles)
+						doNotOptimize(model->data(idx, role));
+				}
+			}
+			top = (top + visible) % rows;
+		}, visible * StockTableModel::ColumnCount * 4);
+	}
+}
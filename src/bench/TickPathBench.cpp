@@ -0,0 +1,217 @@
+#include "BenchRunner.h"
+#include "BenchData.h"
+#include "core/AllocCounter.h"
+#include "core/AlertEngine.h"
+#include "core/IndicatorStore.h"
+#include "core/KisAPI.h"
+#include "core/ProviderService.h"
+#include "core/QuoteMailbox.h"
+#include "core/StockCodeMap.h"
+#include "core/TickJournal.h"
+#include "quoteboard/QuoteBoardWriter.h"
+#include "ui/StockTableModel.h"
+#include <QCoreApplication>
+#include <QTemporaryDir>
+
+namespace
+{
+	constexpr int SymbolCount = 50;	// 관심 종목 수
+	constexpr int Rounds = 200;		// 한 바퀴 = 종목마다 한 틱 + 묶음/우편함 한 번씩 (한 프레임)
+
+	// 응답 처리 경로 그대로 (심볼/이름 붙이는 부분만 밖에서 부를 수 있게)
+	class BenchKisAPI : public KisAPI
+	{
+	public:
+		using StockAPI::stampIdentity;
+	};
+
+	// 제공자 dataReceived를 받는 곳과 묶음 보내기를 타이머 없이 부를 수 있게
+	class BenchProviderService : public ProviderService
+	{
+	public:
+		BenchProviderService() : ProviderService(nullptr, false) {}
+		using ProviderService::onQuote;
+		using ProviderService::flush;
+	};
+
+	// 응답 본문 -> StockData -> ProviderService (KisAPI::onStockReceived -> 우편함 + 묶음)
+	void ingest(BenchKisAPI& api, BenchProviderService& provider, QByteArrayView body, const QString& symbol, qint64 timestamp)
+	{
+		StockData data;
+		if (!KisAPI::parseQuote(body, data)) return;
+		api.stampIdentity(data, symbol);
+		data.timestamp = timestamp;
+		provider.onQuote(data);
+	}
+}
+
+void registerTickPathBenchmarks(BenchRunner& runner)
+{
+	const QByteArray body = readBenchData("kis_inquire_price.json");
+
+	QStringList symbols;
+	for (int i = 0; i < SymbolCount; ++i)
+	{
+		symbols << QString("%1").arg(100000 + i * 20, 6, 10, QChar('0'));
+		StockCodeMap::addStock(symbols.back(), QString("종목%1").arg(i));
+	}
+
+	BenchKisAPI api;
+	BenchProviderService provider;
+	QuoteMailbox mailbox;
+	provider.setMailbox(&mailbox);
+
+	// 화면 쪽 (MainWindow::updateUI): 테이블 + 시세판
+	StockTableModel model;
+	QuoteBoardWriter board(QString("StockFlowBench-tick-%1").arg(QCoreApplication::applicationPid()), SymbolCount);
+	board.open();
+	QObject::connect(&mailbox, &QuoteMailbox::dataReceived, &model, [&model, &board](const StockData& data)
+	{
+		model.updateOrInsert(data);
+		QuoteBoardQuote quote;
+		quote.timestamp = data.timestamp;
+		quote.price = data.currentPrice;
+		quote.open = data.openPrice;
+		quote.high = data.highPrice;
+		quote.low = data.lowPrice;
+		quote.prevClose = data.prevClose;
+		quote.volume = data.volume;
+		board.publish(data.symbol, quote);
+	});
+
+	// 모든 틱 쪽 (MainWindow::onQuotesReceived): 지표 + 알림 + 저널
+	// 알림은 울리지 않는 규칙으로 경계 검색만 태움
+	IndicatorStore indicators;
+	QVector<IndicatorSpec> specs;
+	for (const QString& text : { QString("SMA(20)"), QString("RSI(14)") })
+	{
+		IndicatorSpec spec;
+		if (IndicatorSpec::fromString(text, spec))
+			specs.append(spec);
+	}
+	indicators.setSpecs(specs);
+
+	AlertEngine alerts;
+	for (const QString& symbol : symbols)
+	{
+		AlertRule rule;
+		rule.symbol = symbol;
+		rule.kind = AlertKind::PriceAbove;
+		rule.level = 1e12;
+		alerts.addRule(rule);
+	}
+
+	QTemporaryDir journalDir;
+	TickJournal journal(journalDir.path());
+	journal.start();
+
+	quint64 consumeAllocations = 0;
+	QObject::connect(&provider, &ProviderService::quotesReceived, &provider, [&](const QVector<StockData>& quotes)
+	{
+		AllocCounter::Scope scope;
+		for (const StockData& data : quotes)
+		{
+			indicators.onTick(data);
+			alerts.onTick(data);
+			journal.record(data);
+		}
+		consumeAllocations += scope.allocations();
+	});
+
+	// 프레임 하나: 묶음을 GUI로 보내고(큐 이벤트) 우편함을 비움
+	auto flush = [&provider]()
+	{
+		provider.flush();
+		QCoreApplication::sendPostedEvents(&provider);
+	};
+	auto drain = [&mailbox]()
+	{
+		mailbox.drain();
+		QCoreApplication::removePostedEvents(&mailbox);
+	};
+	auto deliver = [&]()
+	{
+		flush();
+		drain();
+	};
+
+	// 데우기: 종목 캐시, 우편함 슬롯, 묶음 두 벌의 용량, 모델 행/틱 기록, 지표/알림 상태가 전부 만들어진 상태로
+	qint64 timestamp = 1700000000000LL;
+	for (int round = 0; round < 2; ++round)
+	{
+		for (const QString& symbol : symbols)
+			ingest(api, provider, body, symbol, ++timestamp);
+		deliver();
+	}
+
+	int next = 0;
+	runner.run("TickPath/ingest_to_model/warm", [&]()
+	{
+		ingest(api, provider, body, symbols[next], ++timestamp);
+		if (++next == SymbolCount)
+		{
+			next = 0;
+			deliver();
+		}
+	});
+	deliver();
+
+	// 할당 횟수
+	// 프레임의 첫 틱(우편함을 깨우는 이벤트, 묶음 타이머)과 묶음 보내기(큐 이벤트)는 프레임당 한 번이라 따로 셈
+	quint64 wakeAllocations = 0;
+	quint64 ingestAllocations = 0;
+	quint64 flushAllocations = 0;
+	quint64 applyAllocations = 0;
+	consumeAllocations = 0;
+	for (int round = 0; round < Rounds; ++round)
+	{
+		{
+			AllocCounter::Scope scope;
+			ingest(api, provider, body, symbols.front(), ++timestamp);
+			wakeAllocations += scope.allocations();
+		}
+		{
+			AllocCounter::Scope scope;
+			for (int i = 1; i < SymbolCount; ++i)
+				ingest(api, provider, body, symbols[i], ++timestamp);
+			ingestAllocations += scope.allocations();
+		}
+		{
+			AllocCounter::Scope scope;
+			flush();
+			flushAllocations += scope.allocations();
+		}
+		{
+			AllocCounter::Scope scope;
+			drain();
+			applyAllocations += scope.allocations();
+		}
+	}
+
+	// 묶음 보내기 중 할당에서 모든 틱 소비(틱마다)를 빼면 프레임당 고정 비용
+	const quint64 frameAllocations = flushAllocations - consumeAllocations;
+	const quint64 tickAllocations = ingestAllocations + consumeAllocations + applyAllocations;
+	const qint64 ticks = qint64(SymbolCount) * Rounds;
+
+	// 데워진 틱 경로는 할당이 없어야 함 (카운터 없이 빌드했으면 확인할 수 없음)
+	if (AllocCounter::isEnabled() && runner.isEnabled("TickPath/allocations") && tickAllocations > 0)
+	{
+		runner.addFailure("TickPath/allocations", QString("데워진 틱 경로에서 힙 할당 %1회 (틱 %2개: 수신 %3, 지표/알림/저널 %4, 화면 %5)")
+			.arg(tickAllocations).arg(ticks).arg(ingestAllocations).arg(consumeAllocations).arg(applyAllocations));
+	}
+
+	runner.addMetric("TickPath/allocations", QJsonObject{
+		{ "enabled", AllocCounter::isEnabled() },
+		{ "symbols", SymbolCount },
+		{ "ticks", ticks },
+		{ "frames", Rounds },
+		{ "per_tick", double(tickAllocations) / ticks },
+		{ "per_tick_consumers", double(consumeAllocations) / ticks },
+		{ "per_frame_wake", double(wakeAllocations) / Rounds },
+		{ "per_frame_flush", double(frameAllocations) / Rounds }
+	});
+
+	journal.stop();
+	for (const QString& symbol : symbols)
+		StockCodeMap::removeStock(symbol);
+}
@@ -0,0 +1,69 @@
+#include <QApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QJsonDocument>
+#include <QTextStream>
+#include "BenchRunner.h"
+#include "BenchData.h"
+
+namespace
+{
+	// 측정 중 qDebug 출력이 시간에 섞이지 않도록 경고 이상만 남김
+	void quietMessageHandler(QtMsgType type, const QMessageLogContext&, const QString& message)
+	{
+		if (type == QtDebugMsg || type == QtInfoMsg) return;
+		QTextStream(stderr) << message << "\n";
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	// 모델/위젯 벤치마크용. 화면 없이도 돌도록
+	if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+		qputenv("QT_QPA_PLATFORM", "offscreen");
+
+	QApplication app(argc, argv);
+	app.setApplicationName("stockflow_bench");
+
+	QCommandLineParser parser;
+	parser.setApplicationDescription("StockFlow 핵심 경로 마이크로벤치마크 (결과: JSON)");
+	parser.addHelpOption();
+	QCommandLineOption outputOption({ "o", "output" }, "결과 JSON 파일 (기본: stdout)", "file");
+	QCommandLineOption filterOption({ "f", "filter" }, "이름이 정규식과 맞는 벤치마크만 실행", "regex");
+	QCommandLineOption timeOption("min-time", "벤치마크 하나당 최소 측정 시간 (ms)", "ms", "200");
+	parser.addOptions({ outputOption, filterOption, timeOption });
+	parser.process(app);
+
+	qInstallMessageHandler(quietMessageHandler);
+
+	BenchRunner runner(parser.value(filterOption), parser.value(timeOption).toInt());
+	registerStockCodeMapBenchmarks(runner);
+	registerQuoteParseBenchmarks(runner);
+	registerOrderBookBenchmarks(runner);
+	registerTickPathBenchmarks(runner);
+	registerTableModelBenchmarks(runner);
+	registerAlertEngineBenchmarks(runner);
+	registerQuoteBoardBenchmarks(runner);
+	registerMstTableBenchmarks(runner);
+	registerScreenerBenchmarks(runner);
+	registerResponsivenessBenchmarks(runner);
+
+	const QByteArray json = QJsonDocument(runner.toJson()).toJson();
+	if (parser.isSet(outputOption))
+	{
+		QFile file(parser.value(outputOption));
+		if (!file.open(QIODevice::WriteOnly))
+		{
+			QTextStream(stderr) << "결과 파일을 쓸 수 없습니다: " << file.fileName() << "\n";
+			return 1;
+		}
+		file.write(json);
+	}
+	else
+	{
+		QTextStream(stdout) << json;
+	}
+
+	// 결과는 남기고 나서 실패로 끝냄 (CI에서 잡히도록)
+	return runner.hasFailures() ? 2 : 0;
+}
@@ -0,0 +1,196 @@
+#include "Collector.h"
+#include "core/FinnhubAPI.h"
+#include "core/KisAPI.h"
+#include "core/Config.h"
+#include <QSettings>
+#include <QFileInfo>
+#include <QRegularExpression>
+#include <QDebug>
+
+bool CollectorConfig::load(const QString& path, CollectorConfig& config)
+{
+	if (!QFileInfo::exists(path))
+	{
+		qDebug() << "[Collector] 설정 파일 없음, 기본값 사용:" << path;
+		return false;
+	}
+
+	QSettings settings(path, QSettings::IniFormat);
+	settings.beginGroup("collector");
+
+	// "AAPL, NVDA, 005930" 처럼 한 줄로 써도 되고 QSettings 목록이어도 됨
+	config.symbols = parseSymbols(settings.value("symbols").toStringList());
+
+	config.intervalMs = qMax(1000, settings.value("interval_ms", config.intervalMs).toInt());
+	config.format = settings.value("format", config.format).toString();
+	config.output = settings.value("output", config.output).toString();
+	config.skipUnchanged = settings.value("skip_unchanged", config.skipUnchanged).toBool();
+	config.flushMs = qMax(100, settings.value("flush_ms", config.flushMs).toInt());
+	config.statsMs = settings.value("stats_ms", config.statsMs).toInt();
+	config.mstDir = settings.value("mst_dir", config.mstDir).toString();
+	settings.endGroup();
+
+	config.finnhubUrl = settings.value("endpoints/finnhub").toString();
+	config.kisUrl = settings.value("endpoints/kis").toString();
+	return true;
+}
+
+QStringList CollectorConfig::parseSymbols(const QStringList& items)
+{
+	QStringList symbols;
+	for (const QString& item : items)
+	{
+		for (const QString& symbol : item.split(',', Qt::SkipEmptyParts))
+		{
+			QString code = symbol.trimmed().toUpper();
+			if (!code.isEmpty() && !symbols.contains(code))
+				symbols.append(code);
+		}
+	}
+	return symbols;
+}
+
+namespace
+{
+	constexpr int AuthRetryMs = 60 * 1000;			// 토큰 발급 응답이 없거나 실패했을 때
+	constexpr qint64 RenewBeforeSecs = 5 * 60;		// 만료 이만큼 전에 재발급 (KisAPI는 10분 미만 남은 저장 토큰을 다시 쓰지 않으므로 새로 받음)
+}
+
+Collector::Collector(const CollectorConfig& config, QObject* parent)
+	: QObject(parent), m_config(config)
+{
+	m_usApi = new FinnhubAPI(this);
+	m_krApi = new KisAPI(this);
+	connect(m_usApi, &StockAPI::dataReceived, this, &Collector::onDataReceived);
+	connect(m_krApi, &StockAPI::dataReceived, this, &Collector::onDataReceived);
+
+	// 토큰이 나오면 한국 종목도 바로 한 번 요청하고, 만료 전에 다시 발급받도록 예약
+	// (24시간 넘게 도는 데몬이라 한 번 발급으로 끝나지 않음)
+	m_authTimer = new QTimer(this);
+	m_authTimer->setSingleShot(true);
+	connect(m_authTimer, &QTimer::timeout, this, &Collector::authenticateKr);
+	connect(m_krApi, &KisAPI::authenticated, this, [this]()
+	{
+		m_krReady = true;
+		const qint64 renewIn = QDateTime::currentDateTime().secsTo(m_krApi->tokenExpiry()) - RenewBeforeSecs;
+		m_authTimer->start(static_cast<int>(qBound<qint64>(AuthRetryMs / 1000, renewIn, 24 * 60 * 60) * 1000));
+		qDebug() << "[Collector] KIS 토큰 재발급 예정:" << QDateTime::currentDateTime().addMSecs(m_authTimer->interval());
+		poll();
+	});
+
+	m_pollTimer = new QTimer(this);
+	connect(m_pollTimer, &QTimer::timeout, this, &Collector::poll);
+
+	m_flushTimer = new QTimer(this);
+	connect(m_flushTimer, &QTimer::timeout, this, [this]() { if (m_sink) m_sink->flush(); });
+
+	m_statsTimer = new QTimer(this);
+	connect(m_statsTimer, &QTimer::timeout, this, &Collector::logStats);
+}
+
+Collector::~Collector()
+{
+	stop();
+}
+
+bool Collector::start()
+{
+	if (m_config.symbols.isEmpty())
+	{
+		QSettings settings(Config::SETTINGS_COMPANY, Config::SETTINGS_APP);
+		m_config.symbols = settings.value(Config::KEY_FAVORITES).toStringList();
+	}
+	if (m_config.symbols.isEmpty())
+	{
+		qDebug() << "[Collector] 수집할 종목이 없습니다 ([collector] symbols)";
+		return false;
+	}
+
+	m_sink = QuoteSink::create(m_config.format, m_config.output);
+	if (!m_sink || !m_sink->open())
+	{
+		m_sink.reset();
+		return false;
+	}
+
+	qDebug() << "[Collector]" << m_config.symbols.size() << "종목," << m_config.intervalMs << "ms 주기,"
+	         << m_config.format << "->" << m_config.output;
+
+	m_pollTimer->start(m_config.intervalMs);
+	m_flushTimer->start(m_config.flushMs);
+	if (m_config.statsMs > 0)
+		m_statsTimer->start(m_config.statsMs);
+
+	// 미국 종목은 바로, 한국 종목은 토큰 발급 후부터
+	authenticateKr();
+	poll();
+	return true;
+}
+
+void Collector::stop()
+{
+	m_pollTimer->stop();
+	m_flushTimer->stop();
+	m_statsTimer->stop();
+	m_authTimer->stop();
+
+	if (m_sink)
+	{
+		m_sink->close();
+		logStats();
+		m_sink.reset();
+	}
+}
+
+StockAPI* Collector::apiFor(const QString& symbol) const
+{
+	static const QRegularExpression re("^[0-9]{6}$");    // 숫자 6자리 (한국 종목 패턴)
+	if (re.match(symbol).hasMatch())
+		return m_krApi;
+	return m_usApi;
+}
+
+void Collector::authenticateKr()
+{
+	// 발급될 때까지 한국 종목은 요청하지 않음. 응답이 없거나 실패하면 잠시 뒤 다시
+	m_krReady = false;
+	m_authTimer->start(AuthRetryMs);
+	m_krApi->authenticate();
+}
+
+void Collector::poll()
+{
+	for (const QString& symbol : m_config.symbols)
+	{
+		StockAPI* api = apiFor(symbol);
+		if (api == m_krApi && !m_krReady) continue;
+		api->fetchStock(symbol);
+	}
+}
+
+void Collector::onDataReceived(const StockData& data)
+{
+	if (!m_sink) return;
+	++m_received;
+
+	if (m_config.skipUnchanged)
+	{
+		LastQuote& last = m_last[data.symbol];
+		if (last.price == data.currentPrice && last.volume == data.volume)
+		{
+			++m_skipped;
+			return;
+		}
+		last.price = data.currentPrice;
+		last.volume = data.volume;
+	}
+
+	if (!m_sink->write(data))
+		qDebug() << "[Collector] 기록 실패:" << data.symbol;
+}
+
+void Collector::logStats()
+{
+	qDebug() << "[Collector] 수신" << m_received << "/ 기록" << (m_sink ? m_sink->writtenCount() : 0)
+	         << "/ 변화 없음" << m_skipped;
+}
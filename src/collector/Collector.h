@@ -0,0 +1,76 @@
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+#include <QHash>
+#include <QStringList>
+#include <memory>
+#include "core/StockData.h"
+#include "core/QuoteSink.h"
+
+class StockAPI;
+class FinnhubAPI;
+class KisAPI;
+
+// 수집기 설정 (collector.ini의 [collector], [endpoints] 그룹)
+struct CollectorConfig
+{
+	QStringList symbols;			// 비어 있으면 GUI 관심종목 사용
+	int intervalMs = 10000;			// 시세 요청 주기
+	QString format = "ndjson";		// csv / ndjson / journal
+	QString output = "quotes.ndjson";
+	bool skipUnchanged = true;		// 가격/거래량이 그대로인 응답은 기록 안 함 (장 마감 후 폴링)
+	int flushMs = 1000;
+	int statsMs = 60000;			// 0 = 통계 로그 안 남김
+	QString mstDir = ".";			// kospi_code.mst / kosdaq_code.mst 위치
+	QString finnhubUrl;				// [endpoints] (비어 있으면 Endpoints 기본 순서)
+	QString kisUrl;
+
+	// 파일이 없으면 기본값 그대로 false
+	static bool load(const QString& path, CollectorConfig& config);
+	// "AAPL, NVDA, 005930" -> 앞뒤 공백 없는 대문자 목록 (중복 제거)
+	static QStringList parseSymbols(const QStringList& items);
+};
+
+// 창 없이 관심종목 시세를 주기적으로 받아 QuoteSink에 기록
+// GUI의 갱신 경로(fetchStock -> dataReceived)를 그대로 사용하고 로고/차트는 요청하지 않음
+class Collector : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit Collector(const CollectorConfig& config, QObject* parent = nullptr);
+	~Collector();
+
+	bool start();
+	void stop();
+
+private slots:
+	void poll();
+	void onDataReceived(const StockData& data);
+	void logStats();
+
+private:
+	// 기록할 필요가 있는지 판단하는 심볼별 직전 값
+	struct LastQuote
+	{
+		double price = 0.0;
+		long long volume = -1;
+	};
+
+	CollectorConfig m_config;
+	FinnhubAPI* m_usApi;
+	KisAPI* m_krApi;
+	std::unique_ptr<QuoteSink> m_sink;
+	QHash<QString, LastQuote> m_last;
+	QTimer* m_pollTimer;
+	QTimer* m_flushTimer;
+	QTimer* m_statsTimer;
+	QTimer* m_authTimer;			// KIS 토큰 만료 전 재발급 (실패하면 잠시 뒤 재시도)
+	bool m_krReady = false;			// KIS 토큰 발급 완료 (재발급 중에는 false)
+	quint64 m_received = 0;
+	quint64 m_skipped = 0;
+
+	StockAPI* apiFor(const QString& symbol) const;
+	void authenticateKr();
+};
@@ -0,0 +1,85 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTimer>
+#include <QDebug>
+#include <atomic>
+#include <csignal>
+#include "Collector.h"
+#include "core/Endpoints.h"
+#include "core/StockCodeMap.h"
+
+namespace
+{
+	// 시그널 핸들러에서는 플래그만 세우고 이벤트 루프에서 종료 (Qt 호출은 안전하지 않음)
+	std::atomic<bool> g_stopRequested{ false };
+
+	void requestStop(int)
+	{
+		g_stopRequested.store(true);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	QCoreApplication app(argc, argv);
+
+	QCommandLineParser parser;
+	parser.setApplicationDescription("StockFlow 시세 수집기 (창 없이 관심종목 시세를 파일로 기록)");
+	parser.addHelpOption();
+	QCommandLineOption configOption("config", "설정 파일 (INI)", "path", "collector.ini");
+	QCommandLineOption formatOption("format", "출력 형식 (csv / ndjson / journal)", "format");
+	QCommandLineOption outputOption("output", "출력 파일 (journal은 디렉터리)", "path");
+	QCommandLineOption symbolsOption("symbols", "수집할 종목 (쉼표 구분)", "list");
+	QCommandLineOption durationOption("duration", "이 시간(초)이 지나면 종료 (0 = 계속)", "seconds", "0");
+	QCommandLineOption finnhubOption("finnhub-url", "Finnhub 서버 주소", "url");
+	QCommandLineOption kisOption("kis-url", "한국투자증권 서버 주소", "url");
+	parser.addOptions({ configOption, formatOption, outputOption, symbolsOption, durationOption, finnhubOption, kisOption });
+	parser.process(app);
+
+	// 수집 설정 (명령행 > 설정 파일)
+	CollectorConfig config;
+	CollectorConfig::load(parser.value(configOption), config);
+	if (parser.isSet(formatOption))
+		config.format = parser.value(formatOption);
+	if (parser.isSet(outputOption))
+		config.output = parser.value(outputOption);
+	if (parser.isSet(symbolsOption))
+		config.symbols = CollectorConfig::parseSymbols({ parser.value(symbolsOption) });
+
+	// 서버 주소 (명령행 > 설정 파일 > 환경 변수/앱 설정 > Config.h)
+	Endpoints::loadOverrides();
+	if (!config.finnhubUrl.isEmpty())
+		Endpoints::setFinnhubBaseUrl(config.finnhubUrl);
+	if (!config.kisUrl.isEmpty())
+		Endpoints::setKisBaseUrl(config.kisUrl);
+	if (parser.isSet(finnhubOption))
+		Endpoints::setFinnhubBaseUrl(parser.value(finnhubOption));
+	if (parser.isSet(kisOption))
+		Endpoints::setKisBaseUrl(parser.value(kisOption));
+
+	// 한국 종목 이름 (없어도 수집은 됨)
+	StockCodeMap::parseMstFile(config.mstDir + "/kospi_code.mst");
+	StockCodeMap::parseMstFile(config.mstDir + "/kosdaq_code.mst");
+
+	Collector collector(config);
+	if (!collector.start())
+		return 1;
+
+	// Ctrl+C / 서비스 종료 시 남은 버퍼를 쓰고 끝냄
+	std::signal(SIGINT, requestStop);
+	std::signal(SIGTERM, requestStop);
+	QTimer stopPoll;
+	QObject::connect(&stopPoll, &QTimer::timeout, &app, [&app]()
+	{
+		if (g_stopRequested.load())
+			app.quit();
+	});
+	stopPoll.start(200);
+
+	const int duration = parser.value(durationOption).toInt();
+	if (duration > 0)
+		QTimer::singleShot(duration * 1000, &app, &QCoreApplication::quit);
+
+	QObject::connect(&app, &QCoreApplication::aboutToQuit, &collector, &Collector::stop);
+	return app.exec();
+}
@@ -0,0 +1,379 @@
+#include "AlertEngine.h"
+#include <QDateTime>
+#include <QFile>
+#include <QSaveFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QDebug>
+
+namespace
+{
+	const int FILE_VERSION = 1;
+}
+
+AlertEngine::AlertEngine(QObject* parent) : QObject(parent)
+{
+	qRegisterMetaType<AlertEvent>();
+}
+
+AlertEngine::Metric AlertEngine::metricOf(AlertKind kind)
+{
+	return (kind == AlertKind::PercentAbove || kind == AlertKind::PercentBelow) ? MetricPercent : MetricPrice;
+}
+
+bool AlertEngine::isUpward(AlertKind kind)
+{
+	return kind == AlertKind::PriceAbove || kind == AlertKind::CrossAbove || kind == AlertKind::PercentAbove;
+}
+
+bool AlertEngine::isCross(AlertKind kind)
+{
+	return kind == AlertKind::CrossAbove || kind == AlertKind::CrossBelow;
+}
+
+quint32 AlertEngine::addRule(const AlertRule& rule)
+{
+	if (rule.symbol.isEmpty()) return 0;
+
+	int slot;
+	if (!m_freeSlots.empty())
+	{
+		slot = m_freeSlots.back();
+		m_freeSlots.pop_back();
+	}
+	else
+	{
+		slot = static_cast<int>(m_rules.size());
+		m_rules.emplace_back();
+	}
+
+	RuleState& state = m_rules[slot];
+	state = RuleState();
+	state.rule = rule;
+	state.rule.id = (rule.id != 0 && !m_idToSlot.contains(rule.id)) ? rule.id : m_nextId;
+	state.rule.hysteresis = qAbs(rule.hysteresis);
+	state.active = true;
+	m_nextId = qMax(m_nextId, state.rule.id + 1);
+	m_idToSlot.insert(state.rule.id, slot);
+	const quint32 id = state.rule.id;
+
+	SymbolIndex& index = m_index[rule.symbol];
+	++index.ruleCount;
+	placeBoundary(slot, index);
+
+	// 이미 시세가 있는 종목이면 지금 값으로 바로 판정 (돌파형은 다음 돌파부터)
+	const int metric = metricOf(rule.kind);
+	if (index.hasLast[metric] && !isCross(rule.kind))
+	{
+		const double value = index.last[metric];
+		const bool met = isUpward(rule.kind) ? value >= rule.level : value <= rule.level;
+		if (met)
+			fire(slot, index, value, QDateTime::currentMSecsSinceEpoch());
+	}
+
+	return id;
+}
+
+bool AlertEngine::removeRule(quint32 id)
+{
+	auto it = m_idToSlot.find(id);
+	if (it == m_idToSlot.end()) return false;
+
+	const int slot = it.value();
+	m_idToSlot.erase(it);
+
+	RuleState& state = m_rules[slot];
+	auto indexIt = m_index.find(state.rule.symbol);
+	if (indexIt != m_index.end())
+	{
+		// 규칙이 다 지워져도 종목 항목은 남겨둠 (알림 처리 중에 지워질 수 있어서)
+		unplaceBoundary(slot, *indexIt);
+		--indexIt->ruleCount;
+	}
+
+	state = RuleState();
+	m_freeSlots.push_back(slot);
+	return true;
+}
+
+int AlertEngine::removeRules(const QString& symbol)
+{
+	QVector<quint32> ids;
+	for (const RuleState& state : m_rules)
+	{
+		if (state.active && state.rule.symbol == symbol)
+			ids.append(state.rule.id);
+	}
+	for (quint32 id : ids)
+		removeRule(id);
+	return ids.size();
+}
+
+void AlertEngine::clear()
+{
+	m_rules.clear();
+	m_freeSlots.clear();
+	m_idToSlot.clear();
+	m_index.clear();
+}
+
+QVector<AlertRule> AlertEngine::rules() const
+{
+	QVector<AlertRule> result;
+	result.reserve(m_idToSlot.size());
+	for (const RuleState& state : m_rules)
+	{
+		if (state.active)
+			result.append(state.rule);
+	}
+	return result;
+}
+
+QVector<AlertRule> AlertEngine::rulesFor(const QString& symbol) const
+{
+	QVector<AlertRule> result;
+	auto it = m_index.constFind(symbol);
+	if (it == m_index.cend() || it->ruleCount == 0) return result;
+
+	for (const RuleState& state : m_rules)
+	{
+		if (state.active && state.rule.symbol == symbol)
+			result.append(state.rule);
+	}
+	return result;
+}
+
+void AlertEngine::placeBoundary(int slot, SymbolIndex& index)
+{
+	RuleState& state = m_rules[slot];
+	const AlertRule& rule = state.rule;
+	const int metric = metricOf(rule.kind);
+	const bool upward = isUpward(rule.kind);
+
+	// 무장 상태: 기준값을 트리거 방향으로 넘으면 울림
+	// 해제 상태: 기준값에서 히스테리시스만큼 되돌아오는 방향으로 넘으면 재무장
+	double boundary;
+	if (state.armed)
+	{
+		boundary = rule.level;
+		state.placedUp = upward;
+	}
+	else
+	{
+		boundary = upward ? rule.level - rule.hysteresis : rule.level + rule.hysteresis;
+		state.placedUp = !upward;
+	}
+
+	BoundaryMap& map = state.placedUp ? index.up[metric] : index.down[metric];
+	state.pos = map.emplace(boundary, slot);
+	state.placed = true;
+}
+
+void AlertEngine::unplaceBoundary(int slot, SymbolIndex& index)
+{
+	RuleState& state = m_rules[slot];
+	if (!state.placed) return;
+
+	const int metric = metricOf(state.rule.kind);
+	BoundaryMap& map = state.placedUp ? index.up[metric] : index.down[metric];
+	map.erase(state.pos);
+	state.placed = false;
+}
+
+void AlertEngine::onTick(const StockData& data)
+{
+	if (data.currentPrice <= 0) return;
+
+	auto it = m_index.find(data.symbol);
+	if (it == m_index.end()) return;
+
+	const qint64 now = data.timestamp > 0 ? data.timestamp : QDateTime::currentMSecsSinceEpoch();
+
+	evaluateMetric(*it, MetricPrice, data.currentPrice, now);
+	if (data.prevClose > 0)
+		evaluateMetric(*it, MetricPercent, data.getChangePercentage(), now);
+}
+
+void AlertEngine::evaluateMetric(SymbolIndex& index, int metric, double value, qint64 now)
+{
+	BoundaryMap& up = index.up[metric];
+	BoundaryMap& down = index.down[metric];
+	m_crossed.clear();
+
+	if (!index.hasLast[metric])
+	{
+		// 첫 시세: 이미 조건을 만족하는 수준형(Above/Below) 규칙만. 돌파형은 직전 값이 없으니 제외
+		for (auto i = up.begin(), end = up.upper_bound(value); i != end; ++i)
+		{
+			if (!isCross(m_rules[i->second].rule.kind)) m_crossed.push_back(i->second);
+		}
+		for (auto i = down.lower_bound(value); i != down.end(); ++i)
+		{
+			if (!isCross(m_rules[i->second].rule.kind)) m_crossed.push_back(i->second);
+		}
+	}
+	else
+	{
+		const double prev = index.last[metric];
+		if (value > prev)
+		{
+			// (prev, value] 구간을 위로 넘은 경계
+			for (auto i = up.upper_bound(prev), end = up.upper_bound(value); i != end; ++i)
+				m_crossed.push_back(i->second);
+		}
+		else if (value < prev)
+		{
+			// [value, prev) 구간을 아래로 넘은 경계
+			for (auto i = down.lower_bound(value), end = down.lower_bound(prev); i != end; ++i)
+				m_crossed.push_back(i->second);
+		}
+	}
+
+	index.last[metric] = value;
+	index.hasLast[metric] = true;
+
+	// 처리 중에 맵이 바뀌므로 모아둔 뒤 처리. 옮겨진 경계는 반대쪽 맵으로 가서 이번 틱에 다시 걸리지 않음
+	for (int slot : m_crossed)
+	{
+		RuleState& state = m_rules[slot];
+		if (!state.active) continue;	// 앞선 알림 처리 중에 삭제됨
+
+		if (state.armed)
+		{
+			fire(slot, index, value, now);
+		}
+		else
+		{
+			unplaceBoundary(slot, index);
+			state.armed = true;
+			placeBoundary(slot, index);
+		}
+	}
+}
+
+void AlertEngine::fire(int slot, SymbolIndex& index, double value, qint64 now)
+{
+	RuleState& state = m_rules[slot];
+
+	// 울리든 쿨다운으로 억제되든 재무장 대기로 넘어감
+	unplaceBoundary(slot, index);
+	state.armed = false;
+	placeBoundary(slot, index);
+
+	if (state.lastFiredMs != 0 && now - state.lastFiredMs < state.rule.cooldownMs)
+	{
+		++m_suppressed;
+		return;
+	}
+	state.lastFiredMs = now;
+
+	AlertEvent event;
+	event.rule = state.rule;
+	event.value = value;
+	event.timestamp = now;
+	emit alertTriggered(event);
+}
+
+QString AlertEngine::kindToString(AlertKind kind)
+{
+	switch (kind)
+	{
+	case AlertKind::PriceAbove:   return "price_above";
+	case AlertKind::PriceBelow:   return "price_below";
+	case AlertKind::CrossAbove:   return "cross_above";
+	case AlertKind::CrossBelow:   return "cross_below";
+	case AlertKind::PercentAbove: return "percent_above";
+	case AlertKind::PercentBelow: return "percent_below";
+	}
+	return QString();
+}
+
+bool AlertEngine::kindFromString(const QString& text, AlertKind& kind)
+{
+	static const AlertKind kinds[] = {
+		AlertKind::PriceAbove, AlertKind::PriceBelow, AlertKind::CrossAbove,
+		AlertKind::CrossBelow, AlertKind::PercentAbove, AlertKind::PercentBelow
+	};
+	for (AlertKind candidate : kinds)
+	{
+		if (kindToString(candidate) == text)
+		{
+			kind = candidate;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool AlertEngine::load(const QString& path)
+{
+	QFile file(path);
+	if (!file.open(QIODevice::ReadOnly))
+		return false;	// 아직 저장한 적 없음
+
+	QJsonParseError error;
+	QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+	if (error.error != QJsonParseError::NoError || !doc.isObject())
+	{
+		qDebug() << "[AlertEngine] 알림 파일 형식 오류:" << path << error.errorString();
+		return false;
+	}
+
+	QJsonObject root = doc.object();
+	if (root["version"].toInt() != FILE_VERSION)
+	{
+		qDebug() << "[AlertEngine] 지원하지 않는 알림 파일 버전:" << root["version"].toInt();
+		return false;
+	}
+
+	clear();
+	for (const QJsonValue& value : root["rules"].toArray())
+	{
+		QJsonObject obj = value.toObject();
+
+		AlertRule rule;
+		if (!kindFromString(obj["kind"].toString(), rule.kind)) continue;
+		rule.id = static_cast<quint32>(obj["id"].toInteger());
+		rule.symbol = obj["symbol"].toString();
+		rule.level = obj["level"].toDouble();
+		rule.hysteresis = obj["hysteresis"].toDouble();
+		rule.cooldownMs = obj["cooldown_ms"].toInteger();
+		rule.note = obj["note"].toString();
+		addRule(rule);
+	}
+	return true;
+}
+
+bool AlertEngine::save(const QString& path) const
+{
+	QJsonArray array;
+	for (const RuleState& state : m_rules)
+	{
+		if (!state.active) continue;
+
+		const AlertRule& rule = state.rule;
+		QJsonObject obj;
+		obj["id"] = static_cast<qint64>(rule.id);
+		obj["symbol"] = rule.symbol;
+		obj["kind"] = kindToString(rule.kind);
+		obj["level"] = rule.level;
+		if (rule.hysteresis != 0) obj["hysteresis"] = rule.hysteresis;
+		if (rule.cooldownMs != 0) obj["cooldown_ms"] = rule.cooldownMs;
+		if (!rule.note.isEmpty()) obj["note"] = rule.note;
+		array.append(obj);
+	}
+
+	QJsonObject root;
+	root["version"] = FILE_VERSION;
+	root["rules"] = array;
+
+	QSaveFile file(path);
+	if (!file.open(QIODevice::WriteOnly))
+	{
+		qDebug() << "[AlertEngine] 알림 파일 저장 실패:" << path;
+		return false;
+	}
+	file.write(QJsonDocument(root).toJson());
+	return file.commit();
+}
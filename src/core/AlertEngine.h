@@ -0,0 +1,121 @@
+#pragma once
+
+#include <QObject>
+#include <QHash>
+#include <QString>
+#include <QVector>
+#include <array>
+#include <map>
+#include <vector>
+#include "StockData.h"
+
+// 알림 조건
+enum class AlertKind
+{
+	PriceAbove,		// 가격 >= 기준 (처음 받은 시세가 이미 넘어 있어도 울림)
+	PriceBelow,		// 가격 <= 기준
+	CrossAbove,		// 기준 아래에서 위로 돌파할 때만
+	CrossBelow,		// 기준 위에서 아래로 이탈할 때만
+	PercentAbove,	// 전일 대비 등락률(%) >= 기준
+	PercentBelow	// 전일 대비 등락률(%) <= 기준
+};
+
+struct AlertRule
+{
+	quint32 id = 0;
+	QString symbol;
+	AlertKind kind = AlertKind::PriceAbove;
+	double level = 0.0;			// 기준값 (가격 또는 %)
+	double hysteresis = 0.0;	// 재무장 폭. 울린 뒤 기준에서 이만큼 되돌아와야 다시 울림 (같은 단위)
+	qint64 cooldownMs = 0;		// 울린 뒤 이 시간 동안은 다시 울리지 않음
+	QString note;
+};
+
+struct AlertEvent
+{
+	AlertRule rule;
+	double value = 0.0;		// 울린 시점의 가격 또는 등락률
+	qint64 timestamp = 0;	// epoch ms
+};
+
+// 시세 알림 엔진
+// 종목마다 "다음에 넘으면 상태가 바뀌는 경계값"을 정렬해 두고,
+// 틱이 오면 직전 값과 현재 값 사이에 있는 경계만 꺼내서 처리함 (규칙 수와 무관하게 O(log n + 넘은 개수))
+class AlertEngine : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit AlertEngine(QObject* parent = nullptr);
+
+	quint32 addRule(const AlertRule& rule);		// 반환: 새 규칙 ID
+	bool removeRule(quint32 id);
+	int removeRules(const QString& symbol);
+	void clear();
+
+	int ruleCount() const { return m_idToSlot.size(); }
+	QVector<AlertRule> rules() const;
+	QVector<AlertRule> rulesFor(const QString& symbol) const;
+
+	// 억제된 알림 수 (쿨다운 중에 조건을 다시 만족한 경우)
+	quint64 suppressedCount() const { return m_suppressed; }
+
+	bool load(const QString& path);
+	bool save(const QString& path) const;
+
+	static QString kindToString(AlertKind kind);
+	static bool kindFromString(const QString& text, AlertKind& kind);
+
+public slots:
+	void onTick(const StockData& data);
+
+signals:
+	void alertTriggered(const AlertEvent& event);
+
+private:
+	enum Metric { MetricPrice = 0, MetricPercent, MetricCount };
+
+	using BoundaryMap = std::multimap<double, int>;	// 경계값 -> 규칙 슬롯
+
+	struct SymbolIndex
+	{
+		// 위로 넘을 때 / 아래로 넘을 때 상태가 바뀌는 경계
+		std::array<BoundaryMap, MetricCount> up;
+		std::array<BoundaryMap, MetricCount> down;
+		std::array<double, MetricCount> last{};
+		std::array<bool, MetricCount> hasLast{};
+		int ruleCount = 0;
+	};
+
+	struct RuleState
+	{
+		AlertRule rule;
+		bool active = false;	// 슬롯 사용 중
+		bool armed = true;		// true: 트리거 대기, false: 재무장 대기
+		qint64 lastFiredMs = 0;
+		// 현재 경계 위치. 맵 주소는 종목 해시가 커질 때 바뀔 수 있어서 방향만 기억
+		// (std::multimap은 이동돼도 반복자가 유지됨)
+		bool placed = false;
+		bool placedUp = false;
+		BoundaryMap::iterator pos;
+	};
+
+	std::vector<RuleState> m_rules;		// 슬롯 (삭제된 자리는 재사용)
+	std::vector<int> m_freeSlots;
+	QHash<quint32, int> m_idToSlot;
+	QHash<QString, SymbolIndex> m_index;
+	quint32 m_nextId = 1;
+	quint64 m_suppressed = 0;
+	std::vector<int> m_crossed;			// 틱 처리용 임시 버퍼 (재사용)
+
+	static Metric metricOf(AlertKind kind);
+	static bool isUpward(AlertKind kind);
+	static bool isCross(AlertKind kind);
+
+	void placeBoundary(int slot, SymbolIndex& index);
+	void unplaceBoundary(int slot, SymbolIndex& index);
+	void evaluateMetric(SymbolIndex& index, int metric, double value, qint64 now);
+	void fire(int slot, SymbolIndex& index, double value, qint64 now);
+};
+
+Q_DECLARE_METATYPE(AlertEvent)
@@ -0,0 +1,91 @@
+#include "AllocCounter.h"
+
+#ifdef STOCKFLOW_ALLOC_COUNTER
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+	// 상수 초기화라 스레드가 처음 쓸 때도 할당이 없음 (할당 함수 안에서 불려도 안전)
+	thread_local quint64 t_allocations = 0;
+}
+
+#if defined(__GLIBC__)
+// 실행 파일에 정의한 malloc이 공유 라이브러리(Qt, libstdc++)의 호출까지 가로챔
+// operator new도 결국 malloc을 부르므로 따로 바꾸지 않음 (두 번 세지 않게)
+extern "C"
+{
+	void* __libc_malloc(size_t size) __THROW;
+	void* __libc_calloc(size_t count, size_t size) __THROW;
+	void* __libc_realloc(void* pointer, size_t size) __THROW;
+
+	void* malloc(size_t size) __THROW
+	{
+		++t_allocations;
+		return __libc_malloc(size);
+	}
+
+	void* calloc(size_t count, size_t size) __THROW
+	{
+		++t_allocations;
+		return __libc_calloc(count, size);
+	}
+
+	void* realloc(void* pointer, size_t size) __THROW
+	{
+		++t_allocations;
+		return __libc_realloc(pointer, size);
+	}
+}
+#else
+namespace
+{
+	void* allocate(std::size_t size)
+	{
+		++t_allocations;
+		if (void* pointer = std::malloc(size ? size : 1))
+			return pointer;
+		throw std::bad_alloc();
+	}
+}
+
+// 정렬 지정 버전(align_val_t)은 기본 구현을 그대로 씀 (세지 않음)
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	++t_allocations;
+	return std::malloc(size ? size : 1);
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	++t_allocations;
+	return std::malloc(size ? size : 1);
+}
+
+void operator delete(void* pointer) noexcept { std::free(pointer); }
+void operator delete[](void* pointer) noexcept { std::free(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { std::free(pointer); }
+#endif
+#endif
+
+bool AllocCounter::isEnabled()
+{
+#ifdef STOCKFLOW_ALLOC_COUNTER
+	return true;
+#else
+	return false;
+#endif
+}
+
+quint64 AllocCounter::count()
+{
+#ifdef STOCKFLOW_ALLOC_COUNTER
+	return t_allocations;
+#else
+	return 0;
+#endif
+}
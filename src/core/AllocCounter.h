@@ -0,0 +1,30 @@
+#pragma once
+#include <QtGlobal>
+
+// 힙 할당 횟수 (디버그/벤치용)
+// STOCKFLOW_ALLOC_COUNTER로 빌드하면 할당 함수를 바꿔 끼워서 스레드별로 셈. 아니면 항상 0
+//
+//   AllocCounter::Scope scope;
+//   ... 틱 처리 ...
+//   Q_ASSERT(!AllocCounter::isEnabled() || scope.allocations() == 0);
+//
+// glibc에서는 malloc/calloc/realloc을 가로채므로 Qt 컨테이너(QString, QByteArray, QList)의 할당도 셈
+// 그 밖의 플랫폼은 operator new만 셈
+class AllocCounter
+{
+public:
+	static bool isEnabled();
+	// 이 스레드에서 지금까지 한 할당 수
+	static quint64 count();
+
+	// 만든 뒤로 이 스레드에서 한 할당 수
+	class Scope
+	{
+	public:
+		Scope() : m_start(count()) {}
+		quint64 allocations() const { return count() - m_start; }
+
+	private:
+		quint64 m_start;
+	};
+};
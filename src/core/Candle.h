@@ -0,0 +1,64 @@
+#pragma once
+#include <QtGlobal>
+#include <QString>
+
+// 봉 데이터 한 개
+struct Candle
+{
+	qint64 time = 0;	// 봉 시작 시각 (epoch ms)
+	double open = 0.0;
+	double high = 0.0;
+	double low = 0.0;
+	double close = 0.0;
+	long long volume = 0;
+};
+
+enum class CandleResolution
+{
+	Minute1,
+	Minute5,
+	Minute15,
+	Minute30,
+	Minute60,
+	Day,
+	Week,
+	Month
+};
+
+namespace CandleUtils
+{
+	// 봉 하나의 길이 (ms)
+	inline qint64 durationMs(CandleResolution resolution)
+	{
+		constexpr qint64 minute = 60 * 1000;
+		switch (resolution)
+		{
+		case CandleResolution::Minute1:  return minute;
+		case CandleResolution::Minute5:  return 5 * minute;
+		case CandleResolution::Minute15: return 15 * minute;
+		case CandleResolution::Minute30: return 30 * minute;
+		case CandleResolution::Minute60: return 60 * minute;
+		case CandleResolution::Day:      return 24 * 60 * minute;
+		case CandleResolution::Week:     return 7 * 24 * 60 * minute;
+		case CandleResolution::Month:    return 31 * 24 * 60 * minute;
+		}
+		return minute;
+	}
+
+	// 캐시 디렉터리 이름으로도 쓰임 (Finnhub 표기와 동일)
+	inline QString toString(CandleResolution resolution)
+	{
+		switch (resolution)
+		{
+		case CandleResolution::Minute1:  return "1";
+		case CandleResolution::Minute5:  return "5";
+		case CandleResolution::Minute15: return "15";
+		case CandleResolution::Minute30: return "30";
+		case CandleResolution::Minute60: return "60";
+		case CandleResolution::Day:      return "D";
+		case CandleResolution::Week:     return "W";
+		case CandleResolution::Month:    return "M";
+		}
+		return "D";
+	}
+}
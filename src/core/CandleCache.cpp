@@ -0,0 +1,256 @@
+#include "CandleCache.h"
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QDateTime>
+#include <QDebug>
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+	const char* const TimeFile = "time.bin";
+	const char* const OpenFile = "open.bin";
+	const char* const HighFile = "high.bin";
+	const char* const LowFile = "low.bin";
+	const char* const CloseFile = "close.bin";
+	const char* const VolumeFile = "volume.bin";
+	const char* const CoverageFile = "coverage.bin";
+
+	// 파일의 [first, first + count) 원소만 mmap 해서 out에 복사
+	template <typename T, typename Setter>
+	bool readColumn(const QString& path, qint64 first, qint64 count, Setter setter)
+	{
+		QFile file(path);
+		if (!file.open(QIODevice::ReadOnly)) return false;
+		if (file.size() < (first + count) * static_cast<qint64>(sizeof(T))) return false;
+		if (count == 0) return true;
+
+		uchar* mapped = file.map(first * sizeof(T), count * sizeof(T));
+		if (!mapped) return false;
+
+		for (qint64 i = 0; i < count; ++i)
+		{
+			T value;
+			std::memcpy(&value, mapped + i * sizeof(T), sizeof(T));
+			setter(i, value);
+		}
+
+		file.unmap(mapped);
+		return true;
+	}
+
+	template <typename T, typename Getter>
+	bool writeColumn(const QString& path, const QVector<Candle>& candles, Getter getter)
+	{
+		QSaveFile file(path);
+		if (!file.open(QIODevice::WriteOnly)) return false;
+
+		QByteArray bytes(candles.size() * static_cast<qsizetype>(sizeof(T)), Qt::Uninitialized);
+		for (qsizetype i = 0; i < candles.size(); ++i)
+		{
+			T value = getter(candles[i]);
+			std::memcpy(bytes.data() + i * sizeof(T), &value, sizeof(T));
+		}
+
+		file.write(bytes);
+		return file.commit();
+	}
+
+	// 겹치거나 붙어있는 구간 합치기
+	QVector<CandleCache::Range> normalize(QVector<CandleCache::Range> ranges)
+	{
+		std::sort(ranges.begin(), ranges.end());
+
+		QVector<CandleCache::Range> merged;
+		for (const CandleCache::Range& r : ranges)
+		{
+			if (!merged.isEmpty() && r.first <= merged.last().second + 1)
+				merged.last().second = qMax(merged.last().second, r.second);
+			else
+				merged.append(r);
+		}
+		return merged;
+	}
+}
+
+CandleCache::CandleCache(const QString& rootDir) : m_rootDir(rootDir)
+{
+	if (m_rootDir.isEmpty())
+		m_rootDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/candles";
+}
+
+QString CandleCache::seriesDir(const QString& symbol, CandleResolution resolution) const
+{
+	return QString("%1/%2/%3").arg(m_rootDir, symbol.toUpper(), CandleUtils::toString(resolution));
+}
+
+QVector<Candle> CandleCache::read(const QString& symbol, CandleResolution resolution, qint64 from, qint64 to) const
+{
+	QVector<Candle> result;
+	const QString dir = seriesDir(symbol, resolution);
+
+	// 시간 컬럼 전체를 매핑해서 이진 탐색으로 구간 찾기
+	QFile timeFile(dir + "/" + TimeFile);
+	if (!timeFile.open(QIODevice::ReadOnly) || timeFile.size() == 0) return result;
+
+	const qint64 total = timeFile.size() / static_cast<qint64>(sizeof(qint64));
+	uchar* mapped = timeFile.map(0, total * sizeof(qint64));
+	if (!mapped) return result;
+
+	auto timeAt = [mapped](qint64 i)
+	{
+		qint64 t;
+		std::memcpy(&t, mapped + i * sizeof(qint64), sizeof(qint64));
+		return t;
+	};
+
+	qint64 lo = 0, hi = total;
+	while (lo < hi)
+	{
+		qint64 mid = (lo + hi) / 2;
+		if (timeAt(mid) < from) lo = mid + 1; else hi = mid;
+	}
+	const qint64 first = lo;
+
+	hi = total;
+	while (lo < hi)
+	{
+		qint64 mid = (lo + hi) / 2;
+		if (timeAt(mid) <= to) lo = mid + 1; else hi = mid;
+	}
+	const qint64 count = lo - first;
+
+	result.resize(count);
+	for (qint64 i = 0; i < count; ++i)
+		result[i].time = timeAt(first + i);
+	timeFile.unmap(mapped);
+
+	// 나머지 컬럼은 필요한 구간만
+	bool ok = readColumn<double>(dir + "/" + OpenFile, first, count, [&](qint64 i, double v) { result[i].open = v; })
+		&& readColumn<double>(dir + "/" + HighFile, first, count, [&](qint64 i, double v) { result[i].high = v; })
+		&& readColumn<double>(dir + "/" + LowFile, first, count, [&](qint64 i, double v) { result[i].low = v; })
+		&& readColumn<double>(dir + "/" + CloseFile, first, count, [&](qint64 i, double v) { result[i].close = v; })
+		&& readColumn<qint64>(dir + "/" + VolumeFile, first, count, [&](qint64 i, qint64 v) { result[i].volume = v; });
+
+	if (!ok)
+	{
+		qDebug() << "[CandleCache] 캐시 파일 손상:" << dir;
+		result.clear();
+	}
+	return result;
+}
+
+QVector<CandleCache::Range> CandleCache::loadCoverage(const QString& dir) const
+{
+	QVector<Range> coverage;
+	QFile file(dir + "/" + CoverageFile);
+	if (!file.open(QIODevice::ReadOnly)) return coverage;
+
+	QByteArray bytes = file.readAll();
+	const qsizetype pairSize = 2 * sizeof(qint64);
+	for (qsizetype offset = 0; offset + pairSize <= bytes.size(); offset += pairSize)
+	{
+		qint64 from, to;
+		std::memcpy(&from, bytes.constData() + offset, sizeof(qint64));
+		std::memcpy(&to, bytes.constData() + offset + sizeof(qint64), sizeof(qint64));
+		coverage.append({ from, to });
+	}
+	return coverage;
+}
+
+QVector<CandleCache::Range> CandleCache::missingRanges(const QString& symbol, CandleResolution resolution, qint64 from, qint64 to) const
+{
+	QVector<Range> missing;
+	qint64 cursor = from;
+
+	for (const Range& covered : loadCoverage(seriesDir(symbol, resolution)))
+	{
+		if (covered.second < cursor) continue;
+		if (covered.first > to) break;
+
+		if (covered.first > cursor)
+			missing.append({ cursor, covered.first - 1 });
+		cursor = qMax(cursor, covered.second + 1);
+		if (cursor > to) break;
+	}
+
+	if (cursor <= to)
+		missing.append({ cursor, to });
+	return missing;
+}
+
+QVector<Candle> CandleCache::readAll(const QString& dir) const
+{
+	QFile timeFile(dir + "/" + TimeFile);
+	if (!timeFile.exists()) return {};
+
+	const qint64 count = timeFile.size() / static_cast<qint64>(sizeof(qint64));
+	QVector<Candle> all(count);
+	bool ok = readColumn<qint64>(dir + "/" + TimeFile, 0, count, [&](qint64 i, qint64 v) { all[i].time = v; })
+		&& readColumn<double>(dir + "/" + OpenFile, 0, count, [&](qint64 i, double v) { all[i].open = v; })
+		&& readColumn<double>(dir + "/" + HighFile, 0, count, [&](qint64 i, double v) { all[i].high = v; })
+		&& readColumn<double>(dir + "/" + LowFile, 0, count, [&](qint64 i, double v) { all[i].low = v; })
+		&& readColumn<double>(dir + "/" + CloseFile, 0, count, [&](qint64 i, double v) { all[i].close = v; })
+		&& readColumn<qint64>(dir + "/" + VolumeFile, 0, count, [&](qint64 i, qint64 v) { all[i].volume = v; });
+
+	return ok ? all : QVector<Candle>();
+}
+
+bool CandleCache::writeAll(const QString& dir, const QVector<Candle>& candles, const QVector<Range>& coverage) const
+{
+	if (!QDir().mkpath(dir)) return false;
+
+	bool ok = writeColumn<qint64>(dir + "/" + TimeFile, candles, [](const Candle& c) { return c.time; })
+		&& writeColumn<double>(dir + "/" + OpenFile, candles, [](const Candle& c) { return c.open; })
+		&& writeColumn<double>(dir + "/" + HighFile, candles, [](const Candle& c) { return c.high; })
+		&& writeColumn<double>(dir + "/" + LowFile, candles, [](const Candle& c) { return c.low; })
+		&& writeColumn<double>(dir + "/" + CloseFile, candles, [](const Candle& c) { return c.close; })
+		&& writeColumn<qint64>(dir + "/" + VolumeFile, candles, [](const Candle& c) { return static_cast<qint64>(c.volume); });
+	if (!ok) return false;
+
+	// 컬럼을 다 쓴 다음에 구간을 기록해야 중간에 죽어도 "받았는데 데이터 없음"이 안 생김
+	QSaveFile file(dir + "/" + CoverageFile);
+	if (!file.open(QIODevice::WriteOnly)) return false;
+	for (const Range& r : coverage)
+	{
+		file.write(reinterpret_cast<const char*>(&r.first), sizeof(qint64));
+		file.write(reinterpret_cast<const char*>(&r.second), sizeof(qint64));
+	}
+	return file.commit();
+}
+
+void CandleCache::merge(const QString& symbol, CandleResolution resolution, qint64 from, qint64 to, const QVector<Candle>& candles)
+{
+	const QString dir = seriesDir(symbol, resolution);
+
+	// 기존 봉 + 새 봉 (같은 시각이면 새 봉이 이김)
+	QVector<Candle> merged = readAll(dir);
+	for (const Candle& c : candles)
+	{
+		if (c.time < from || c.time > to) continue;
+		merged.append(c);
+	}
+	std::stable_sort(merged.begin(), merged.end(),
+		[](const Candle& a, const Candle& b) { return a.time < b.time; });
+
+	QVector<Candle> unique;
+	unique.reserve(merged.size());
+	for (const Candle& c : merged)
+	{
+		if (!unique.isEmpty() && unique.last().time == c.time)
+			unique.last() = c;
+		else
+			unique.append(c);
+	}
+
+	// 아직 끝나지 않은 마지막 봉은 다음에 다시 받아야 하므로 받아온 구간에서 제외
+	const qint64 settled = QDateTime::currentMSecsSinceEpoch() - CandleUtils::durationMs(resolution);
+	QVector<Range> coverage = loadCoverage(dir);
+	if (qMin(to, settled) >= from)
+		coverage.append({ from, qMin(to, settled) });
+
+	if (!writeAll(dir, unique, normalize(coverage)))
+		qDebug() << "[CandleCache] 캐시 저장 실패:" << dir;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <QString>
+#include <QVector>
+#include <QPair>
+#include "Candle.h"
+
+// 종목/해상도별 봉 데이터 로컬 캐시
+//
+// 디렉터리 구조: <root>/<symbol>/<resolution>/
+//   time.bin, open.bin, high.bin, low.bin, close.bin, volume.bin
+//     - 컬럼별 고정 폭 배열 (time/volume: qint64, 가격: double), 시간 오름차순
+//     - 파일 그대로 mmap 해서 필요한 구간만 읽을 수 있음
+//   coverage.bin
+//     - 이미 받아온 구간 목록 [from, to] (qint64 쌍)
+//     - 휴장일처럼 봉이 없는 구간도 "받아봤음"으로 기록해서 다시 요청하지 않음
+class CandleCache
+{
+public:
+	using Range = QPair<qint64, qint64>;	// [from, to] epoch ms
+
+	explicit CandleCache(const QString& rootDir = QString());
+
+	QString rootDir() const { return m_rootDir; }
+
+	// [from, to] 구간의 봉 (mmap 범위 읽기)
+	QVector<Candle> read(const QString& symbol, CandleResolution resolution, qint64 from, qint64 to) const;
+
+	// [from, to] 중 아직 받아오지 않은 구간들
+	QVector<Range> missingRanges(const QString& symbol, CandleResolution resolution, qint64 from, qint64 to) const;
+
+	// 새로 받은 봉을 기존 데이터와 합치고 [from, to]를 받아온 구간으로 기록
+	void merge(const QString& symbol, CandleResolution resolution, qint64 from, qint64 to, const QVector<Candle>& candles);
+
+private:
+	QString m_rootDir;
+
+	QString seriesDir(const QString& symbol, CandleResolution resolution) const;
+	QVector<Range> loadCoverage(const QString& dir) const;
+	QVector<Candle> readAll(const QString& dir) const;
+	bool writeAll(const QString& dir, const QVector<Candle>& candles, const QVector<Range>& coverage) const;
+};
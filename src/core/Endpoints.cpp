@@ -0,0 +1,79 @@
+#include "Endpoints.h"
+#include "Config.h"
+#include <QSettings>
+#include <QDebug>
+
+QString Endpoints::m_finnhubBaseUrl;
+QString Endpoints::m_kisBaseUrl;
+QString Endpoints::m_kisWebSocketUrl;
+
+namespace
+{
+    QString pickOverride(const char* envName, const QSettings& settings, const char* key)
+    {
+        QString value = qEnvironmentVariable(envName);
+        if (value.isEmpty())
+            value = settings.value(key).toString();
+
+        // 끝의 '/'는 경로를 붙일 때 중복되므로 제거
+        while (value.endsWith('/'))
+            value.chop(1);
+        return value;
+    }
+}
+
+void Endpoints::loadOverrides()
+{
+    QSettings settings(Config::SETTINGS_COMPANY, Config::SETTINGS_APP);
+
+    QString finnhub = pickOverride("STOCKFLOW_FINNHUB_BASE_URL", settings, "endpoints/finnhub");
+    if (!finnhub.isEmpty()) setFinnhubBaseUrl(finnhub);
+
+    QString kis = pickOverride("STOCKFLOW_KIS_BASE_URL", settings, "endpoints/kis");
+    if (!kis.isEmpty()) setKisBaseUrl(kis);
+
+    QString kisWs = pickOverride("STOCKFLOW_KIS_WS_URL", settings, "endpoints/kis_ws");
+    if (!kisWs.isEmpty()) setKisWebSocketUrl(kisWs);
+}
+
+QString Endpoints::finnhubBaseUrl()
+{
+    return m_finnhubBaseUrl.isEmpty() ? Config::FINNHUB_BASE_URL : m_finnhubBaseUrl;
+}
+
+QString Endpoints::kisBaseUrl()
+{
+    return m_kisBaseUrl.isEmpty() ? Config::KIS_BASE_URL : m_kisBaseUrl;
+}
+
+QString Endpoints::kisWebSocketUrl()
+{
+    if (!m_kisWebSocketUrl.isEmpty())
+        return m_kisWebSocketUrl;
+
+    // REST 서버에 맞는 실시간 서버 (모의 31000, 실전 21000). 대역 서버 등은 실시간 없음
+    const QString rest = kisBaseUrl();
+    if (rest.contains("openapivts.koreainvestment.com"))
+        return "ws://ops.koreainvestment.com:31000";
+    if (rest.contains("openapi.koreainvestment.com"))
+        return "ws://ops.koreainvestment.com:21000";
+    return QString();
+}
+
+void Endpoints::setFinnhubBaseUrl(const QString& url)
+{
+    m_finnhubBaseUrl = url;
+    qDebug() << "Finnhub 서버 주소 변경:" << url;
+}
+
+void Endpoints::setKisBaseUrl(const QString& url)
+{
+    m_kisBaseUrl = url;
+    qDebug() << "KIS 서버 주소 변경:" << url;
+}
+
+void Endpoints::setKisWebSocketUrl(const QString& url)
+{
+    m_kisWebSocketUrl = url;
+    qDebug() << "KIS 실시간 서버 주소 변경:" << url;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <QString>
+
+// 서버 주소 (Config.h 기본값을 실행 중에 바꿀 수 있게)
+//
+// 우선순위: setXxx() (명령행) > 환경 변수 > QSettings > Config.h
+//   환경 변수: STOCKFLOW_FINNHUB_BASE_URL, STOCKFLOW_KIS_BASE_URL, STOCKFLOW_KIS_WS_URL
+//   QSettings: endpoints/finnhub, endpoints/kis, endpoints/kis_ws
+class Endpoints
+{
+public:
+    // 환경 변수와 설정 파일에서 덮어쓸 주소를 읽음 (앱 시작 시 한 번)
+    static void loadOverrides();
+
+    static QString finnhubBaseUrl();
+    static QString kisBaseUrl();
+    // 한투 실시간(웹소켓) 주소. 실전/모의 서버가 아니고 따로 지정도 안 했으면 빈 값 (실시간 안 씀)
+    static QString kisWebSocketUrl();
+
+    static void setFinnhubBaseUrl(const QString& url);
+    static void setKisBaseUrl(const QString& url);
+    static void setKisWebSocketUrl(const QString& url);
+
+private:
+    static QString m_finnhubBaseUrl;
+    static QString m_kisBaseUrl;
+    static QString m_kisWebSocketUrl;
+};
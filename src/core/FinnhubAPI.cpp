@@ -1,12 +1,16 @@
 #include "FinnhubAPI.h"
 #include "Config.h"
+#include "Endpoints.h"
 #include "NetworkUtils.h"
+#include "LatencyTracer.h"
+#include "QuoteParser.h"
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QUrlQuery>
 #include <QDebug>
 #include "StockCodeMap.h"
 #include <QJsonArray>
+#include <QDateTime>
 
 FinnhubAPI::FinnhubAPI(QObject* parent) : StockAPI(parent)
 {
@@ -14,21 +18,27 @@ FinnhubAPI::FinnhubAPI(QObject* parent) : StockAPI(parent)
 
 void FinnhubAPI::fetchStock(const QString& symbol)
 {
-	// URL
-	QUrl url(Config::FINNHUB_BASE_URL + "/quote");
+	// 요청 객체는 종목마다 한 번만 만들고 재사용
+	QuoteTarget& target = quoteTarget(symbol);
+	if (target.request.url().isEmpty())
+	{
+		QUrl url(Endpoints::finnhubBaseUrl() + "/quote");
 
-	QUrlQuery query;
-	query.addQueryItem("symbol", symbol);
-	query.addQueryItem("token", Config::FINNHUB_API_KEY);
-	url.setQuery(query);
+		QUrlQuery query;
+		query.addQueryItem("symbol", symbol);
+		query.addQueryItem("token", Config::FINNHUB_API_KEY);
+		url.setQuery(query);
+		target.request = QNetworkRequest(url);
+	}
 
 	// 요청
-	QNetworkRequest request(url);
-	QNetworkReply* reply = manager->get(request);
+	QNetworkReply* reply = manager->get(target.request);
 
-	// 심볼 기억하기 (꼬리표)
-	reply->setProperty("TargetSymbol", symbol);
+	// 심볼 기억하기 (꼬리표, 공유 문자열)
+	reply->setProperty("TargetSymbol", target.symbol);
 
+	// 화면에 그려질 때까지 추적
+	LatencyTracer::traceReply(reply, "finnhub", "/quote", symbol, true);
 	NetworkUtils::addTimeOut(reply);
 
 	// 응답
@@ -45,7 +55,7 @@ void FinnhubAPI::fetchStock(const QString& symbol)
 void FinnhubAPI::fetchLogo(const QString& symbol)
 {
 	// 기업 정보(Profile2) API 호출
-	QUrl url(Config::FINNHUB_BASE_URL + "/stock/profile2");
+	QUrl url(Endpoints::finnhubBaseUrl() + "/stock/profile2");
 	QUrlQuery query;
 	query.addQueryItem("symbol", symbol);
 	query.addQueryItem("token", Config::FINNHUB_API_KEY);
@@ -57,6 +67,7 @@ void FinnhubAPI::fetchLogo(const QString& symbol)
 	// 심볼 기억하기 (꼬리표)
 	reply->setProperty("TargetSymbol", symbol);
 
+	LatencyTracer::traceReply(reply, "finnhub", "/stock/profile2", symbol);
 	NetworkUtils::addTimeOut(reply);
 
 	connect(
@@ -69,7 +80,7 @@ void FinnhubAPI::fetchLogo(const QString& symbol)
 
 void FinnhubAPI::fetchAllUSSymblos()
 {
-	QUrl url(Config::FINNHUB_BASE_URL + "/stock/symbol");
+	QUrl url(Endpoints::finnhubBaseUrl() + "/stock/symbol");
 	QUrlQuery query;
 	query.addQueryItem("exchange", "US");
 	query.addQueryItem("token", Config::FINNHUB_API_KEY);
@@ -78,6 +89,7 @@ void FinnhubAPI::fetchAllUSSymblos()
 	QNetworkRequest request(url);
 	QNetworkReply* reply = manager->get(request);
 
+	LatencyTracer::traceReply(reply, "finnhub", "/stock/symbol");
 	NetworkUtils::addTimeOut(reply);
 
 	connect(
@@ -88,6 +100,67 @@ void FinnhubAPI::fetchAllUSSymblos()
 	);
 }
 
+void FinnhubAPI::fetchFxRate(const QString& base, const QString& quote)
+{
+	QUrl url(Endpoints::finnhubBaseUrl() + "/forex/rates");
+	QUrlQuery query;
+	query.addQueryItem("base", base);
+	query.addQueryItem("token", Config::FINNHUB_API_KEY);
+	url.setQuery(query);
+
+	QNetworkRequest request(url);
+	QNetworkReply* reply = manager->get(request);
+
+	reply->setProperty("FxBase", base);
+	reply->setProperty("FxQuote", quote);
+
+	LatencyTracer::traceReply(reply, "finnhub", "/forex/rates");
+	NetworkUtils::addTimeOut(reply);
+
+	connect(
+		reply,
+		&QNetworkReply::finished,
+		[this, reply]()
+		{ this->onFxRatesReceived(reply); }
+	);
+}
+
+void FinnhubAPI::requestCandles(int requestId, const QString& symbol, CandleResolution resolution, qint64 from, qint64 to)
+{
+	// Finnhub는 초 단위 unix time
+	QUrl url(Endpoints::finnhubBaseUrl() + "/stock/candle");
+	QUrlQuery query;
+	query.addQueryItem("symbol", symbol);
+	query.addQueryItem("resolution", CandleUtils::toString(resolution));
+	query.addQueryItem("from", QString::number(from / 1000));
+	query.addQueryItem("to", QString::number(to / 1000));
+	query.addQueryItem("token", Config::FINNHUB_API_KEY);
+	url.setQuery(query);
+
+	QNetworkRequest request(url);
+	QNetworkReply* reply = manager->get(request);
+
+	reply->setProperty("RequestId", requestId);
+	reply->setProperty("RangeFrom", from);
+	reply->setProperty("RangeTo", to);
+
+	LatencyTracer::traceReply(reply, "finnhub", "/stock/candle", symbol);
+	NetworkUtils::addTimeOut(reply, 10000);
+
+	connect(
+		reply,
+		&QNetworkReply::finished,
+		[this, reply]()
+		{ this->onCandlesReceived(reply); }
+	);
+}
+
+bool FinnhubAPI::parseQuote(QByteArrayView json, StockData& data)
+{
+	// DOM 없이 스키마에 있는 키(c, h, l, o, pc)만 바로 채움
+	return QuoteParser::parse(json, QuoteSchema::Finnhub, data);
+}
+
 void FinnhubAPI::onStockReceived(QNetworkReply* reply)
 {
 	// 메모리 해제 예약
@@ -100,28 +173,18 @@ void FinnhubAPI::onStockReceived(QNetworkReply* reply)
 		return;
 	}
 
-	// JSON 파싱
-	QByteArray responseData = reply->readAll();
-	QJsonDocument jsonDoc = QJsonDocument::fromJson(responseData);
-	QJsonObject jsonObj = jsonDoc.object();
-
-	if (!jsonObj.contains("c"))
+	// 데이터를 구조체에 담기
+	StockData data;
+	if (!parseQuote(readReply(reply), data))
 	{
 		qDebug() << "Invalid Data format";
 		return;
 	}
 
-	// 데이터를 구조체에 담기
-	StockData data;
-
-	data.symbol = reply->property("TargetSymbol").toString();
-	data.currentPrice = jsonObj["c"].toDouble();
-	data.highPrice = jsonObj["h"].toDouble();
-	data.lowPrice = jsonObj["l"].toDouble();
-	data.openPrice = jsonObj["o"].toDouble();
-	data.prevClose = jsonObj["pc"].toDouble();
-
-	data.name = StockCodeMap::getName(data.symbol);
+	stampIdentity(data, reply->property("TargetSymbol").toString());
+	data.timestamp = QDateTime::currentMSecsSinceEpoch();
+	data.traceId = LatencyTracer::traceId(reply);
+	LatencyTracer::mark(data.traceId, TraceStage::Parsed);
 
 	//qDebug() << "Data Received! Price:" << data.currentPrice;
 
@@ -195,3 +258,83 @@ void FinnhubAPI::onAllSymbolsReceived(QNetworkReply* reply)
 	}
 	emit symbolsReceived();
 }
+
+void FinnhubAPI::onCandlesReceived(QNetworkReply* reply)
+{
+	reply->deleteLater();
+
+	int requestId = reply->property("RequestId").toInt();
+	qint64 from = reply->property("RangeFrom").toLongLong();
+	qint64 to = reply->property("RangeTo").toLongLong();
+
+	if (reply->error() != QNetworkReply::NoError)
+	{
+		qDebug() << "Candle Error:" << reply->errorString();
+		finishCandleRequest(requestId, from, to, {}, false);
+		return;
+	}
+
+	QJsonObject obj = QJsonDocument::fromJson(reply->readAll()).object();
+	QString status = obj["s"].toString();
+
+	// "no_data"는 정상 응답 (휴장 구간) -> 빈 구간으로 기록
+	if (status == "no_data")
+	{
+		finishCandleRequest(requestId, from, to, {}, true);
+		return;
+	}
+	if (status != "ok")
+	{
+		qDebug() << "Invalid Candle format";
+		finishCandleRequest(requestId, from, to, {}, false);
+		return;
+	}
+
+	// 컬럼별 배열로 옴: t, o, h, l, c, v
+	QJsonArray t = obj["t"].toArray();
+	QJsonArray o = obj["o"].toArray();
+	QJsonArray h = obj["h"].toArray();
+	QJsonArray l = obj["l"].toArray();
+	QJsonArray c = obj["c"].toArray();
+	QJsonArray v = obj["v"].toArray();
+
+	QVector<Candle> candles;
+	candles.reserve(t.size());
+	for (qsizetype i = 0; i < t.size(); ++i)
+	{
+		Candle candle;
+		candle.time = static_cast<qint64>(t[i].toDouble()) * 1000;
+		candle.open = o[i].toDouble();
+		candle.high = h[i].toDouble();
+		candle.low = l[i].toDouble();
+		candle.close = c[i].toDouble();
+		candle.volume = static_cast<long long>(v[i].toDouble());
+		candles.append(candle);
+	}
+
+	finishCandleRequest(requestId, from, to, candles, true);
+}
+
+void FinnhubAPI::onFxRatesReceived(QNetworkReply* reply)
+{
+	reply->deleteLater();
+
+	if (reply->error() != QNetworkReply::NoError)
+	{
+		qDebug() << "FX Error:" << reply->errorString();
+		return;
+	}
+
+	// {"base":"USD","quote":{"KRW":1350.2, ...}}
+	QString base = reply->property("FxBase").toString();
+	QString quote = reply->property("FxQuote").toString();
+	QJsonObject obj = QJsonDocument::fromJson(reply->readAll()).object();
+	double rate = obj["quote"].toObject()[quote].toDouble();
+	if (rate <= 0)
+	{
+		qDebug() << "Invalid FX format";
+		return;
+	}
+
+	emit fxRateReceived(base, quote, rate);
+}
@@ -10,13 +10,23 @@ public:
     void fetchStock(const QString& symbol) override;
     void fetchLogo(const QString& symbol) override;
     void fetchAllUSSymblos();
+    void fetchFxRate(const QString& base, const QString& quote);   // 예: USD -> KRW
+
+    // /quote 응답 본문 -> StockData 가격 필드 (심볼/이름/시각은 호출한 쪽에서)
+    static bool parseQuote(QByteArrayView json, StockData& data);
 
 signals:
     void symbolsReceived();
+    void fxRateReceived(const QString& base, const QString& quote, double rate);
+
+protected:
+    void requestCandles(int requestId, const QString& symbol, CandleResolution resolution, qint64 from, qint64 to) override;
 
 private slots:
     // 네트워크 응답이 오면 처리
     void onStockReceived(QNetworkReply* reply);
     void onProfileLoaded(QNetworkReply* reply);
     void onAllSymbolsReceived(QNetworkReply* reply);
+    void onCandlesReceived(QNetworkReply* reply);
+    void onFxRatesReceived(QNetworkReply* reply);
 };
\ No newline at end of file
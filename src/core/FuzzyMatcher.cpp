@@ -0,0 +1,77 @@
+#include "FuzzyMatcher.h"
+#include <algorithm>
+
+FuzzyMatcher::FuzzyMatcher(QStringView pattern)
+{
+	if (pattern.isEmpty() || pattern.size() > MaxLength) return;
+
+	m_length = static_cast<int>(pattern.size());
+	m_last = quint64(1) << (m_length - 1);
+	for (int i = 0; i < m_length; ++i)
+	{
+		const char16_t c = pattern[i].unicode();
+		const quint64 bit = quint64(1) << i;
+		if (c < 128)
+		{
+			m_ascii[c] |= bit;
+			continue;
+		}
+
+		auto it = std::find_if(m_other.begin(), m_other.end(), [c](const auto& entry) { return entry.first == c; });
+		if (it != m_other.end())
+			it->second |= bit;
+		else
+			m_other.emplace_back(c, bit);
+	}
+}
+
+int FuzzyMatcher::distance(const char16_t* text, qsizetype length, int maxDistance) const
+{
+	return run(length, maxDistance, [this, text](qsizetype j) { return mask(text[j]); });
+}
+
+int FuzzyMatcher::distance(const char16_t* text, const char16_t* alternate, qsizetype length, int maxDistance) const
+{
+	return run(length, maxDistance, [this, text, alternate](qsizetype j)
+	{
+		return text[j] == alternate[j] ? mask(text[j]) : (mask(text[j]) | mask(alternate[j]));
+	});
+}
+
+template <typename MaskAt>
+int FuzzyMatcher::run(qsizetype length, int maxDistance, MaskAt maskAt) const
+{
+	if (!isValid()) return maxDistance + 1;
+
+	// 세로 방향 차이(+1/-1) 비트 벡터. 처음엔 D[i][0] = i (모두 +1)
+	quint64 pv = ~quint64(0);
+	quint64 mv = 0;
+	int score = m_length;
+	int best = score;
+
+	for (qsizetype j = 0; j < length; ++j)
+	{
+		const quint64 eq = maskAt(j);
+		const quint64 xv = eq | mv;
+		const quint64 xh = (((eq & pv) + pv) ^ pv) | eq;
+		quint64 ph = mv | ~(xh | pv);
+		quint64 mh = pv & xh;
+
+		if (ph & m_last) ++score;
+		else if (mh & m_last) --score;
+
+		// 부분 문자열 검색: 맨 윗줄 D[0][j] = 0 이라 올려 보내는 값이 없음
+		ph <<= 1;
+		mh <<= 1;
+		pv = mh | ~(xv | ph);
+		mv = ph & xv;
+
+		if (score < best)
+		{
+			best = score;
+			if (best == 0) break;
+		}
+	}
+
+	return best <= maxDistance ? best : maxDistance + 1;
+}
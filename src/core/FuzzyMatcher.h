@@ -0,0 +1,43 @@
+#pragma once
+#include <QStringView>
+#include <array>
+#include <vector>
+
+// 오타 허용 검색용 근사 문자열 매칭 (Myers 1999 비트 병렬 알고리즘)
+// 패턴(검색어)이 글자 하나당 1비트라 64글자까지 64비트 워드 하나로 처리
+// distance()는 text의 어느 부분 문자열과 비교했을 때의 최소 편집 거리 (삽입/삭제/치환 각 1)
+// 글자 단위는 UTF-16 (한글 음절 하나 = 1글자, 대소문자는 호출한 쪽에서 미리 맞춤)
+class FuzzyMatcher
+{
+public:
+	static constexpr int MaxLength = 64;
+
+	explicit FuzzyMatcher(QStringView pattern);
+
+	bool isValid() const { return m_length > 0; }
+	int length() const { return m_length; }
+
+	// maxDistance를 넘으면 maxDistance + 1
+	int distance(const char16_t* text, qsizetype length, int maxDistance) const;
+	// 위치마다 text[j], alternate[j] 둘 중 하나만 맞으면 같은 글자로 봄 (초성 검색)
+	int distance(const char16_t* text, const char16_t* alternate, qsizetype length, int maxDistance) const;
+
+private:
+	int m_length = 0;
+	quint64 m_last = 0;							// 패턴 마지막 글자 비트
+	std::array<quint64, 128> m_ascii{};			// 글자 -> 패턴에서 나오는 위치 비트
+	std::vector<std::pair<char16_t, quint64>> m_other;	// ASCII 밖 글자 (검색어라 몇 개 안 됨)
+
+	template <typename MaskAt>
+	int run(qsizetype length, int maxDistance, MaskAt maskAt) const;
+
+	quint64 mask(char16_t c) const
+	{
+		if (c < 128) return m_ascii[c];
+		for (const auto& [ch, bits] : m_other)
+		{
+			if (ch == c) return bits;
+		}
+		return 0;
+	}
+};
@@ -0,0 +1,149 @@
+#include "IndicatorStore.h"
+#include <QDateTime>
+#include <limits>
+
+IndicatorStore::IndicatorStore(CandleResolution resolution, QObject* parent)
+	: QObject(parent), m_resolution(resolution), m_barMs(CandleUtils::durationMs(resolution))
+{
+}
+
+void IndicatorStore::setSpecs(const QVector<IndicatorSpec>& specs)
+{
+	if (specs == m_specs) return;
+
+	m_specs = specs;
+	for (SymbolState& state : m_symbols)
+		rebuild(state);
+	emit specsChanged();
+}
+
+double IndicatorStore::value(const QString& symbol, int specIndex) const
+{
+	auto it = m_symbols.constFind(symbol);
+	if (it == m_symbols.cend() || specIndex < 0 || specIndex >= static_cast<int>(it->values.size()))
+		return std::numeric_limits<double>::quiet_NaN();
+	return it->values[specIndex];
+}
+
+bool IndicatorStore::needsBackfill(const QString& symbol) const
+{
+	if (m_specs.isEmpty()) return false;
+
+	auto it = m_symbols.constFind(symbol);
+	return it == m_symbols.cend() || !it->backfillRequested;
+}
+
+void IndicatorStore::markBackfillRequested(const QString& symbol)
+{
+	SymbolState& state = m_symbols[symbol];
+	if (state.states.size() != static_cast<size_t>(m_specs.size()))
+		rebuild(state);
+	state.backfillRequested = true;
+}
+
+void IndicatorStore::onTick(const StockData& data)
+{
+	if (data.currentPrice <= 0 || data.timestamp <= 0) return;
+
+	SymbolState& state = m_symbols[data.symbol];
+	if (state.states.size() != static_cast<size_t>(m_specs.size()))
+		rebuild(state);
+
+	// 다음 봉으로 넘어갔으면 지금 봉 확정
+	if (state.hasCurrent && data.timestamp >= state.current.time + m_barMs)
+		commitCurrent(state);
+
+	if (!state.hasCurrent)
+	{
+		// 직전 확정 봉 기준으로 봉 시작 시각을 맞춤 (없으면 UTC 기준으로 자름)
+		const qint64 anchor = state.closed.isEmpty() ? 0 : state.closed.last().time;
+		state.current = Candle();
+		state.current.time = data.timestamp - ((data.timestamp - anchor) % m_barMs + m_barMs) % m_barMs;
+		state.hasCurrent = true;
+	}
+
+	// 시세의 시/고/저/누적거래량이 곧 당일 봉
+	Candle& bar = state.current;
+	bar.close = data.currentPrice;
+	bar.open = data.openPrice > 0 ? data.openPrice : (bar.open > 0 ? bar.open : data.currentPrice);
+	bar.high = data.highPrice > 0 ? data.highPrice : qMax(bar.high, data.currentPrice);
+	bar.low = data.lowPrice > 0 ? data.lowPrice : (bar.low > 0 ? qMin(bar.low, data.currentPrice) : data.currentPrice);
+	bar.volume = data.volume;
+
+	updateValues(state);
+}
+
+void IndicatorStore::backfill(const QString& symbol, const QVector<Candle>& candles)
+{
+	SymbolState& state = m_symbols[symbol];
+	state.backfillRequested = true;
+
+	// 마지막 봉이 아직 안 끝났으면 (오늘 봉) 틱이 이어서 고쳐 쓰도록 현재 봉으로
+	const qint64 now = QDateTime::currentMSecsSinceEpoch();
+	qsizetype closedCount = candles.size();
+	if (closedCount > 0 && now < candles.last().time + m_barMs)
+	{
+		--closedCount;
+		if (!state.hasCurrent || state.current.time < candles.last().time)
+		{
+			state.current = candles.last();
+			state.hasCurrent = true;
+		}
+	}
+
+	// 이미 틱으로 만들던 봉보다 앞선 봉만 확정 봉으로 씀
+	const qint64 limit = state.hasCurrent ? state.current.time : std::numeric_limits<qint64>::max();
+	state.closed.clear();
+	const qsizetype first = qMax<qsizetype>(0, closedCount - MaxClosedBars);
+	for (qsizetype i = first; i < closedCount; ++i)
+	{
+		if (candles[i].time >= limit) break;
+		state.closed.append(candles[i]);
+	}
+
+	rebuild(state);
+	emit valuesChanged(symbol);
+}
+
+void IndicatorStore::remove(const QString& symbol)
+{
+	m_symbols.remove(symbol);
+}
+
+void IndicatorStore::clear()
+{
+	m_symbols.clear();
+}
+
+void IndicatorStore::commitCurrent(SymbolState& state) const
+{
+	for (IndicatorState& indicator : state.states)
+		indicator.push(state.current);
+
+	state.closed.append(state.current);
+	if (state.closed.size() > MaxClosedBars)
+		state.closed.remove(0, state.closed.size() - MaxClosedBars);
+
+	state.hasCurrent = false;
+}
+
+void IndicatorStore::rebuild(SymbolState& state) const
+{
+	state.states.clear();
+	state.states.reserve(m_specs.size());
+	for (const IndicatorSpec& spec : m_specs)
+	{
+		state.states.emplace_back(spec);
+		state.states.back().seed(state.closed);
+	}
+	updateValues(state);
+}
+
+void IndicatorStore::updateValues(SymbolState& state) const
+{
+	state.values.assign(state.states.size(), std::numeric_limits<double>::quiet_NaN());
+	if (!state.hasCurrent) return;
+
+	for (size_t i = 0; i < state.states.size(); ++i)
+		state.values[i] = state.states[i].valueWith(state.current);
+}
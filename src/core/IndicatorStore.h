@@ -0,0 +1,65 @@
+#pragma once
+
+#include <QObject>
+#include <QHash>
+#include <QVector>
+#include <vector>
+#include "Indicators.h"
+#include "StockData.h"
+
+// 종목별 지표 상태 저장소 (시세 테이블 옆에서 dataReceived를 받아 갱신)
+// 틱은 "지금 만들어지는 봉"(기본 일봉)을 고쳐 쓰고, 봉이 넘어가면 확정해서 누적 상태에 넣음
+// 틱 하나당 O(지표 수)
+class IndicatorStore : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit IndicatorStore(CandleResolution resolution = CandleResolution::Day, QObject* parent = nullptr);
+
+	CandleResolution resolution() const { return m_resolution; }
+
+	// 열 구성. 바뀌면 저장해둔 확정 봉으로 모든 종목 상태를 다시 만듦
+	void setSpecs(const QVector<IndicatorSpec>& specs);
+	const QVector<IndicatorSpec>& specs() const { return m_specs; }
+
+	// 준비가 안 됐으면 NaN
+	double value(const QString& symbol, int specIndex) const;
+
+	// 과거 봉을 아직 요청하지 않은 종목인지 (요청하면 markBackfillRequested)
+	bool needsBackfill(const QString& symbol) const;
+	void markBackfillRequested(const QString& symbol);
+	void backfill(const QString& symbol, const QVector<Candle>& candles);
+
+	void remove(const QString& symbol);
+	void clear();
+
+public slots:
+	void onTick(const StockData& data);
+
+signals:
+	void specsChanged();
+	void valuesChanged(const QString& symbol);	// 백필 등 틱 외의 이유로 값이 바뀜
+
+private:
+	static constexpr int MaxClosedBars = 400;	// 지표 다시 만들 때 쓸 확정 봉 (일봉 약 1년 반)
+
+	struct SymbolState
+	{
+		QVector<Candle> closed;		// 확정된 봉 (오래된 순)
+		Candle current;				// 만들어지는 중인 봉
+		bool hasCurrent = false;
+		bool backfillRequested = false;
+		std::vector<IndicatorState> states;
+		std::vector<double> values;
+	};
+
+	CandleResolution m_resolution;
+	qint64 m_barMs;
+	QVector<IndicatorSpec> m_specs;
+	QHash<QString, SymbolState> m_symbols;
+
+	void rebuild(SymbolState& state) const;
+	void updateValues(SymbolState& state) const;
+	void commitCurrent(SymbolState& state) const;
+};
@@ -0,0 +1,467 @@
+#include "Indicators.h"
+#include <QRegularExpression>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+	constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+	double typicalPrice(const Candle& bar)
+	{
+		return (bar.high + bar.low + bar.close) / 3.0;
+	}
+
+	double rsiFromAverages(double avgGain, double avgLoss)
+	{
+		if (avgLoss <= 0.0) return avgGain > 0.0 ? 100.0 : 50.0;
+		return 100.0 - 100.0 / (1.0 + avgGain / avgLoss);
+	}
+}
+
+QString IndicatorSpec::toString() const
+{
+	switch (type)
+	{
+	case IndicatorType::SMA:            return QString("SMA(%1)").arg(period);
+	case IndicatorType::EMA:            return QString("EMA(%1)").arg(period);
+	case IndicatorType::VWAP:           return QString("VWAP(%1)").arg(period);
+	case IndicatorType::RSI:            return QString("RSI(%1)").arg(period);
+	case IndicatorType::BollingerUpper: return QString("BBU(%1,%2)").arg(period).arg(k);
+	case IndicatorType::BollingerLower: return QString("BBL(%1,%2)").arg(period).arg(k);
+	}
+	return QString();
+}
+
+bool IndicatorSpec::fromString(const QString& text, IndicatorSpec& spec)
+{
+	static const QRegularExpression re(R"(^\s*([A-Za-z]+)\s*\(\s*(\d+)\s*(?:,\s*([0-9.]+)\s*)?\)\s*$)");
+	QRegularExpressionMatch match = re.match(text);
+	if (!match.hasMatch()) return false;
+
+	const QString name = match.captured(1).toUpper();
+	IndicatorSpec result;
+	if (name == "SMA") result.type = IndicatorType::SMA;
+	else if (name == "EMA") result.type = IndicatorType::EMA;
+	else if (name == "VWAP") result.type = IndicatorType::VWAP;
+	else if (name == "RSI") result.type = IndicatorType::RSI;
+	else if (name == "BBU") result.type = IndicatorType::BollingerUpper;
+	else if (name == "BBL") result.type = IndicatorType::BollingerLower;
+	else return false;
+
+	result.period = match.captured(2).toInt();
+	if (!match.captured(3).isEmpty())
+		result.k = match.captured(3).toDouble();
+
+	// VWAP만 0(누적) 허용
+	if (result.period < (result.type == IndicatorType::VWAP ? 0 : 1) || result.period > 1000)
+		return false;
+
+	spec = result;
+	return true;
+}
+
+IndicatorState::IndicatorState(const IndicatorSpec& spec) : m_spec(spec)
+{
+	reset();
+}
+
+int IndicatorState::windowSize() const
+{
+	switch (m_spec.type)
+	{
+	case IndicatorType::SMA:
+	case IndicatorType::BollingerUpper:
+	case IndicatorType::BollingerLower:
+		return m_spec.period - 1;
+	case IndicatorType::VWAP:
+		return m_spec.period > 0 ? m_spec.period - 1 : 0;
+	default:
+		return 0;
+	}
+}
+
+void IndicatorState::reset()
+{
+	const int size = windowSize();
+	m_window.assign(size, 0.0);
+	m_windowVolume.assign(m_spec.type == IndicatorType::VWAP ? size : 0, 0.0);
+	m_windowNext = 0;
+	m_windowCount = 0;
+	m_sum = m_sumSq = m_sumVolume = 0.0;
+	m_shift = 0.0;
+	m_hasShift = false;
+	m_count = 0;
+	m_ema = m_prevClose = m_avgGain = m_avgLoss = 0.0;
+}
+
+void IndicatorState::pushWindow(double value, double volume)
+{
+	const int size = static_cast<int>(m_window.size());
+	if (size == 0) return;
+
+	// 창 합계는 기준값을 뺀 값으로 유지 (큰 가격에서 분산 계산 시 상쇄 오차 방지)
+	if (!m_hasShift && m_spec.type != IndicatorType::VWAP)
+	{
+		m_shift = value;
+		m_hasShift = true;
+	}
+	const double shifted = value - m_shift;
+
+	if (m_windowCount == size)
+	{
+		const double old = m_window[m_windowNext];
+		m_sum -= old;
+		m_sumSq -= old * old;
+		if (!m_windowVolume.empty()) m_sumVolume -= m_windowVolume[m_windowNext];
+	}
+	else
+	{
+		++m_windowCount;
+	}
+
+	m_window[m_windowNext] = shifted;
+	m_sum += shifted;
+	m_sumSq += shifted * shifted;
+	if (!m_windowVolume.empty())
+	{
+		m_windowVolume[m_windowNext] = volume;
+		m_sumVolume += volume;
+	}
+
+	m_windowNext = (m_windowNext + 1) % size;
+
+	// 한 바퀴 돌 때마다 합계를 새로 더해서 누적 오차 제거 (분할 상환 O(1))
+	if (m_windowNext == 0 && m_windowCount == size)
+	{
+		m_sum = m_sumSq = m_sumVolume = 0.0;
+		for (int i = 0; i < size; ++i)
+		{
+			m_sum += m_window[i];
+			m_sumSq += m_window[i] * m_window[i];
+			if (!m_windowVolume.empty()) m_sumVolume += m_windowVolume[i];
+		}
+	}
+}
+
+void IndicatorState::push(const Candle& bar)
+{
+	const int period = m_spec.period;
+
+	switch (m_spec.type)
+	{
+	case IndicatorType::SMA:
+	case IndicatorType::BollingerUpper:
+	case IndicatorType::BollingerLower:
+		pushWindow(bar.close, 0.0);
+		break;
+
+	case IndicatorType::VWAP:
+	{
+		const double volume = static_cast<double>(bar.volume);
+		if (period == 0)
+		{
+			m_sum += typicalPrice(bar) * volume;
+			m_sumVolume += volume;
+		}
+		else
+		{
+			pushWindow(typicalPrice(bar) * volume, volume);
+		}
+		break;
+	}
+
+	case IndicatorType::EMA:
+		// 처음 period개는 단순 평균으로 시작값을 잡음
+		if (m_count < period)
+		{
+			m_sum += bar.close;
+			if (m_count + 1 == period)
+				m_ema = m_sum / period;
+		}
+		else
+		{
+			m_ema += 2.0 / (period + 1) * (bar.close - m_ema);
+		}
+		break;
+
+	case IndicatorType::RSI:
+		if (m_count > 0)
+		{
+			const double change = bar.close - m_prevClose;
+			const double gain = change > 0 ? change : 0.0;
+			const double loss = change < 0 ? -change : 0.0;
+
+			// m_count번째 변화. period개까지는 합계, 이후 Wilder 평활
+			if (m_count <= period)
+			{
+				m_avgGain += gain;
+				m_avgLoss += loss;
+				if (m_count == period)
+				{
+					m_avgGain /= period;
+					m_avgLoss /= period;
+				}
+			}
+			else
+			{
+				m_avgGain = (m_avgGain * (period - 1) + gain) / period;
+				m_avgLoss = (m_avgLoss * (period - 1) + loss) / period;
+			}
+		}
+		m_prevClose = bar.close;
+		break;
+	}
+
+	++m_count;
+}
+
+double IndicatorState::valueWith(const Candle& current) const
+{
+	const int period = m_spec.period;
+	const int size = static_cast<int>(m_window.size());
+
+	switch (m_spec.type)
+	{
+	case IndicatorType::SMA:
+	{
+		if (m_windowCount < size) return NaN;
+		return m_shift + (m_sum + (current.close - m_shift)) / period;
+	}
+
+	case IndicatorType::BollingerUpper:
+	case IndicatorType::BollingerLower:
+	{
+		if (m_windowCount < size) return NaN;
+		const double shifted = current.close - m_shift;
+		const double mean = (m_sum + shifted) / period;
+		const double variance = (m_sumSq + shifted * shifted) / period - mean * mean;
+		const double band = m_spec.k * std::sqrt(qMax(variance, 0.0));
+		return m_shift + mean + (m_spec.type == IndicatorType::BollingerUpper ? band : -band);
+	}
+
+	case IndicatorType::VWAP:
+	{
+		if (period > 0 && m_windowCount < size) return NaN;
+		const double volume = static_cast<double>(current.volume);
+		const double totalVolume = m_sumVolume + volume;
+		if (totalVolume <= 0) return NaN;
+		return (m_sum + typicalPrice(current) * volume) / totalVolume;
+	}
+
+	case IndicatorType::EMA:
+		if (m_count + 1 < period) return NaN;
+		if (m_count + 1 == period) return (m_sum + current.close) / period;
+		return m_ema + 2.0 / (period + 1) * (current.close - m_ema);
+
+	case IndicatorType::RSI:
+	{
+		// 현재 봉까지 포함한 변화 수 = m_count
+		if (m_count < period || m_count == 0) return NaN;
+		const double change = current.close - m_prevClose;
+		const double gain = change > 0 ? change : 0.0;
+		const double loss = change < 0 ? -change : 0.0;
+		if (m_count == period)
+			return rsiFromAverages((m_avgGain + gain) / period, (m_avgLoss + loss) / period);
+		return rsiFromAverages((m_avgGain * (period - 1) + gain) / period, (m_avgLoss * (period - 1) + loss) / period);
+	}
+	}
+	return NaN;
+}
+
+void IndicatorState::seed(const QVector<Candle>& bars)
+{
+	reset();
+
+	qsizetype begin = 0;
+	const bool windowed = m_spec.type == IndicatorType::SMA || m_spec.type == IndicatorType::BollingerUpper
+		|| m_spec.type == IndicatorType::BollingerLower || (m_spec.type == IndicatorType::VWAP && m_spec.period > 0);
+	if (windowed)
+		begin = qMax<qsizetype>(0, bars.size() - windowSize());
+
+	for (qsizetype i = begin; i < bars.size(); ++i)
+		push(bars[i]);
+}
+
+namespace IndicatorKernels
+{
+	void sma(const double* close, qsizetype n, int period, double* out)
+	{
+		if (n <= 0) return;
+
+		// 누적합 (기준값을 빼서 정밀도 유지)
+		const double shift = close[0];
+		std::vector<double> prefix(n + 1);
+		prefix[0] = 0.0;
+		for (qsizetype i = 0; i < n; ++i)
+			prefix[i + 1] = prefix[i] + (close[i] - shift);
+
+		const qsizetype warmup = qMin<qsizetype>(period - 1, n);
+		for (qsizetype i = 0; i < warmup; ++i)
+			out[i] = NaN;
+
+		// 의존성 없는 루프 -> 벡터화
+		const double inv = 1.0 / period;
+		for (qsizetype i = period - 1; i < n; ++i)
+			out[i] = shift + (prefix[i + 1] - prefix[i + 1 - period]) * inv;
+	}
+
+	void ema(const double* close, qsizetype n, int period, double* out)
+	{
+		const double alpha = 2.0 / (period + 1);
+		double sum = 0.0;
+		double value = 0.0;
+		for (qsizetype i = 0; i < n; ++i)
+		{
+			if (i < period)
+			{
+				sum += close[i];
+				if (i + 1 < period)
+				{
+					out[i] = NaN;
+					continue;
+				}
+				value = sum / period;
+			}
+			else
+			{
+				value += alpha * (close[i] - value);
+			}
+			out[i] = value;
+		}
+	}
+
+	void bollinger(const double* close, qsizetype n, int period, double k, double* upper, double* lower)
+	{
+		if (n <= 0) return;
+
+		const double shift = close[0];
+		std::vector<double> prefix(n + 1);
+		std::vector<double> prefixSq(n + 1);
+		prefix[0] = prefixSq[0] = 0.0;
+		for (qsizetype i = 0; i < n; ++i)
+		{
+			const double x = close[i] - shift;
+			prefix[i + 1] = prefix[i] + x;
+			prefixSq[i + 1] = prefixSq[i] + x * x;
+		}
+
+		const qsizetype warmup = qMin<qsizetype>(period - 1, n);
+		for (qsizetype i = 0; i < warmup; ++i)
+			upper[i] = lower[i] = NaN;
+
+		const double inv = 1.0 / period;
+		for (qsizetype i = period - 1; i < n; ++i)
+		{
+			const double mean = (prefix[i + 1] - prefix[i + 1 - period]) * inv;
+			const double variance = (prefixSq[i + 1] - prefixSq[i + 1 - period]) * inv - mean * mean;
+			const double band = k * std::sqrt(variance > 0.0 ? variance : 0.0);
+			upper[i] = shift + mean + band;
+			lower[i] = shift + mean - band;
+		}
+	}
+
+	void vwap(const double* typical, const double* volume, qsizetype n, int period, double* out)
+	{
+		std::vector<double> prefixPv(n + 1);
+		std::vector<double> prefixV(n + 1);
+		prefixPv[0] = prefixV[0] = 0.0;
+		for (qsizetype i = 0; i < n; ++i)
+		{
+			prefixPv[i + 1] = prefixPv[i] + typical[i] * volume[i];
+			prefixV[i + 1] = prefixV[i] + volume[i];
+		}
+
+		// period 0 = 처음부터 누적
+		const qsizetype warmup = period > 0 ? qMin<qsizetype>(period - 1, n) : 0;
+		for (qsizetype i = 0; i < warmup; ++i)
+			out[i] = NaN;
+
+		for (qsizetype i = warmup; i < n; ++i)
+		{
+			const qsizetype from = period > 0 ? i + 1 - period : 0;
+			const double v = prefixV[i + 1] - prefixV[from];
+			out[i] = v > 0.0 ? (prefixPv[i + 1] - prefixPv[from]) / v : NaN;
+		}
+	}
+
+	void rsi(const double* close, qsizetype n, int period, double* out)
+	{
+		double avgGain = 0.0;
+		double avgLoss = 0.0;
+		if (n > 0) out[0] = NaN;
+		for (qsizetype i = 1; i < n; ++i)
+		{
+			const double change = close[i] - close[i - 1];
+			const double gain = change > 0 ? change : 0.0;
+			const double loss = change < 0 ? -change : 0.0;
+
+			if (i <= period)
+			{
+				avgGain += gain;
+				avgLoss += loss;
+				if (i < period)
+				{
+					out[i] = NaN;
+					continue;
+				}
+				avgGain /= period;
+				avgLoss /= period;
+			}
+			else
+			{
+				avgGain = (avgGain * (period - 1) + gain) / period;
+				avgLoss = (avgLoss * (period - 1) + loss) / period;
+			}
+			out[i] = rsiFromAverages(avgGain, avgLoss);
+		}
+	}
+
+	std::vector<double> compute(const IndicatorSpec& spec, const QVector<Candle>& bars)
+	{
+		const qsizetype n = bars.size();
+		std::vector<double> out(n, NaN);
+		if (n == 0) return out;
+
+		// 봉 배열(AoS) -> 열 배열
+		std::vector<double> close(n);
+		for (qsizetype i = 0; i < n; ++i)
+			close[i] = bars[i].close;
+
+		switch (spec.type)
+		{
+		case IndicatorType::SMA:
+			sma(close.data(), n, spec.period, out.data());
+			break;
+		case IndicatorType::EMA:
+			ema(close.data(), n, spec.period, out.data());
+			break;
+		case IndicatorType::RSI:
+			rsi(close.data(), n, spec.period, out.data());
+			break;
+		case IndicatorType::BollingerUpper:
+		case IndicatorType::BollingerLower:
+		{
+			std::vector<double> other(n);
+			if (spec.type == IndicatorType::BollingerUpper)
+				bollinger(close.data(), n, spec.period, spec.k, out.data(), other.data());
+			else
+				bollinger(close.data(), n, spec.period, spec.k, other.data(), out.data());
+			break;
+		}
+		case IndicatorType::VWAP:
+		{
+			std::vector<double> typical(n);
+			std::vector<double> volume(n);
+			for (qsizetype i = 0; i < n; ++i)
+			{
+				typical[i] = typicalPrice(bars[i]);
+				volume[i] = static_cast<double>(bars[i].volume);
+			}
+			vwap(typical.data(), volume.data(), n, spec.period, out.data());
+			break;
+		}
+		}
+		return out;
+	}
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+#include <QVector>
+#include <vector>
+#include "Candle.h"
+
+enum class IndicatorType
+{
+	SMA,			// 단순 이동평균 (종가)
+	EMA,			// 지수 이동평균 (종가)
+	VWAP,			// 거래량 가중 평균가 (대표가 (H+L+C)/3). period 0 = 전체 누적
+	RSI,			// Wilder RSI
+	BollingerUpper,	// SMA + k * 표준편차
+	BollingerLower	// SMA - k * 표준편차
+};
+
+// 지표 하나의 설정. 문자열 형식: "SMA(20)", "EMA(12)", "VWAP(0)", "RSI(14)", "BBU(20,2)", "BBL(20,2)"
+struct IndicatorSpec
+{
+	IndicatorType type = IndicatorType::SMA;
+	int period = 20;
+	double k = 2.0;		// 볼린저 밴드 폭
+
+	QString toString() const;
+	static bool fromString(const QString& text, IndicatorSpec& spec);
+
+	// 가격과 같은 축에 그릴 수 있는 지표인지 (RSI 제외)
+	bool isPriceScale() const { return type != IndicatorType::RSI; }
+
+	bool operator==(const IndicatorSpec& other) const
+	{
+		return type == other.type && period == other.period && k == other.k;
+	}
+};
+
+// 지표 하나의 누적 상태
+// push()로 확정된 봉을 쌓고, valueWith()로 "지금 만들어지는 봉"을 얹은 값을 구함
+// 둘 다 O(1) (봉 하나 넣을 때 과거 전체를 다시 계산하지 않음)
+class IndicatorState
+{
+public:
+	explicit IndicatorState(const IndicatorSpec& spec = IndicatorSpec());
+
+	const IndicatorSpec& spec() const { return m_spec; }
+
+	void push(const Candle& bar);
+	double valueWith(const Candle& current) const;	// 준비가 안 됐으면 NaN
+	void reset();
+
+	// 확정 봉들로 상태 구성. 창 계열은 마지막 창 크기만큼만, EMA/RSI/누적 VWAP은 처음부터 순차로
+	void seed(const QVector<Candle>& bars);
+
+private:
+	IndicatorSpec m_spec;
+
+	// 최근 (period - 1)개 확정 봉의 창 (SMA/볼린저: 종가, VWAP: 대표가*거래량/거래량)
+	std::vector<double> m_window;
+	std::vector<double> m_windowVolume;
+	int m_windowNext = 0;
+	int m_windowCount = 0;
+	double m_sum = 0.0;
+	double m_sumSq = 0.0;		// 기준값(m_shift)을 뺀 제곱합 (상쇄 오차 줄이기)
+	double m_sumVolume = 0.0;
+	double m_shift = 0.0;
+	bool m_hasShift = false;
+
+	// EMA / RSI
+	int m_count = 0;			// 지금까지 확정된 봉 수
+	double m_ema = 0.0;
+	double m_prevClose = 0.0;
+	double m_avgGain = 0.0;
+	double m_avgLoss = 0.0;
+
+	int windowSize() const;
+	void pushWindow(double value, double volume);
+};
+
+// 과거 봉 전체에 대한 지표 계열 계산 (차트 오버레이, 백필)
+// 입력은 열 단위 연속 배열. 준비 안 된 앞부분은 NaN
+// 이동 창 계열(SMA/볼린저/VWAP)은 누적합 차이로 바꿔서 루프가 벡터화되도록 씀
+// EMA/RSI는 점화식이라 순차 루프
+namespace IndicatorKernels
+{
+	void sma(const double* close, qsizetype n, int period, double* out);
+	void ema(const double* close, qsizetype n, int period, double* out);
+	void bollinger(const double* close, qsizetype n, int period, double k, double* upper, double* lower);
+	void vwap(const double* typical, const double* volume, qsizetype n, int period, double* out);
+	void rsi(const double* close, qsizetype n, int period, double* out);
+
+	// 봉 배열 -> 지표 계열 (spec에 맞는 커널 호출)
+	std::vector<double> compute(const IndicatorSpec& spec, const QVector<Candle>& bars);
+}
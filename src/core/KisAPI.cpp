@@ -1,14 +1,23 @@
 #include "KisAPI.h"
 #include "Config.h"
+#include "Endpoints.h"
 #include "NetworkUtils.h"
+#include "LatencyTracer.h"
+#include "QuoteParser.h"
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QUrlQuery>
 #include <QSettings>
 #include <QDateTime>
-#include "StockCodeMap.h"
-#include <QPixmap>
+#include <QImage>
+#include <QTimeZone>
+
+namespace
+{
+    // 한투 날짜/시각은 한국 시간 기준 (서머타임 없음)
+    const QTimeZone KST(9 * 3600);
+}
 
 KisAPI::KisAPI(QObject* parent) : StockAPI(parent)
 {
@@ -24,7 +33,7 @@ void KisAPI::authenticate()
     }
 
     qDebug() << "토큰이 없거나 만료됨. 새로 요청합니다...";
-    QUrl url(Config::KIS_BASE_URL + "/oauth2/tokenP");
+    QUrl url(Endpoints::kisBaseUrl() + "/oauth2/tokenP");
     QNetworkRequest request(url);
     request.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
 
@@ -34,6 +43,7 @@ void KisAPI::authenticate()
     json["appsecret"] = Config::KIS_APP_SECRET;
 
     QNetworkReply* reply = manager->post(request, QJsonDocument(json).toJson());
+    LatencyTracer::traceReply(reply, "kis", "/oauth2/tokenP");
     NetworkUtils::addTimeOut(reply);
 
     connect(
@@ -60,6 +70,7 @@ void KisAPI::onAuthFinished(QNetworkReply* reply)
 
     // 토큰 저장
     m_accessToken = obj["access_token"].toString();
+    resetQuoteRequests();
 
     // 유효기간 가져오기 (초 단위) - 보통 86400초
     int expiresIn = doc.object()["expires_in"].toInt();
@@ -68,6 +79,7 @@ void KisAPI::onAuthFinished(QNetworkReply* reply)
     QDateTime expiryTime = QDateTime::currentDateTime().addSecs(expiresIn);
 
     // 파일에 저장
+    m_tokenExpiry = expiryTime;
     saveToken(m_accessToken, expiryTime);
 
     qDebug() << "KIS Login Success! Token acquired.";
@@ -83,28 +95,165 @@ void KisAPI::fetchStock(const QString& symbol)
         return;
     }
 
-    // 주식현재가 시세 URL
-    QUrl url(Config::KIS_BASE_URL + "/uapi/domestic-stock/v1/quotations/inquire-price");
-    QUrlQuery query;
-    query.addQueryItem("fid_cond_mrkt_div_code", "J"); // J: 주식
-    query.addQueryItem("fid_input_iscd", symbol);      // 종목코드
-    url.setQuery(query);
+    // 요청 객체는 종목마다 한 번만 만들고 재사용 (토큰이 바뀌면 다시)
+    QuoteTarget& target = quoteTarget(symbol);
+    if (target.request.url().isEmpty())
+    {
+        // 주식현재가 시세 URL
+        QUrl url(Endpoints::kisBaseUrl() + "/uapi/domestic-stock/v1/quotations/inquire-price");
+        QUrlQuery query;
+        query.addQueryItem("fid_cond_mrkt_div_code", "J"); // J: 주식
+        query.addQueryItem("fid_input_iscd", symbol);      // 종목코드
+        url.setQuery(query);
+
+        // 현재가 조회용 거래 ID (모의/실전 동일)
+        target.request = makeRequest(url, "FHKST01010100");
+    }
+
+    QNetworkReply* reply = manager->get(target.request);
 
+    // 꼬리표 붙이기 (심볼, 공유 문자열)
+    reply->setProperty("TargetSymbol", target.symbol);
+    LatencyTracer::traceReply(reply, "kis", "inquire-price", symbol, true);
+    NetworkUtils::addTimeOut(reply);
+
+    connect(reply, &QNetworkReply::finished, [this, reply]() { onStockReceived(reply); });
+}
+
+QNetworkRequest KisAPI::makeRequest(const QUrl& url, const QByteArray& trId) const
+{
     QNetworkRequest request(url);
 
     // 한투 API 필수 헤더 4대장
     request.setRawHeader("Authorization", ("Bearer " + m_accessToken).toUtf8());
     request.setRawHeader("appkey", Config::KIS_APP_KEY.toUtf8());
     request.setRawHeader("appsecret", Config::KIS_APP_SECRET.toUtf8());
-    request.setRawHeader("tr_id", "FHKST01010100"); // 현재가 조회용 거래 ID (모의/실전 동일)
+    request.setRawHeader("tr_id", trId);
+    return request;
+}
 
-    QNetworkReply* reply = manager->get(request);
+qint64 KisAPI::maxCandleSpan(CandleResolution resolution) const
+{
+    // 한 번에 최대 100개 (분봉은 30개) 까지만 내려줌
+    constexpr qint64 day = 24LL * 60 * 60 * 1000;
+    switch (resolution)
+    {
+    case CandleResolution::Minute1: return 30LL * 60 * 1000;
+    case CandleResolution::Day:     return 140 * day;   // 영업일 100일 ~= 달력 140일
+    case CandleResolution::Week:    return 100 * 7 * day;
+    case CandleResolution::Month:   return 100 * 28 * day;
+    default:                        return 0;
+    }
+}
 
-    // 꼬리표 붙이기 (심볼)
-    reply->setProperty("TargetSymbol", symbol);
-    NetworkUtils::addTimeOut(reply);
+void KisAPI::requestCandles(int requestId, const QString& symbol, CandleResolution resolution, qint64 from, qint64 to)
+{
+    if (m_accessToken.isEmpty())
+    {
+        qDebug() << "토큰이 없습니다. authenticate() 먼저 호출하세요.";
+        finishCandleRequest(requestId, from, to, {}, false);
+        return;
+    }
 
-    connect(reply, &QNetworkReply::finished, [this, reply]() { onStockReceived(reply); });
+    QUrl url;
+    QUrlQuery query;
+    QByteArray trId;
+    const QDateTime fromTime = QDateTime::fromMSecsSinceEpoch(from, KST);
+    const QDateTime toTime = QDateTime::fromMSecsSinceEpoch(to, KST);
+
+    if (resolution == CandleResolution::Day || resolution == CandleResolution::Week || resolution == CandleResolution::Month)
+    {
+        // 기간별 시세 (일/주/월봉)
+        url = QUrl(Endpoints::kisBaseUrl() + "/uapi/domestic-stock/v1/quotations/inquire-daily-itemchartprice");
+        const char* period = (resolution == CandleResolution::Day) ? "D" : (resolution == CandleResolution::Week) ? "W" : "M";
+        query.addQueryItem("FID_COND_MRKT_DIV_CODE", "J");
+        query.addQueryItem("FID_INPUT_ISCD", symbol);
+        query.addQueryItem("FID_INPUT_DATE_1", fromTime.toString("yyyyMMdd"));
+        query.addQueryItem("FID_INPUT_DATE_2", toTime.toString("yyyyMMdd"));
+        query.addQueryItem("FID_PERIOD_DIV_CODE", period);
+        query.addQueryItem("FID_ORG_ADJ_PRC", "0");    // 0: 수정주가
+        trId = "FHKST03010100";
+    }
+    else if (resolution == CandleResolution::Minute1
+        && toTime.date() == QDateTime::currentDateTime(KST).date())
+    {
+        // 당일 분봉 (입력 시각 이전 30개)
+        url = QUrl(Endpoints::kisBaseUrl() + "/uapi/domestic-stock/v1/quotations/inquire-time-itemchartprice");
+        query.addQueryItem("FID_ETC_CLS_CODE", "");
+        query.addQueryItem("FID_COND_MRKT_DIV_CODE", "J");
+        query.addQueryItem("FID_INPUT_ISCD", symbol);
+        query.addQueryItem("FID_INPUT_HOUR_1", toTime.toString("HHmmss"));
+        query.addQueryItem("FID_PW_DATA_INCU_YN", "N");
+        trId = "FHKST03010200";
+    }
+    else
+    {
+        // 한투 조회 API는 과거 분봉과 1분 외 분봉을 지원하지 않음
+        qDebug() << "KIS 미지원 봉 요청:" << symbol << CandleUtils::toString(resolution);
+        finishCandleRequest(requestId, from, to, {}, false);
+        return;
+    }
+
+    url.setQuery(query);
+    QNetworkReply* reply = manager->get(makeRequest(url, trId));
+
+    reply->setProperty("RequestId", requestId);
+    reply->setProperty("RangeFrom", from);
+    reply->setProperty("RangeTo", to);
+    LatencyTracer::traceReply(reply, "kis", url.path().section('/', -1), symbol);
+    NetworkUtils::addTimeOut(reply, 10000);
+
+    connect(reply, &QNetworkReply::finished, [this, reply]() { onCandlesReceived(reply); });
+}
+
+void KisAPI::onCandlesReceived(QNetworkReply* reply)
+{
+    reply->deleteLater();
+
+    int requestId = reply->property("RequestId").toInt();
+    qint64 from = reply->property("RangeFrom").toLongLong();
+    qint64 to = reply->property("RangeTo").toLongLong();
+
+    if (reply->error() != QNetworkReply::NoError)
+    {
+        qDebug() << "KIS Candle Error:" << reply->errorString();
+        finishCandleRequest(requestId, from, to, {}, false);
+        return;
+    }
+
+    QJsonObject obj = QJsonDocument::fromJson(reply->readAll()).object();
+    if (obj["rt_cd"].toString() != "0")
+    {
+        qDebug() << "KIS Candle Error:" << obj["msg1"].toString();
+        finishCandleRequest(requestId, from, to, {}, false);
+        return;
+    }
+
+    // output2: 최신 봉부터 내려옴. 분봉이면 체결시각(stck_cntg_hour)이 같이 옴
+    QVector<Candle> candles;
+    for (const QJsonValue& val : obj["output2"].toArray())
+    {
+        QJsonObject row = val.toObject();
+        QDate date = QDate::fromString(row["stck_bsop_date"].toString(), "yyyyMMdd");
+        if (!date.isValid()) continue;
+
+        QTime time(0, 0);
+        if (row.contains("stck_cntg_hour"))
+            time = QTime::fromString(row["stck_cntg_hour"].toString(), "HHmmss");
+
+        Candle candle;
+        candle.time = QDateTime(date, time, KST).toMSecsSinceEpoch();
+        candle.open = row["stck_oprc"].toString().toDouble();
+        candle.high = row["stck_hgpr"].toString().toDouble();
+        candle.low = row["stck_lwpr"].toString().toDouble();
+        candle.close = row.contains("stck_clpr") ? row["stck_clpr"].toString().toDouble()
+                                                 : row["stck_prpr"].toString().toDouble();
+        candle.volume = row.contains("acml_vol") ? row["acml_vol"].toString().toLongLong()
+                                                 : row["cntg_vol"].toString().toLongLong();
+        candles.append(candle);
+    }
+
+    finishCandleRequest(requestId, from, to, candles, true);
 }
 
 void KisAPI::fetchLogo(const QString& symbol)
@@ -114,6 +263,100 @@ void KisAPI::fetchLogo(const QString& symbol)
     downloadLogoFromUrl(symbol, urlStr);
 }
 
+void KisAPI::fetchOrderBook(const QString& symbol)
+{
+    if (m_accessToken.isEmpty())
+    {
+        qDebug() << "토큰이 없습니다. authenticate() 먼저 호출하세요.";
+        return;
+    }
+
+    // 구독 종목마다 1초 주기로 부르므로 요청은 처음 한 번만 만듦 (토큰이 바뀌면 resetQuoteRequests가 비움)
+    QuoteTarget& target = quoteTarget(symbol);
+    if (target.orderBookRequest.url().isEmpty())
+    {
+        QUrl url(Endpoints::kisBaseUrl() + "/uapi/domestic-stock/v1/quotations/inquire-asking-price-exp-ccn");
+        QUrlQuery query;
+        query.addQueryItem("FID_COND_MRKT_DIV_CODE", "J");
+        query.addQueryItem("FID_INPUT_ISCD", symbol);
+        url.setQuery(query);
+
+        target.orderBookRequest = makeRequest(url, "FHKST01010200");
+    }
+
+    QNetworkReply* reply = manager->get(target.orderBookRequest);
+    reply->setProperty("TargetSymbol", target.symbol);
+    LatencyTracer::traceReply(reply, "kis", "inquire-asking-price-exp-ccn", symbol);
+    NetworkUtils::addTimeOut(reply);
+
+    connect(reply, &QNetworkReply::finished, [this, reply]() { onOrderBookReceived(reply); });
+}
+
+bool KisAPI::parseOrderBook(QByteArrayView json, OrderBook& book)
+{
+    // "output1"의 askp1~10 / bidp1~10 / 잔량만 (QuoteSchema::KisOrderBookFields)
+    return QuoteParser::parseKisOrderBook(json, book);
+}
+
+void KisAPI::onOrderBookReceived(QNetworkReply* reply)
+{
+    reply->deleteLater();
+
+    if (reply->error() != QNetworkReply::NoError)
+    {
+        qDebug() << "KIS OrderBook Error:" << reply->errorString();
+        return;
+    }
+
+    OrderBook book;
+    if (!parseOrderBook(readReply(reply), book))
+    {
+        qDebug() << "Invalid OrderBook format";
+        return;
+    }
+
+    book.timestamp = QDateTime::currentMSecsSinceEpoch();
+    emit orderBookReceived(reply->property("TargetSymbol").toString(), book);
+}
+
+void KisAPI::requestApprovalKey()
+{
+    QUrl url(Endpoints::kisBaseUrl() + "/oauth2/Approval");
+    QNetworkRequest request(url);
+    request.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+
+    // 접속키 발급은 appsecret이 아니라 secretkey라는 이름으로 보냄
+    QJsonObject json;
+    json["grant_type"] = "client_credentials";
+    json["appkey"] = Config::KIS_APP_KEY;
+    json["secretkey"] = Config::KIS_APP_SECRET;
+
+    QNetworkReply* reply = manager->post(request, QJsonDocument(json).toJson());
+    LatencyTracer::traceReply(reply, "kis", "/oauth2/Approval");
+    NetworkUtils::addTimeOut(reply);
+
+    connect(reply, &QNetworkReply::finished, [this, reply]()
+    {
+        reply->deleteLater();
+        if (reply->error() != QNetworkReply::NoError)
+        {
+            qDebug() << "KIS Approval Error:" << reply->errorString();
+            return;
+        }
+
+        QString key = QJsonDocument::fromJson(reply->readAll()).object()["approval_key"].toString();
+        if (!key.isEmpty())
+            emit approvalKeyReceived(key);
+    });
+}
+
+bool KisAPI::parseQuote(QByteArrayView json, StockData& data)
+{
+    // "output" 안의 문자열 숫자를 QString 없이 바로 변환
+    // 전일 종가는 안 와서 현재가 - 전일대비(prdy_vrss)로 계산 (QuoteParser)
+    return QuoteParser::parse(json, QuoteSchema::Kis, data);
+}
+
 void KisAPI::onStockReceived(QNetworkReply* reply)
 {
     reply->deleteLater();
@@ -125,27 +368,14 @@ void KisAPI::onStockReceived(QNetworkReply* reply)
         return;
     }
 
-    // 한투 응답 파싱
-    QByteArray responseData = reply->readAll();
-    QJsonDocument doc = QJsonDocument::fromJson(responseData);
-    QJsonObject output = doc.object()["output"].toObject(); // "output" 안에 데이터 있음
-
-    if (output.isEmpty()) return;
-
     StockData data;
-    data.symbol = symbol;
-    // 한투는 이름이 안 옴. 일단 심볼로 대체하거나 별도 매핑 필요.
-    data.name = StockCodeMap::getName(symbol);
-
-    // 문자열로 오기 때문에 숫자로 변환 필요
-    data.currentPrice = output["stck_prpr"].toString().toDouble(); // 현재가
-    data.highPrice = output["stck_hgpr"].toString().toDouble();    // 고가
-    data.lowPrice = output["stck_lwpr"].toString().toDouble();     // 저가
-    data.openPrice = output["stck_oprc"].toString().toDouble();    // 시가
+    if (!parseQuote(readReply(reply), data)) return;
 
-    // 전일 종가는 계산해서 넣거나 다른 필드 참조 (stck_prpr - prdy_vrss)
-    double change = output["prdy_vrss"].toString().toDouble(); // 전일대비
-    data.prevClose = data.currentPrice - change;
+    // 한투는 이름이 안 옴 -> 종목 사전에서 (종목마다 한 번 찾아둔 문자열 공유)
+    stampIdentity(data, symbol);
+    data.timestamp = QDateTime::currentMSecsSinceEpoch();
+    data.traceId = LatencyTracer::traceId(reply);
+    LatencyTracer::mark(data.traceId, TraceStage::Parsed);
 
     // 국내 주식임을 표시 (나중에 원화(₩) 표시할 때 씀)
     // data.currency = "KRW"; // StockData에 currency 필드가 있다면 추가 권장
@@ -165,10 +395,10 @@ void KisAPI::onLogoDownloaded(QNetworkReply* reply)
 
     QString symbol = reply->property("symbol").toString();
 
-    // 이미지 데이터 변환 (Binary -> QPixmap)
+    // 이미지 데이터 변환 (Binary -> QImage, QPixmap은 GUI 스레드에서)
     QByteArray data = reply->readAll();
 
-    QPixmap logo;
+    QImage logo;
     if (logo.loadFromData(data))
     {
         emit logoReceived(symbol, logo);
@@ -181,6 +411,7 @@ void KisAPI::saveToken(const QString& token, const QDateTime& expiry)
     QSettings settings(Config::SETTINGS_COMPANY, Config::SETTINGS_APP);
     settings.setValue("kis_token", token);
     settings.setValue("kis_expiry", expiry);
+    settings.setValue("kis_token_server", Endpoints::kisBaseUrl());  // 발급받은 서버 (테스트 서버 토큰 구분용)
 }
 
 bool KisAPI::loadToken()
@@ -190,6 +421,10 @@ bool KisAPI::loadToken()
     // 저장된 게 없으면 실패
     if (!settings.contains("kis_token")) return false;
 
+    // 다른 서버에서 받은 토큰은 쓰지 않음
+    if (settings.value("kis_token_server", Endpoints::kisBaseUrl()).toString() != Endpoints::kisBaseUrl())
+        return false;
+
     QDateTime expiry = settings.value("kis_expiry").toDateTime();
     QString token = settings.value("kis_token").toString();
 
@@ -197,6 +432,8 @@ bool KisAPI::loadToken()
     if (QDateTime::currentDateTime().addSecs(600) < expiry)
     {
         m_accessToken = token; // 멤버 변수에 저장
+        m_tokenExpiry = expiry;
+        resetQuoteRequests();
         return true; // 유효함!
     }
 
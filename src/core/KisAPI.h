@@ -1,6 +1,7 @@
 #pragma once
 
 #include "StockAPI.h"
+#include "OrderBook.h"
 #include <QDateTime>
 
 class KisAPI : public StockAPI
@@ -11,19 +12,41 @@ public:
     explicit KisAPI(QObject* parent = nullptr);
 
     void authenticate();
+    // 지금 토큰의 만료 시각 (authenticated 이후에 유효)
+    QDateTime tokenExpiry() const { return m_tokenExpiry; }
     void fetchStock(const QString& symbol) override;
     void fetchLogo(const QString& symbol) override;
+    // 10단계 호가 (주식현재가 호가/예상체결)
+    void fetchOrderBook(const QString& symbol);
+
+    // 실시간 접속키 (웹소켓 구독용, 토큰과 별개). 받으면 approvalKeyReceived
+    void requestApprovalKey();
+
+    // inquire-price 응답 본문 -> StockData 가격 필드 (심볼/이름/시각은 호출한 쪽에서)
+    static bool parseQuote(QByteArrayView json, StockData& data);
+    // inquire-asking-price-exp-ccn 응답 본문 -> 호가
+    static bool parseOrderBook(QByteArrayView json, OrderBook& book);
 
 signals:
     void authenticated();
+    void orderBookReceived(const QString& symbol, const OrderBook& book);
+    void approvalKeyReceived(const QString& key);
+
+protected:
+    void requestCandles(int requestId, const QString& symbol, CandleResolution resolution, qint64 from, qint64 to) override;
+    qint64 maxCandleSpan(CandleResolution resolution) const override;
 
 private slots:
        void onAuthFinished(QNetworkReply* reply);
        void onStockReceived(QNetworkReply* reply);
        void onLogoDownloaded(QNetworkReply* reply);
+       void onCandlesReceived(QNetworkReply* reply);
+       void onOrderBookReceived(QNetworkReply* reply);
 
 private:
     QString m_accessToken;
+    QDateTime m_tokenExpiry;
+    QNetworkRequest makeRequest(const QUrl& url, const QByteArray& trId) const;
     void saveToken(const QString& token, const QDateTime& expiry);
     bool loadToken();
 };
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "KisRealtime.h"
+#include "QuoteParser.h"
+#include <QWebSocket>
+#include <QTimer>
+#include <QDateTime>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QDebug>
+
+namespace
+{
+	const char* ORDER_BOOK_TR_ID = "H0STASP0";
+	const int RECONNECT_DELAY_MS = 3000;
+}
+
+KisRealtime::KisRealtime(QObject* parent) : QObject(parent)
+{
+	m_socket = new QWebSocket(QString(), QWebSocketProtocol::VersionLatest, this);
+	connect(m_socket, &QWebSocket::connected, this, &KisRealtime::onConnected);
+	connect(m_socket, &QWebSocket::disconnected, this, &KisRealtime::onDisconnected);
+	connect(m_socket, &QWebSocket::textMessageReceived, this, &KisRealtime::onTextMessage);
+
+	m_reconnectTimer = new QTimer(this);
+	m_reconnectTimer->setSingleShot(true);
+	m_reconnectTimer->setInterval(RECONNECT_DELAY_MS);
+	connect(m_reconnectTimer, &QTimer::timeout, this, [this]() { m_socket->open(QUrl(m_url)); });
+}
+
+KisRealtime::~KisRealtime()
+{
+	close();
+}
+
+void KisRealtime::open(const QString& url, const QString& approvalKey)
+{
+	m_url = url;
+	m_approvalKey = approvalKey;
+	m_closing = false;
+	m_socket->open(QUrl(m_url));
+}
+
+void KisRealtime::close()
+{
+	m_closing = true;
+	m_reconnectTimer->stop();
+	m_socket->close();
+}
+
+void KisRealtime::subscribe(const QString& symbol)
+{
+	if (m_symbols.contains(symbol)) return;
+	m_symbols.insert(symbol);
+	if (m_connected)
+		send(symbol, true);
+}
+
+void KisRealtime::unsubscribe(const QString& symbol)
+{
+	if (!m_symbols.remove(symbol)) return;
+	if (m_connected)
+		send(symbol, false);
+}
+
+void KisRealtime::send(const QString& symbol, bool subscribe)
+{
+	QJsonObject header;
+	header["approval_key"] = m_approvalKey;
+	header["custtype"] = "P";
+	header["tr_type"] = subscribe ? "1" : "2";	// 1 등록, 2 해제
+	header["content-type"] = "utf-8";
+
+	QJsonObject input;
+	input["tr_id"] = ORDER_BOOK_TR_ID;
+	input["tr_key"] = symbol;
+
+	QJsonObject body;
+	body["input"] = input;
+
+	QJsonObject message;
+	message["header"] = header;
+	message["body"] = body;
+	m_socket->sendTextMessage(QString::fromUtf8(QJsonDocument(message).toJson(QJsonDocument::Compact)));
+}
+
+void KisRealtime::onConnected()
+{
+	qDebug() << "KIS 실시간 연결됨:" << m_url;
+	m_connected = true;
+	for (const QString& symbol : m_symbols)
+		send(symbol, true);
+	emit connected();
+}
+
+void KisRealtime::onDisconnected()
+{
+	const bool wasConnected = m_connected;
+	m_connected = false;
+	if (wasConnected)
+	{
+		qDebug() << "KIS 실시간 연결 끊김:" << m_socket->closeReason();
+		emit disconnected();
+	}
+
+	if (!m_closing)
+		m_reconnectTimer->start();
+}
+
+void KisRealtime::onTextMessage(const QString& message)
+{
+	// 시세 프레임: "0|H0STASP0|001|005930^093730^0^..." (암호화 여부|TR|건수|데이터)
+	// 그 외(구독 응답, PINGPONG)는 JSON
+	if (message.startsWith('0') || message.startsWith('1'))
+	{
+		const QByteArray frame = message.toUtf8();
+		const QList<QByteArray> parts = frame.split('|');
+		if (parts.size() < 4 || parts[1] != ORDER_BOOK_TR_ID) return;
+		if (parts[0] != "0")
+		{
+			qDebug() << "KIS 실시간: 암호화된 호가 프레임은 지원하지 않음";
+			return;
+		}
+
+		OrderBook book;
+		QByteArrayView symbol;
+		if (!QuoteParser::parseKisOrderBookFrame(parts[3], parts[2].toInt(), book, &symbol))
+		{
+			qDebug() << "Invalid realtime OrderBook format";
+			return;
+		}
+		book.timestamp = QDateTime::currentMSecsSinceEpoch();
+		emit orderBookReceived(QString::fromLatin1(symbol), book);
+		return;
+	}
+
+	const QJsonObject obj = QJsonDocument::fromJson(message.toUtf8()).object();
+	const QString trId = obj["header"].toObject()["tr_id"].toString();
+
+	// 서버 생존 확인은 그대로 돌려보냄
+	if (trId == "PINGPONG")
+	{
+		m_socket->sendTextMessage(message);
+		return;
+	}
+
+	const QJsonObject body = obj["body"].toObject();
+	if (body.contains("rt_cd") && body["rt_cd"].toString() != "0")
+		qDebug() << "KIS 실시간 구독 오류:" << trId << body["msg1"].toString();
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include "OrderBook.h"
+
+class QWebSocket;
+class QTimer;
+
+// 한국투자증권 실시간 호가 (웹소켓, H0STASP0)
+// 접속키로 연결한 뒤 종목마다 구독 메시지를 보내고, 호가가 바뀔 때마다 오는 프레임을 바로 OrderBook으로 풀어 넘김
+// 연결이 끊기면 잠시 뒤 다시 붙고 구독을 복구함
+// Qt WebSockets 모듈이 있을 때만 빌드됨 (STOCKFLOW_HAS_WEBSOCKETS). 없으면 ProviderService가 REST로 주기 조회
+class KisRealtime : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit KisRealtime(QObject* parent = nullptr);
+	~KisRealtime();
+
+	void open(const QString& url, const QString& approvalKey);
+	void close();
+	bool isConnected() const { return m_connected; }
+
+	void subscribe(const QString& symbol);
+	void unsubscribe(const QString& symbol);
+
+signals:
+	void connected();
+	void disconnected();
+	void orderBookReceived(const QString& symbol, const OrderBook& book);
+
+private slots:
+	void onConnected();
+	void onDisconnected();
+	void onTextMessage(const QString& message);
+
+private:
+	QWebSocket* m_socket;
+	QTimer* m_reconnectTimer;
+	QString m_url;
+	QString m_approvalKey;
+	QSet<QString> m_symbols;	// 구독 중 (재연결 시 다시 보냄)
+	bool m_connected = false;
+	bool m_closing = false;
+
+	void send(const QString& symbol, bool subscribe);
+};
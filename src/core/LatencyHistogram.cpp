@@ -0,0 +1,76 @@
+#include "LatencyHistogram.h"
+#include <bit>
+#include <cmath>
+
+int LatencyHistogram::bucketIndex(qint64 micros)
+{
+	if (micros < 0) micros = 0;
+	if (micros > MaxValue) micros = MaxValue;
+	if (micros < SubBucketCount) return static_cast<int>(micros);
+
+	// 최상위 비트 위치 = 지수, 그 아래 5비트 = 칸
+	const int exponent = std::bit_width(static_cast<quint64>(micros)) - 1;
+	const int shift = exponent - SubBucketBits;
+	const int sub = static_cast<int>(micros >> shift) - SubBucketCount;
+	return SubBucketCount + shift * SubBucketCount + sub;
+}
+
+qint64 LatencyHistogram::bucketLowerBound(int index)
+{
+	if (index < SubBucketCount) return index;
+	const int shift = (index - SubBucketCount) / SubBucketCount;
+	const int sub = (index - SubBucketCount) % SubBucketCount;
+	return qint64(SubBucketCount + sub) << shift;
+}
+
+qint64 LatencyHistogram::bucketUpperBound(int index)
+{
+	if (index < SubBucketCount) return index;
+	const int shift = (index - SubBucketCount) / SubBucketCount;
+	const int sub = (index - SubBucketCount) % SubBucketCount;
+	return (qint64(SubBucketCount + sub + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(qint64 micros)
+{
+	if (micros < 0) micros = 0;
+
+	++m_buckets[bucketIndex(micros)];
+	if (m_count == 0 || micros < m_min) m_min = micros;
+	if (micros > m_max) m_max = micros;
+	m_sum += micros;
+	++m_count;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other)
+{
+	if (other.m_count == 0) return;
+
+	for (int i = 0; i < BucketCount; ++i)
+		m_buckets[i] += other.m_buckets[i];
+	if (m_count == 0 || other.m_min < m_min) m_min = other.m_min;
+	m_max = qMax(m_max, other.m_max);
+	m_sum += other.m_sum;
+	m_count += other.m_count;
+}
+
+void LatencyHistogram::reset()
+{
+	*this = LatencyHistogram();
+}
+
+qint64 LatencyHistogram::percentile(double p) const
+{
+	if (m_count == 0) return 0;
+
+	// 몇 번째 값인지 (1부터)
+	const quint64 rank = qMax<quint64>(1, static_cast<quint64>(std::ceil(p / 100.0 * m_count)));
+	quint64 seen = 0;
+	for (int i = 0; i < BucketCount; ++i)
+	{
+		seen += m_buckets[i];
+		if (seen >= rank)
+			return qMin(bucketUpperBound(i), m_max);
+	}
+	return m_max;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QtGlobal>
+#include <array>
+
+// HDR 스타일 로그-선형 히스토그램 (마이크로초 단위)
+// 2의 거듭제곱 구간마다 32칸으로 나눠서 상대오차 약 3% 이내, 메모리는 고정 (약 3KB)
+class LatencyHistogram
+{
+public:
+	static constexpr int SubBucketBits = 5;
+	static constexpr int SubBucketCount = 1 << SubBucketBits;	// 32
+	static constexpr int MaxExponent = 26;						// 2^27us ~= 134초까지
+	static constexpr int BucketCount = SubBucketCount * (MaxExponent - SubBucketBits + 2);
+	static constexpr qint64 MaxValue = (qint64(1) << (MaxExponent + 1)) - 1;
+
+	void record(qint64 micros);
+	void merge(const LatencyHistogram& other);
+	void reset();
+
+	quint64 count() const { return m_count; }
+	qint64 min() const { return m_count ? m_min : 0; }
+	qint64 max() const { return m_max; }
+	double mean() const { return m_count ? double(m_sum) / m_count : 0.0; }
+
+	// p: 0~100. 해당 칸의 상한값 (실제 최댓값을 넘지 않게)
+	qint64 percentile(double p) const;
+
+	static int bucketIndex(qint64 micros);
+	static qint64 bucketLowerBound(int index);
+	static qint64 bucketUpperBound(int index);
+
+private:
+	std::array<quint32, BucketCount> m_buckets{};
+	quint64 m_count = 0;
+	qint64 m_sum = 0;
+	qint64 m_min = 0;
+	qint64 m_max = 0;
+};
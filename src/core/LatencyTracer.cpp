@@ -0,0 +1,294 @@
+#include "LatencyTracer.h"
+#include <QNetworkReply>
+#include <QElapsedTimer>
+#include <QJsonArray>
+#include <QDateTime>
+
+QHash<quint64, LatencyTracer::Trace> LatencyTracer::m_active;
+std::deque<std::pair<qint64, quint64>> LatencyTracer::m_expiry;
+QMap<QString, LatencyTracer::EndpointStats> LatencyTracer::m_stats;
+std::vector<LatencyTracer::Trace> LatencyTracer::m_recent;
+int LatencyTracer::m_recentNext = 0;
+LatencyTracer::Counters LatencyTracer::m_counters;
+quint64 LatencyTracer::m_nextId = 1;
+QMutex LatencyTracer::m_mutex;
+
+namespace
+{
+	// 단조 시계 + 시작 시점의 벽시계 (내보낸 trace의 ts를 실제 시각과 맞추는 기준)
+	struct TraceClock
+	{
+		QElapsedTimer timer;
+		qint64 epochMicros;
+
+		TraceClock() : epochMicros(QDateTime::currentMSecsSinceEpoch() * 1000) { timer.start(); }
+	};
+
+	TraceClock& traceClock()
+	{
+		static TraceClock clock;
+		return clock;
+	}
+
+	QJsonObject histogramJson(const LatencyHistogram& histogram)
+	{
+		QJsonObject obj;
+		obj["count"] = static_cast<qint64>(histogram.count());
+		obj["min_us"] = histogram.min();
+		obj["mean_us"] = histogram.mean();
+		obj["p50_us"] = histogram.percentile(50);
+		obj["p90_us"] = histogram.percentile(90);
+		obj["p99_us"] = histogram.percentile(99);
+		obj["p999_us"] = histogram.percentile(99.9);
+		obj["max_us"] = histogram.max();
+		return obj;
+	}
+}
+
+qint64 LatencyTracer::nowMicros()
+{
+	// 0은 "미도달" 표시라 1us부터 시작
+	return traceClock().timer.nsecsElapsed() / 1000 + 1;
+}
+
+const char* LatencyTracer::intervalName(int interval)
+{
+	static const char* names[IntervalCount] = { "ttfb", "download", "parse", "apply", "paint", "total" };
+	return (interval >= 0 && interval < IntervalCount) ? names[interval] : "";
+}
+
+quint64 LatencyTracer::traceReply(QNetworkReply* reply, const QString& provider, const QString& endpoint,
+	const QString& symbol, bool untilPainted)
+{
+	if (!reply) return 0;
+
+	QMutexLocker locker(&m_mutex);
+	const qint64 now = nowMicros();
+	// 만료된 것만 앞에서 꺼내므로 요청마다 불러도 상각 O(1)
+	// (안 그려지는 행의 추적이 쌓이지 않고 unpainted로 바로 집계됨)
+	expireStale(now);
+
+	Trace trace;
+	trace.id = m_nextId++;
+	trace.provider = provider;
+	trace.endpoint = endpoint;
+	trace.symbol = symbol;
+	trace.untilPainted = untilPainted;
+	trace.at[static_cast<int>(TraceStage::Sent)] = now;
+	m_active.insert(trace.id, trace);
+	m_expiry.emplace_back(now, trace.id);
+	++m_counters.inFlight;
+
+	const quint64 id = trace.id;
+	reply->setProperty("TraceId", id);
+
+	// 처리 함수보다 먼저 연결되므로 Finished가 Parsed보다 앞에 찍힘
+	QObject::connect(reply, &QNetworkReply::readyRead, reply, [id]() { mark(id, TraceStage::FirstByte); });
+	QObject::connect(reply, &QNetworkReply::finished, reply, [reply, id]()
+	{
+		QMutexLocker locker(&m_mutex);
+		--m_counters.inFlight;
+
+		auto it = m_active.find(id);
+		if (it == m_active.end()) return;
+
+		// 본문 없는 응답은 readyRead가 안 올 수 있음
+		markLocked(id, TraceStage::FirstByte);
+		it->at[static_cast<int>(TraceStage::Finished)] = nowMicros();
+
+		if (reply->error() != QNetworkReply::NoError)
+		{
+			++m_counters.errors;
+			it->failed = true;
+		}
+
+		if (it->failed || !it->untilPainted)
+		{
+			complete(*it);
+			m_active.erase(it);
+		}
+	});
+
+	return id;
+}
+
+quint64 LatencyTracer::traceId(const QNetworkReply* reply)
+{
+	return reply ? reply->property("TraceId").toULongLong() : 0;
+}
+
+void LatencyTracer::mark(quint64 traceId, TraceStage stage)
+{
+	if (traceId == 0) return;
+
+	QMutexLocker locker(&m_mutex);
+	markLocked(traceId, stage);
+}
+
+void LatencyTracer::markLocked(quint64 traceId, TraceStage stage)
+{
+	auto it = m_active.find(traceId);
+	if (it == m_active.end()) return;	// 이미 끝났거나 만료됨
+
+	qint64& at = it->at[static_cast<int>(stage)];
+	if (at != 0) return;	// 처음 도달한 시각만
+	at = nowMicros();
+
+	if (stage == TraceStage::Painted)
+	{
+		complete(*it);
+		m_active.erase(it);
+	}
+}
+
+void LatencyTracer::complete(Trace& trace)
+{
+	EndpointStats& stats = m_stats[trace.provider + " " + trace.endpoint];
+	if (stats.requests == 0)
+	{
+		stats.provider = trace.provider;
+		stats.endpoint = trace.endpoint;
+	}
+	++stats.requests;
+	if (trace.failed) ++stats.errors;
+
+	// 연속한 두 단계가 모두 찍힌 구간만 기록
+	qint64 last = trace.at[0];
+	for (int i = 1; i < static_cast<int>(TraceStage::Count); ++i)
+	{
+		if (trace.at[i] == 0) continue;
+		if (trace.at[i - 1] != 0)
+			stats.intervals[i - 1].record(trace.at[i] - trace.at[i - 1]);
+		last = trace.at[i];
+	}
+	if (!trace.failed)
+		stats.intervals[Total].record(last - trace.at[0]);
+
+	if (m_recent.size() < RecentCapacity)
+	{
+		m_recent.push_back(trace);
+	}
+	else
+	{
+		m_recent[m_recentNext] = trace;
+		m_recentNext = (m_recentNext + 1) % RecentCapacity;
+	}
+}
+
+void LatencyTracer::expireStale(qint64 now)
+{
+	// 화면 밖 행이라 안 그려졌거나, 다음 응답에 덮인 추적
+	// 보낸 순서대로 쌓여 있으므로 앞에서부터 만료 시각이 안 된 것을 만나면 끝
+	while (!m_expiry.empty() && now - m_expiry.front().first > ExpireMicros)
+	{
+		auto it = m_active.find(m_expiry.front().second);
+		m_expiry.pop_front();
+		if (it == m_active.end()) continue;	// 이미 끝남
+
+		if (it->at[static_cast<int>(TraceStage::Finished)] != 0)
+		{
+			++m_counters.unpainted;
+			complete(*it);
+		}
+		m_active.erase(it);
+	}
+}
+
+void LatencyTracer::reset()
+{
+	// 진행 중인 요청은 계속 추적 (inFlight 유지)
+	QMutexLocker locker(&m_mutex);
+	m_stats.clear();
+	m_recent.clear();
+	m_recentNext = 0;
+	const int inFlight = m_counters.inFlight;
+	m_counters = Counters();
+	m_counters.inFlight = inFlight;
+}
+
+QJsonObject LatencyTracer::toJson()
+{
+	QMutexLocker locker(&m_mutex);
+	QJsonObject counters;
+	counters["in_flight"] = m_counters.inFlight;
+	counters["timeouts"] = static_cast<qint64>(m_counters.timeouts);
+	counters["errors"] = static_cast<qint64>(m_counters.errors);
+	counters["ticks"] = static_cast<qint64>(m_counters.ticks);
+	counters["unpainted"] = static_cast<qint64>(m_counters.unpainted);
+	counters["conflated"] = static_cast<qint64>(m_counters.conflated);
+
+	QJsonArray endpoints;
+	for (const EndpointStats& stats : m_stats)
+	{
+		QJsonObject intervals;
+		for (int i = 0; i < IntervalCount; ++i)
+		{
+			if (stats.intervals[i].count() > 0)
+				intervals[intervalName(i)] = histogramJson(stats.intervals[i]);
+		}
+
+		QJsonObject obj;
+		obj["provider"] = stats.provider;
+		obj["endpoint"] = stats.endpoint;
+		obj["requests"] = static_cast<qint64>(stats.requests);
+		obj["errors"] = static_cast<qint64>(stats.errors);
+		obj["intervals"] = intervals;
+		endpoints.append(obj);
+	}
+
+	QJsonObject root;
+	root["generated_at"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+	root["counters"] = counters;
+	root["endpoints"] = endpoints;
+	return root;
+}
+
+QJsonObject LatencyTracer::toChromeTrace()
+{
+	// 요청 하나 = async 이벤트 하나, 그 안에 단계별 구간을 중첩
+	QMutexLocker locker(&m_mutex);
+	QJsonArray events;
+	auto addEvent = [&events](const Trace& trace, const QString& name, const char* phase, qint64 at)
+	{
+		QJsonObject event;
+		event["name"] = name;
+		event["cat"] = trace.provider;
+		event["ph"] = phase;
+		event["id"] = QString::number(trace.id);
+		event["ts"] = traceClock().epochMicros + at;
+		event["pid"] = 1;
+		event["tid"] = 1;
+		if (phase[0] == 'b' && name == trace.endpoint)
+			event["args"] = QJsonObject{ { "symbol", trace.symbol }, { "failed", trace.failed } };
+		events.append(event);
+	};
+
+	// 링 버퍼를 오래된 순서로
+	const int n = static_cast<int>(m_recent.size());
+	const int start = (n == RecentCapacity) ? m_recentNext : 0;
+	for (int k = 0; k < n; ++k)
+	{
+		const Trace& trace = m_recent[(start + k) % n];
+
+		addEvent(trace, trace.endpoint, "b", trace.at[0]);
+
+		qint64 last = trace.at[0];
+		for (int i = 1; i < static_cast<int>(TraceStage::Count); ++i)
+		{
+			if (trace.at[i] == 0) continue;
+			if (trace.at[i - 1] != 0)
+			{
+				addEvent(trace, intervalName(i - 1), "b", trace.at[i - 1]);
+				addEvent(trace, intervalName(i - 1), "e", trace.at[i]);
+			}
+			last = trace.at[i];
+		}
+
+		addEvent(trace, trace.endpoint, "e", last);
+	}
+
+	QJsonObject root;
+	root["traceEvents"] = events;
+	root["displayTimeUnit"] = "ms";
+	return root;
+}
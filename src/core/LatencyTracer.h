@@ -0,0 +1,105 @@
+#pragma once
+
+#include <QString>
+#include <QHash>
+#include <QMap>
+#include <QJsonObject>
+#include <QMutex>
+#include <array>
+#include <deque>
+#include <vector>
+#include "LatencyHistogram.h"
+
+class QNetworkReply;
+
+// 요청 하나가 거치는 단계 (순서대로)
+enum class TraceStage
+{
+	Sent = 0,	// 요청 보냄
+	FirstByte,	// 응답 첫 바이트
+	Finished,	// 응답 수신 완료
+	Parsed,		// 파싱 완료
+	Applied,	// 모델 반영
+	Painted,	// 화면에 그려짐
+	Count
+};
+
+// 요청 단위 지연 추적
+// 요청을 보낼 때 traceReply()로 시작하고, 이후 단계는 StockData::traceId로 mark() 함
+// 단계 사이 간격을 제공자/엔드포인트별 히스토그램에 모음
+// 요청/파싱은 I/O 스레드, 반영/그리기는 GUI 스레드에서 찍으므로 모든 함수가 잠금을 잡음
+class LatencyTracer
+{
+public:
+	// 단계 간 구간 (히스토그램 단위). Total = 보냄 ~ 마지막 도달 단계
+	enum Interval { Ttfb = 0, Download, Parse, Apply, Paint, Total, IntervalCount };
+
+	struct Trace
+	{
+		quint64 id = 0;
+		QString provider;
+		QString endpoint;
+		QString symbol;
+		std::array<qint64, static_cast<int>(TraceStage::Count)> at{};	// 단계별 시각 (us, 0 = 미도달)
+		bool untilPainted = false;	// 화면 반영까지 추적하는 요청인지
+		bool failed = false;
+	};
+
+	struct EndpointStats
+	{
+		QString provider;
+		QString endpoint;
+		std::array<LatencyHistogram, IntervalCount> intervals;
+		quint64 requests = 0;
+		quint64 errors = 0;
+	};
+
+	struct Counters
+	{
+		int inFlight = 0;		// 응답 대기 중인 요청
+		quint64 timeouts = 0;	// NetworkUtils 타임아웃으로 끊은 요청
+		quint64 errors = 0;		// 네트워크 오류
+		quint64 ticks = 0;		// 모델에 반영된 시세 수 (누적)
+		quint64 unpainted = 0;	// 화면에 안 그려지고 만료된 추적
+		quint64 conflated = 0;	// 화면 반영 전에 같은 종목의 다음 틱에 덮인 시세 (QuoteMailbox)
+	};
+
+	// reply에 추적을 붙이고 Sent 기록. untilPainted면 화면 반영까지, 아니면 응답 완료에서 끝
+	static quint64 traceReply(QNetworkReply* reply, const QString& provider, const QString& endpoint,
+		const QString& symbol = QString(), bool untilPainted = false);
+	static quint64 traceId(const QNetworkReply* reply);
+
+	static void mark(quint64 traceId, TraceStage stage);
+	static void countTick() { QMutexLocker locker(&m_mutex); ++m_counters.ticks; }
+	static void countTimeout() { QMutexLocker locker(&m_mutex); ++m_counters.timeouts; }
+	static void countConflated(quint64 count) { QMutexLocker locker(&m_mutex); m_counters.conflated += count; }
+
+	// 잠금 안에서 복사한 스냅샷
+	static Counters counters() { QMutexLocker locker(&m_mutex); return m_counters; }
+	static QMap<QString, EndpointStats> endpointStats() { QMutexLocker locker(&m_mutex); return m_stats; }
+	static const char* intervalName(int interval);
+	static void reset();
+
+	// 요약 (히스토그램 백분위수) / chrome://tracing, Perfetto에서 여는 형식
+	static QJsonObject toJson();
+	static QJsonObject toChromeTrace();
+
+private:
+	static constexpr qint64 ExpireMicros = 30000000;	// 30초 지나도 안 끝난 추적은 만료
+	static constexpr int RecentCapacity = 4096;		// Chrome trace 내보내기용 최근 추적
+
+	static qint64 nowMicros();
+	// 아래는 m_mutex를 잡은 상태에서만 호출
+	static void markLocked(quint64 traceId, TraceStage stage);
+	static void complete(Trace& trace);
+	static void expireStale(qint64 now);
+
+	static QHash<quint64, Trace> m_active;
+	static std::deque<std::pair<qint64, quint64>> m_expiry;	// (보낸 시각, id) 보낸 순서. 끝난 추적도 만료 시각까지 남음
+	static QMap<QString, EndpointStats> m_stats;
+	static std::vector<Trace> m_recent;
+	static int m_recentNext;
+	static Counters m_counters;
+	static quint64 m_nextId;
+	static QMutex m_mutex;
+};
@@ -0,0 +1,230 @@
+#pragma once
+#include <QtGlobal>
+#include <array>
+
+// 시장 구분 (MST 파일 단위)
+enum class Market : quint8
+{
+	Kospi,
+	Kosdaq,
+	Count
+};
+
+// MST 레코드 뒤쪽 고정 길이 필드 (한국투자증권 종목정보파일 기준)
+// 두 시장이 같은 필드는 같은 ID, 한쪽에만 있는 필드는 다른 시장 표에서 빠짐
+enum class MstField : quint8
+{
+	GroupCode,				// 증권그룹구분코드 (ST, EF, EN, FS ...)
+	MarketCapSize,			// 시가총액 규모 (0 없음, 1 대, 2 중, 3 소)
+	IndustryLarge,			// 지수업종 대분류
+	IndustryMedium,			// 지수업종 중분류
+	IndustrySmall,			// 지수업종 소분류
+	Manufacturing,			// 제조업 (KOSPI)
+	Venture,				// 벤처기업 (KOSDAQ)
+	LowLiquidity,			// 저유동성
+	GovernanceIndex,		// 지배구조지수 종목 (KOSPI)
+	Kospi200Sector,			// KOSPI200 섹터업종 (KOSPI)
+	Kospi100,				// (KOSPI)
+	Kospi50,				// (KOSPI)
+	Krx,
+	EtpType,				// ETP 상품구분
+	ElwIssued,				// ELW 발행 (KOSPI)
+	Krx100,
+	KrxAuto,
+	KrxSemiconductor,
+	KrxBio,
+	KrxBank,
+	Spac,
+	KrxEnergyChemical,
+	KrxSteel,
+	ShortTermOverheat,		// 단기과열 구분
+	KrxMedia,
+	KrxConstruction,
+	Reserved1,				// (KOSPI, 미사용)
+	InvestmentCaution,		// 투자주의환기 (KOSDAQ)
+	KrxSecurities,
+	KrxShip,
+	KrxInsurance,
+	KrxTransport,
+	Sri,					// SRI (KOSPI)
+	Kosdaq150,				// (KOSDAQ)
+	BasePrice,				// 기준가
+	TradingUnit,			// 매매수량단위
+	AfterHoursUnit,			// 시간외 수량단위
+	Halted,					// 거래정지
+	Liquidation,			// 정리매매
+	Administrative,			// 관리종목
+	MarketWarning,			// 시장경고 구분
+	WarningNotice,			// 경고예고
+	UnfaithfulDisclosure,	// 불성실공시
+	BackdoorListing,		// 우회상장
+	LockType,				// 락구분
+	ParValueChange,			// 액면변경 구분
+	CapitalIncrease,		// 증자구분
+	MarginRate,				// 증거금비율 (%)
+	CreditAvailable,		// 신용가능
+	CreditDays,				// 신용기간
+	PrevVolume,				// 전일 거래량
+	ParValue,				// 액면가
+	ListingDate,			// 상장일자 (yyyyMMdd)
+	ListedShares,			// 상장주수 (천주)
+	Capital,				// 자본금
+	FiscalMonth,			// 결산월
+	IpoPrice,				// 공모가
+	Preferred,				// 우선주 구분
+	ShortSellOverheat,		// 공매도과열
+	AbnormalSurge,			// 이상급등
+	Krx300,
+	KospiMember,			// KOSPI 지수 편입 (KOSPI)
+	Sales,					// 매출액 (억)
+	OperatingProfit,		// 영업이익 (억)
+	OrdinaryProfit,			// 경상이익 (억)
+	NetIncome,				// 당기순이익 (억)
+	Roe,					// ROE (%)
+	BaseYearMonth,			// 재무 기준년월 (yyyyMM..)
+	MarketCap,				// 시가총액 (억)
+	GroupCompanyCode,		// 그룹사 코드
+	CreditLimitExceeded,	// 회사 신용한도 초과
+	CollateralLoan,			// 담보대출 가능
+	StockLending,			// 대주 가능
+	Count
+};
+
+// 필드 값 해석 방식
+enum class MstFieldType : quint8
+{
+	Text,		// 원본 바이트 그대로 (코드류)
+	Flag,		// 'Y' = 1, 그 외 0
+	Integer,	// 부호 있는 정수 (공백은 0)
+	Decimal		// 소수점 포함 숫자
+};
+
+struct MstFieldSpec
+{
+	MstField field;
+	quint8 width;
+	MstFieldType type;
+	qint16 offset = 0;		// 뒤쪽 고정 부분 시작부터 (withOffsets가 채움)
+};
+
+namespace MstSchema
+{
+	constexpr int FieldCount = static_cast<int>(MstField::Count);
+	constexpr int FrontLength = 21;		// 단축코드 9 + 표준코드 12 (그 뒤 이름은 가변)
+
+	// 너비만 적은 표에 시작 위치를 컴파일 시간에 채움
+	template <size_t N>
+	constexpr std::array<MstFieldSpec, N> withOffsets(const MstFieldSpec (&specs)[N])
+	{
+		std::array<MstFieldSpec, N> result{};
+		int offset = 0;
+		for (size_t i = 0; i < N; ++i)
+		{
+			result[i] = specs[i];
+			result[i].offset = static_cast<qint16>(offset);
+			offset += specs[i].width;
+		}
+		return result;
+	}
+
+	template <size_t N>
+	constexpr int totalWidth(const std::array<MstFieldSpec, N>& specs)
+	{
+		return specs[N - 1].offset + specs[N - 1].width;
+	}
+
+	using T = MstFieldType;
+	using F = MstField;
+
+	constexpr MstFieldSpec KospiWidths[] = {
+		{ F::GroupCode, 2, T::Text }, { F::MarketCapSize, 1, T::Integer },
+		{ F::IndustryLarge, 4, T::Integer }, { F::IndustryMedium, 4, T::Integer }, { F::IndustrySmall, 4, T::Integer },
+		{ F::Manufacturing, 1, T::Flag }, { F::LowLiquidity, 1, T::Flag }, { F::GovernanceIndex, 1, T::Flag },
+		{ F::Kospi200Sector, 1, T::Text }, { F::Kospi100, 1, T::Flag }, { F::Kospi50, 1, T::Flag },
+		{ F::Krx, 1, T::Flag }, { F::EtpType, 1, T::Text }, { F::ElwIssued, 1, T::Flag },
+		{ F::Krx100, 1, T::Flag }, { F::KrxAuto, 1, T::Flag }, { F::KrxSemiconductor, 1, T::Flag },
+		{ F::KrxBio, 1, T::Flag }, { F::KrxBank, 1, T::Flag }, { F::Spac, 1, T::Flag },
+		{ F::KrxEnergyChemical, 1, T::Flag }, { F::KrxSteel, 1, T::Flag }, { F::ShortTermOverheat, 1, T::Integer },
+		{ F::KrxMedia, 1, T::Flag }, { F::KrxConstruction, 1, T::Flag }, { F::Reserved1, 1, T::Text },
+		{ F::KrxSecurities, 1, T::Flag }, { F::KrxShip, 1, T::Flag }, { F::KrxInsurance, 1, T::Flag },
+		{ F::KrxTransport, 1, T::Flag }, { F::Sri, 1, T::Flag },
+		{ F::BasePrice, 9, T::Integer }, { F::TradingUnit, 5, T::Integer }, { F::AfterHoursUnit, 5, T::Integer },
+		{ F::Halted, 1, T::Flag }, { F::Liquidation, 1, T::Flag }, { F::Administrative, 1, T::Flag },
+		{ F::MarketWarning, 2, T::Integer }, { F::WarningNotice, 1, T::Flag }, { F::UnfaithfulDisclosure, 1, T::Flag },
+		{ F::BackdoorListing, 1, T::Flag }, { F::LockType, 2, T::Integer }, { F::ParValueChange, 2, T::Integer },
+		{ F::CapitalIncrease, 2, T::Integer }, { F::MarginRate, 3, T::Integer }, { F::CreditAvailable, 1, T::Flag },
+		{ F::CreditDays, 3, T::Integer }, { F::PrevVolume, 12, T::Integer }, { F::ParValue, 12, T::Integer },
+		{ F::ListingDate, 8, T::Integer }, { F::ListedShares, 15, T::Integer }, { F::Capital, 21, T::Integer },
+		{ F::FiscalMonth, 2, T::Integer }, { F::IpoPrice, 7, T::Integer }, { F::Preferred, 1, T::Integer },
+		{ F::ShortSellOverheat, 1, T::Flag }, { F::AbnormalSurge, 1, T::Flag }, { F::Krx300, 1, T::Flag },
+		{ F::KospiMember, 1, T::Flag },
+		{ F::Sales, 9, T::Integer }, { F::OperatingProfit, 9, T::Integer }, { F::OrdinaryProfit, 9, T::Integer },
+		{ F::NetIncome, 5, T::Integer }, { F::Roe, 9, T::Decimal }, { F::BaseYearMonth, 8, T::Integer },
+		{ F::MarketCap, 9, T::Integer }, { F::GroupCompanyCode, 3, T::Text },
+		{ F::CreditLimitExceeded, 1, T::Flag }, { F::CollateralLoan, 1, T::Flag }, { F::StockLending, 1, T::Flag },
+	};
+
+	constexpr MstFieldSpec KosdaqWidths[] = {
+		{ F::GroupCode, 2, T::Text }, { F::MarketCapSize, 1, T::Integer },
+		{ F::IndustryLarge, 4, T::Integer }, { F::IndustryMedium, 4, T::Integer }, { F::IndustrySmall, 4, T::Integer },
+		{ F::Venture, 1, T::Flag }, { F::LowLiquidity, 1, T::Flag }, { F::Krx, 1, T::Flag },
+		{ F::EtpType, 1, T::Text }, { F::Krx100, 1, T::Flag }, { F::KrxAuto, 1, T::Flag },
+		{ F::KrxSemiconductor, 1, T::Flag }, { F::KrxBio, 1, T::Flag }, { F::KrxBank, 1, T::Flag },
+		{ F::Spac, 1, T::Flag }, { F::KrxEnergyChemical, 1, T::Flag }, { F::KrxSteel, 1, T::Flag },
+		{ F::ShortTermOverheat, 1, T::Integer }, { F::KrxMedia, 1, T::Flag }, { F::KrxConstruction, 1, T::Flag },
+		{ F::InvestmentCaution, 1, T::Flag }, { F::KrxSecurities, 1, T::Flag }, { F::KrxShip, 1, T::Flag },
+		{ F::KrxInsurance, 1, T::Flag }, { F::KrxTransport, 1, T::Flag }, { F::Kosdaq150, 1, T::Flag },
+		{ F::BasePrice, 9, T::Integer }, { F::TradingUnit, 5, T::Integer }, { F::AfterHoursUnit, 5, T::Integer },
+		{ F::Halted, 1, T::Flag }, { F::Liquidation, 1, T::Flag }, { F::Administrative, 1, T::Flag },
+		{ F::MarketWarning, 2, T::Integer }, { F::WarningNotice, 1, T::Flag }, { F::UnfaithfulDisclosure, 1, T::Flag },
+		{ F::BackdoorListing, 1, T::Flag }, { F::LockType, 2, T::Integer }, { F::ParValueChange, 2, T::Integer },
+		{ F::CapitalIncrease, 2, T::Integer }, { F::MarginRate, 3, T::Integer }, { F::CreditAvailable, 1, T::Flag },
+		{ F::CreditDays, 3, T::Integer }, { F::PrevVolume, 12, T::Integer }, { F::ParValue, 12, T::Integer },
+		{ F::ListingDate, 8, T::Integer }, { F::ListedShares, 15, T::Integer }, { F::Capital, 21, T::Integer },
+		{ F::FiscalMonth, 2, T::Integer }, { F::IpoPrice, 7, T::Integer }, { F::Preferred, 1, T::Integer },
+		{ F::ShortSellOverheat, 1, T::Flag }, { F::AbnormalSurge, 1, T::Flag }, { F::Krx300, 1, T::Flag },
+		{ F::Sales, 9, T::Integer }, { F::OperatingProfit, 9, T::Integer }, { F::OrdinaryProfit, 9, T::Integer },
+		{ F::NetIncome, 5, T::Integer }, { F::Roe, 9, T::Decimal }, { F::BaseYearMonth, 8, T::Integer },
+		{ F::MarketCap, 9, T::Integer }, { F::GroupCompanyCode, 3, T::Text },
+		{ F::CreditLimitExceeded, 1, T::Flag }, { F::CollateralLoan, 1, T::Flag }, { F::StockLending, 1, T::Flag },
+	};
+
+	constexpr auto Kospi = withOffsets(KospiWidths);
+	constexpr auto Kosdaq = withOffsets(KosdaqWidths);
+
+	// 실제 파일 길이와 맞는지 컴파일 시간에 확인 (KOSPI 288, KOSDAQ 282바이트 = 앞 21 + 이름 40 + 뒤)
+	static_assert(totalWidth(Kospi) == 227, "KOSPI MST 뒤쪽 길이가 맞지 않음");
+	static_assert(totalWidth(Kosdaq) == 221, "KOSDAQ MST 뒤쪽 길이가 맞지 않음");
+
+	constexpr int tailLength(Market market)
+	{
+		return market == Market::Kospi ? totalWidth(Kospi) : totalWidth(Kosdaq);
+	}
+
+	// 필드 ID -> 표 위치 (없는 필드는 -1), 시장별로 컴파일 시간에 만듦
+	template <size_t N>
+	constexpr std::array<qint8, FieldCount> buildLookup(const std::array<MstFieldSpec, N>& specs)
+	{
+		std::array<qint8, FieldCount> lookup{};
+		for (qint8& index : lookup)
+			index = -1;
+		for (size_t i = 0; i < N; ++i)
+			lookup[static_cast<int>(specs[i].field)] = static_cast<qint8>(i);
+		return lookup;
+	}
+
+	constexpr auto KospiLookup = buildLookup(Kospi);
+	constexpr auto KosdaqLookup = buildLookup(Kosdaq);
+
+	// 해당 시장에 없는 필드면 nullptr
+	constexpr const MstFieldSpec* find(Market market, MstField field)
+	{
+		const int index = market == Market::Kospi ? KospiLookup[static_cast<int>(field)] : KosdaqLookup[static_cast<int>(field)];
+		if (index < 0) return nullptr;
+		return market == Market::Kospi ? &Kospi[index] : &Kosdaq[index];
+	}
+
+	static_assert(find(Market::Kospi, MstField::BasePrice)->offset == 41, "KOSPI 기준가 위치");
+	static_assert(find(Market::Kosdaq, MstField::BasePrice)->offset == 36, "KOSDAQ 기준가 위치");
+	static_assert(find(Market::Kosdaq, MstField::Kospi200Sector) == nullptr, "KOSDAQ에는 KOSPI200 섹터 없음");
+}
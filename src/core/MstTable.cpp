@@ -0,0 +1,305 @@
+#include "MstTable.h"
+#include <QFile>
+#include <QStringDecoder>
+#include <QDebug>
+#include <algorithm>
+#include <string_view>
+
+namespace
+{
+	// 공백 패딩된 고정폭 숫자 ("  -0001234", "000000.83")
+	qint64 parseInteger(QByteArrayView bytes)
+	{
+		qint64 value = 0;
+		bool negative = false;
+		for (char c : bytes)
+		{
+			if (c >= '0' && c <= '9') value = value * 10 + (c - '0');
+			else if (c == '-') negative = true;
+			else if (c == '.') break;
+		}
+		return negative ? -value : value;
+	}
+
+	std::string_view view(QByteArrayView bytes)
+	{
+		return std::string_view(bytes.data(), static_cast<size_t>(bytes.size()));
+	}
+
+	double parseDecimal(QByteArrayView bytes)
+	{
+		double value = 0.0;
+		double scale = 0.0;		// 소수점 이후 자리값
+		bool negative = false;
+		for (char c : bytes)
+		{
+			if (c >= '0' && c <= '9')
+			{
+				if (scale == 0.0)
+					value = value * 10.0 + (c - '0');
+				else
+				{
+					value += (c - '0') * scale;
+					scale *= 0.1;
+				}
+			}
+			else if (c == '-') negative = true;
+			else if (c == '.') scale = 0.1;
+		}
+		return negative ? -value : value;
+	}
+}
+
+bool MstTable::load(const QString& path, Market market)
+{
+	QFile file(path);
+	if (!file.open(QIODevice::ReadOnly))
+	{
+		qDebug() << "[MstTable] 파일을 찾을 수 없음:" << path;
+		return false;
+	}
+
+	const quint32 source = static_cast<quint32>(m_sources.size());
+	m_sources.push_back(file.readAll());
+	const QByteArray& bytes = m_sources.back();
+	const int minLength = MstSchema::FrontLength + MstSchema::tailLength(market);
+	const int before = count();
+
+	// 줄 단위로 시작 위치만 기록
+	qsizetype start = 0;
+	while (start < bytes.size())
+	{
+		qsizetype end = bytes.indexOf('\n', start);
+		if (end < 0) end = bytes.size();
+		qsizetype length = end - start;
+		if (length > 0 && bytes.at(start + length - 1) == '\r')
+			--length;
+
+		if (length >= minLength)
+			m_rows.push_back({ source, static_cast<quint32>(start), static_cast<quint16>(length), market });
+		start = end + 1;
+	}
+
+	invalidate();
+	qDebug() << "[MstTable]" << path << count() - before << "종목";
+	return true;
+}
+
+void MstTable::clear()
+{
+	m_sources.clear();
+	m_rows.clear();
+	invalidate();
+}
+
+void MstTable::invalidate()
+{
+	for (int f = 0; f < MstSchema::FieldCount; ++f)
+	{
+		m_integers[f].clear();
+		m_decimals[f].clear();
+		m_flags[f].clear();
+		m_decoded[f] = false;
+	}
+
+	// 코드 순 색인
+	m_byCode.resize(m_rows.size());
+	for (int i = 0; i < count(); ++i)
+		m_byCode[i] = i;
+	std::sort(m_byCode.begin(), m_byCode.end(),
+		[this](int a, int b) { return view(codeBytes(a)) < view(codeBytes(b)); });
+}
+
+QByteArrayView MstTable::record(int row) const
+{
+	const Row& r = m_rows[row];
+	return QByteArrayView(m_sources[r.source]).sliced(r.offset, r.length);
+}
+
+QByteArrayView MstTable::codeBytes(int row) const
+{
+	// 단축코드 9바이트, 7자리 이상이면 맨 앞 구분 문자('A' 등) 제거 (StockCodeMap과 같은 규칙)
+	QByteArrayView code = record(row).first(9).trimmed();
+	return code.size() >= 7 ? code.sliced(1) : code;
+}
+
+QString MstTable::code(int row) const
+{
+	return QString::fromLatin1(codeBytes(row));
+}
+
+QByteArrayView MstTable::nameBytes(int row) const
+{
+	const QByteArrayView bytes = record(row);
+	const int tail = MstSchema::tailLength(m_rows[row].market);
+	return bytes.sliced(MstSchema::FrontLength, bytes.size() - tail - MstSchema::FrontLength);
+}
+
+QString MstTable::name(int row) const
+{
+	auto toUtf16 = QStringDecoder(QStringDecoder::System);
+	return QString(toUtf16(nameBytes(row))).trimmed();
+}
+
+int MstTable::indexOf(const QString& code) const
+{
+	const QByteArray bytes = code.toLatin1();
+	const std::string_view key(bytes.constData(), static_cast<size_t>(bytes.size()));
+	auto it = std::lower_bound(m_byCode.begin(), m_byCode.end(), key,
+		[this](int row, std::string_view value) { return view(codeBytes(row)) < value; });
+	if (it == m_byCode.end() || view(codeBytes(*it)) != key)
+		return -1;
+	return *it;
+}
+
+QByteArrayView MstTable::fieldBytes(int row, MstField field) const
+{
+	const Market market = m_rows[row].market;
+	const MstFieldSpec* spec = MstSchema::find(market, field);
+	if (!spec) return QByteArrayView();
+
+	// 이름 길이와 상관없이 뒤쪽 고정 부분은 줄 끝 기준
+	const QByteArrayView bytes = record(row);
+	const qsizetype tailStart = bytes.size() - MstSchema::tailLength(market);
+	return bytes.sliced(tailStart + spec->offset, spec->width);
+}
+
+QByteArrayView MstTable::text(int row, MstField field) const
+{
+	return fieldBytes(row, field).trimmed();
+}
+
+void MstTable::decode(MstField field) const
+{
+	const int f = static_cast<int>(field);
+	if (m_decoded[f]) return;
+	m_decoded[f] = true;
+
+	// 시장마다 타입은 같으므로 어느 쪽이든 먼저 찾은 정의를 씀
+	const MstFieldSpec* spec = MstSchema::find(Market::Kospi, field);
+	if (!spec) spec = MstSchema::find(Market::Kosdaq, field);
+	if (!spec) return;
+
+	const int n = count();
+	switch (spec->type)
+	{
+	case MstFieldType::Integer:
+		m_integers[f].resize(n);
+		for (int i = 0; i < n; ++i)
+			m_integers[f][i] = parseInteger(fieldBytes(i, field));
+		break;
+	case MstFieldType::Decimal:
+		m_decimals[f].resize(n);
+		for (int i = 0; i < n; ++i)
+			m_decimals[f][i] = parseDecimal(fieldBytes(i, field));
+		break;
+	case MstFieldType::Flag:
+		m_flags[f].resize(n);
+		for (int i = 0; i < n; ++i)
+		{
+			const QByteArrayView bytes = fieldBytes(i, field);
+			m_flags[f][i] = (!bytes.isEmpty() && bytes.at(0) == 'Y') ? 1 : 0;
+		}
+		break;
+	case MstFieldType::Text:
+		break;
+	}
+}
+
+const std::vector<qint64>& MstTable::integers(MstField field) const
+{
+	decode(field);
+	std::vector<qint64>& column = m_integers[static_cast<int>(field)];
+	// 타입이 다른 필드를 정수로 요청하면 0으로 채운 열
+	if (column.size() != m_rows.size())
+		column.assign(m_rows.size(), 0);
+	return column;
+}
+
+const std::vector<double>& MstTable::decimals(MstField field) const
+{
+	decode(field);
+	std::vector<double>& column = m_decimals[static_cast<int>(field)];
+	if (column.size() != m_rows.size())
+		column.assign(m_rows.size(), 0.0);
+	return column;
+}
+
+const std::vector<quint8>& MstTable::flags(MstField field) const
+{
+	decode(field);
+	std::vector<quint8>& column = m_flags[static_cast<int>(field)];
+	if (column.size() != m_rows.size())
+		column.assign(m_rows.size(), 0);
+	return column;
+}
+
+qsizetype MstTable::memoryUsage() const
+{
+	qsizetype bytes = 0;
+	for (const QByteArray& source : m_sources)
+		bytes += source.capacity();
+	bytes += static_cast<qsizetype>(m_rows.capacity() * sizeof(Row) + m_byCode.capacity() * sizeof(int));
+	for (int f = 0; f < MstSchema::FieldCount; ++f)
+	{
+		bytes += static_cast<qsizetype>(m_integers[f].capacity() * sizeof(qint64));
+		bytes += static_cast<qsizetype>(m_decimals[f].capacity() * sizeof(double));
+		bytes += static_cast<qsizetype>(m_flags[f].capacity());
+	}
+	return bytes;
+}
+
+void MstTable::prefetch(const MstTable& reference) const
+{
+	for (int f = 0; f < MstSchema::FieldCount; ++f)
+	{
+		if (reference.m_decoded[f])
+			decode(static_cast<MstField>(f));
+	}
+}
+
+MstDelta MstTable::diff(const MstTable& before, const MstTable& after)
+{
+	MstDelta delta;
+	size_t i = 0;
+	size_t j = 0;
+	while (i < before.m_byCode.size() || j < after.m_byCode.size())
+	{
+		const int oldRow = i < before.m_byCode.size() ? before.m_byCode[i] : -1;
+		const int newRow = j < after.m_byCode.size() ? after.m_byCode[j] : -1;
+
+		int order = 0;		// <0 = 이전에만 있음, >0 = 새로만 있음
+		if (oldRow < 0) order = 1;
+		else if (newRow < 0) order = -1;
+		else
+		{
+			const std::string_view a = view(before.codeBytes(oldRow));
+			const std::string_view b = view(after.codeBytes(newRow));
+			order = a < b ? -1 : (b < a ? 1 : 0);
+		}
+
+		if (order < 0)
+		{
+			delta.removed.append(before.code(oldRow));
+			++i;
+		}
+		else if (order > 0)
+		{
+			delta.added.append({ after.code(newRow), after.name(newRow), after.market(newRow) });
+			++j;
+		}
+		else
+		{
+			// 공백 패딩까지 같으면 디코딩 없이 통과
+			if (view(before.nameBytes(oldRow)) != view(after.nameBytes(newRow)))
+			{
+				const QString name = after.name(newRow);
+				if (name != before.name(oldRow))
+					delta.renamed.append({ after.code(newRow), name, after.market(newRow) });
+			}
+			++i;
+			++j;
+		}
+	}
+	return delta;
+}
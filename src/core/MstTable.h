@@ -0,0 +1,88 @@
+#pragma once
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+#include <vector>
+#include "MstSchema.h"
+
+// 두 마스터 사이의 종목 변경분 (신규 상장 / 상장 폐지 / 이름 변경)
+struct MstDelta
+{
+	struct Entry
+	{
+		QString code;
+		QString name;
+		Market market;
+	};
+
+	QVector<Entry> added;
+	QVector<Entry> renamed;
+	QStringList removed;
+
+	bool isEmpty() const { return added.isEmpty() && renamed.isEmpty() && removed.isEmpty(); }
+};
+
+// MST 종목 마스터 전체 필드 (열 단위, 필요한 열만 늦게 해석)
+//
+// 파일 바이트는 그대로 들고 있고 행마다 레코드 시작 위치만 기억함.
+// 숫자/플래그 열은 처음 요청할 때 전 종목을 한 번에 해석해서 타입 배열로 저장 -> 이후 O(1)
+// 종목마다 필드 수십 개를 QString으로 만드는 것보다 메모리가 훨씬 적음
+//
+// 해석 캐시를 채우는 접근자가 const라 여러 스레드에서 동시에 쓰면 안 됨
+class MstTable
+{
+public:
+	bool load(const QString& path, Market market);
+	void clear();
+
+	int count() const { return static_cast<int>(m_rows.size()); }
+
+	Market market(int row) const { return m_rows[row].market; }
+	QString code(int row) const;				// "005930" (앞 'A' 등 제거)
+	QString name(int row) const;				// 호출할 때마다 디코딩 (캐시 안 함)
+	int indexOf(const QString& code) const;		// 코드 순 정렬 배열에서 이진 탐색
+
+	// 원본 바이트 (Text 필드용, 앞뒤 공백 제거). 그 시장에 없는 필드면 빈 값
+	QByteArrayView text(int row, MstField field) const;
+
+	// 없는 필드/해석 불가 값은 0
+	const std::vector<qint64>& integers(MstField field) const;
+	const std::vector<double>& decimals(MstField field) const;
+	const std::vector<quint8>& flags(MstField field) const;
+
+	// 파일 원본 + 해석된 열 (바이트)
+	qsizetype memoryUsage() const;
+
+	// reference에서 이미 해석된 열을 미리 해석 (백그라운드에서 새로 읽은 표를 넘기기 전에)
+	void prefetch(const MstTable& reference) const;
+
+	// 코드 순으로 두 표를 한 번 훑어 변경분 계산 (O(n), 이름은 바이트가 다를 때만 디코딩)
+	static MstDelta diff(const MstTable& before, const MstTable& after);
+
+private:
+	struct Row
+	{
+		quint32 source;		// m_sources 위치
+		quint32 offset;		// 레코드 시작
+		quint16 length;		// 줄바꿈 제외 길이
+		Market market;
+	};
+
+	std::vector<QByteArray> m_sources;			// 파일 원본
+	std::vector<Row> m_rows;
+	std::vector<int> m_byCode;					// 코드 순 행 번호
+
+	mutable std::vector<qint64> m_integers[MstSchema::FieldCount];
+	mutable std::vector<double> m_decimals[MstSchema::FieldCount];
+	mutable std::vector<quint8> m_flags[MstSchema::FieldCount];
+	mutable bool m_decoded[MstSchema::FieldCount] = {};
+
+	QByteArrayView record(int row) const;
+	QByteArrayView codeBytes(int row) const;
+	QByteArrayView nameBytes(int row) const;
+	QByteArrayView fieldBytes(int row, MstField field) const;
+	void decode(MstField field) const;
+	void invalidate();
+};
@@ -0,0 +1,120 @@
+#include "MstWatcher.h"
+#include <QFileInfo>
+#include <QElapsedTimer>
+#include <QDebug>
+
+namespace
+{
+	constexpr int DebounceMs = 1000;
+}
+
+MstWatcher::MstWatcher(QObject* parent) : QObject(parent)
+{
+	m_watcher = new QFileSystemWatcher(this);
+	connect(m_watcher, &QFileSystemWatcher::fileChanged, this, &MstWatcher::onFileChanged);
+
+	m_debounceTimer = new QTimer(this);
+	m_debounceTimer->setSingleShot(true);
+	m_debounceTimer->setInterval(DebounceMs);
+	connect(m_debounceTimer, &QTimer::timeout, this, &MstWatcher::reload);
+}
+
+MstWatcher::~MstWatcher()
+{
+	// 작업 스레드가 이 객체를 가리키므로 끝날 때까지 기다림
+	if (m_thread)
+	{
+		m_thread->wait();
+		delete m_thread;
+	}
+}
+
+void MstWatcher::addFile(const QString& path, Market market)
+{
+	m_files.append({ QFileInfo(path).absoluteFilePath(), market });
+}
+
+void MstWatcher::start(const MstTable& current)
+{
+	m_current = current;
+	watchExisting();
+}
+
+void MstWatcher::watchExisting()
+{
+	// 새 파일로 바꿔치기(이름 변경)하면 감시 목록에서 빠지므로 다시 등록
+	const QStringList watched = m_watcher->files();
+	for (const File& file : m_files)
+	{
+		if (!watched.contains(file.path) && QFileInfo::exists(file.path))
+			m_watcher->addPath(file.path);
+	}
+}
+
+void MstWatcher::onFileChanged(const QString& path)
+{
+	qDebug() << "[MstWatcher] 변경 감지:" << path;
+	m_debounceTimer->start();
+}
+
+void MstWatcher::reload()
+{
+	watchExisting();
+	if (m_thread)
+	{
+		m_pending = true;
+		return;
+	}
+
+	// 작업 스레드에는 사본만 넘김 (GUI 쪽 표와 공유하는 상태 없음)
+	const QVector<File> files = m_files;
+	const MstTable current = m_current;
+	m_thread = QThread::create([this, files, current]()
+	{
+		QElapsedTimer timer;
+		timer.start();
+
+		MstTable table;
+		for (const File& file : files)
+		{
+			if (!table.load(file.path, file.market))
+				return;		// 쓰는 도중 등 -> 다음 변경 때 다시
+		}
+		table.prefetch(current);
+		MstDelta delta = MstTable::diff(current, table);
+
+		qDebug() << "[MstWatcher] 다시 읽기" << timer.elapsed() << "ms, 신규" << delta.added.size()
+		         << "폐지" << delta.removed.size() << "이름 변경" << delta.renamed.size();
+
+		QMetaObject::invokeMethod(this, [this, table = std::move(table), delta = std::move(delta)]() mutable
+		{
+			finishReload(std::move(table), std::move(delta));
+		}, Qt::QueuedConnection);
+	});
+	m_thread->setObjectName("MstWatcher");
+	connect(m_thread, &QThread::finished, this, [this]()
+	{
+		m_thread->deleteLater();
+		m_thread = nullptr;
+		if (m_pending)
+		{
+			m_pending = false;
+			reload();
+		}
+	});
+	m_thread->start(QThread::LowPriority);
+}
+
+void MstWatcher::finishReload(MstTable table, MstDelta delta)
+{
+	// 파일 하나가 통째로 비었으면 (쓰는 도중) 전 종목 폐지로 보이므로 무시
+	if (table.count() == 0 || delta.removed.size() > m_current.count() / 2)
+	{
+		qDebug() << "[MstWatcher] 변경분이 비정상적으로 커서 무시:" << delta.removed.size();
+		return;
+	}
+
+	m_current = table;
+	if (!delta.isEmpty())
+		emit masterReloaded(table, delta);
+}
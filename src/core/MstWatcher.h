@@ -0,0 +1,51 @@
+#pragma once
+
+#include <QObject>
+#include <QFileSystemWatcher>
+#include <QThread>
+#include <QTimer>
+#include <QVector>
+#include "MstTable.h"
+
+// MST 파일이 바뀌면 백그라운드에서 다시 읽고 현재 마스터와의 변경분만 알려줌
+// 파일 읽기/해석/비교는 작업 스레드에서, 결과 전달(masterReloaded)은 이 객체의 스레드(GUI)에서
+class MstWatcher : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit MstWatcher(QObject* parent = nullptr);
+	~MstWatcher();
+
+	void addFile(const QString& path, Market market);
+
+	// 지금 쓰고 있는 마스터 (비교 기준). 원본 바이트는 암시적 공유라 복사 비용이 작음
+	void start(const MstTable& current);
+
+	// 감시와 상관없이 바로 다시 읽기
+	void reload();
+
+signals:
+	// 변경분이 있을 때만. master = 새로 읽은 전체 마스터
+	void masterReloaded(const MstTable& master, const MstDelta& delta);
+
+private slots:
+	void onFileChanged(const QString& path);
+
+private:
+	struct File
+	{
+		QString path;		// 절대 경로
+		Market market;
+	};
+
+	QVector<File> m_files;
+	QFileSystemWatcher* m_watcher;
+	QTimer* m_debounceTimer;		// 파일이 다 써질 때까지 기다림
+	QThread* m_thread = nullptr;	// 진행 중인 다시 읽기
+	bool m_pending = false;			// 읽는 도중 또 바뀜
+	MstTable m_current;
+
+	void finishReload(MstTable table, MstDelta delta);
+	void watchExisting();
+};
@@ -4,6 +4,7 @@
 #include <QNetworkReply>
 #include <QTimer>
 #include <QDebug>
+#include "LatencyTracer.h"
 
 class NetworkUtils : public QObject
 {
@@ -23,6 +24,7 @@ public:
 			if (reply && reply->isRunning())
 			{
 				qDebug() << "[NetworkUtils] Timeout reached. Aborting request:" << reply->url().toString();
+				LatencyTracer::countTimeout();
 				reply->abort();
 			}
 		});
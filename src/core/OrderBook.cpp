@@ -0,0 +1,29 @@
+#include "OrderBook.h"
+
+quint32 OrderBook::apply(const OrderBook& update)
+{
+	quint32 changed = 0;
+	for (int level = 0; level < Depth; ++level)
+	{
+		if (asks[level] != update.asks[level])
+		{
+			asks[level] = update.asks[level];
+			changed |= quint32(1) << askRow(level);
+		}
+		if (bids[level] != update.bids[level])
+		{
+			bids[level] = update.bids[level];
+			changed |= quint32(1) << bidRow(level);
+		}
+	}
+
+	if (totalAskQuantity != update.totalAskQuantity || totalBidQuantity != update.totalBidQuantity)
+	{
+		totalAskQuantity = update.totalAskQuantity;
+		totalBidQuantity = update.totalBidQuantity;
+		changed |= TotalsChanged;
+	}
+
+	timestamp = update.timestamp;
+	return changed;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <QMetaType>
+#include <QtGlobal>
+#include <array>
+
+// 호가 한 단계
+struct OrderBookLevel
+{
+	double price = 0.0;
+	qint64 quantity = 0;	// 잔량
+
+	bool operator==(const OrderBookLevel&) const = default;
+};
+
+// 종목 하나의 10단계 호가 (한국투자증권 기준)
+// 크기가 고정된 배열이라 만들거나 복사할 때 힙 할당이 없음 (스레드 사이 큐 연결로 넘겨도 가벼움)
+//
+// 사다리 행 번호: 위에서부터 매도 10..1호가, 매수 1..10호가
+struct OrderBook
+{
+	static constexpr int Depth = 10;
+	static constexpr int RowCount = Depth * 2;
+	static constexpr quint32 TotalsChanged = quint32(1) << RowCount;	// 총 잔량 변경 비트
+
+	std::array<OrderBookLevel, Depth> asks{};	// [0] = 최우선 매도호가
+	std::array<OrderBookLevel, Depth> bids{};	// [0] = 최우선 매수호가
+	qint64 totalAskQuantity = 0;
+	qint64 totalBidQuantity = 0;
+	qint64 timestamp = 0;		// 수신 시각 (epoch ms)
+
+	static constexpr int askRow(int level) { return Depth - 1 - level; }
+	static constexpr int bidRow(int level) { return Depth + level; }
+
+	const OrderBookLevel& row(int row) const { return row < Depth ? asks[askRow(row)] : bids[row - Depth]; }
+
+	// 새 호가에서 달라진 단계만 덮어쓰고, 바뀐 행을 비트(1 << 행 번호, 총 잔량은 TotalsChanged)로 돌려줌
+	quint32 apply(const OrderBook& update);
+};
+
+static_assert(OrderBook::RowCount < 32, "행 비트가 quint32를 넘음");
+
+Q_DECLARE_METATYPE(OrderBook)
@@ -0,0 +1,250 @@
+#include "Portfolio.h"
+#include <QFile>
+#include <QSaveFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QRegularExpression>
+#include <QDebug>
+
+namespace
+{
+	const int FILE_VERSION = 1;
+	const double DEFAULT_USD_KRW = 1350.0;	// 환율을 아직 못 받았을 때
+}
+
+Portfolio::Portfolio(QObject* parent) : QObject(parent), m_usdKrw(DEFAULT_USD_KRW)
+{
+}
+
+QString Portfolio::currencyFor(const QString& symbol)
+{
+	static const QRegularExpression re("^[0-9]{6}$");	// 숫자 6자리 = 국내 종목
+	return re.match(symbol).hasMatch() ? "KRW" : "USD";
+}
+
+PortfolioTotals& Portfolio::totalsFor(const QString& currency)
+{
+	return currency == "KRW" ? m_krw : m_usd;
+}
+
+const PortfolioTotals& Portfolio::totals(const QString& currency) const
+{
+	return currency == "KRW" ? m_krw : m_usd;
+}
+
+PortfolioTotals Portfolio::totalsInKrw() const
+{
+	PortfolioTotals result;
+	result.costBasis = m_krw.costBasis + m_usd.costBasis * m_usdKrw;
+	result.marketValue = m_krw.marketValue + m_usd.marketValue * m_usdKrw;
+	result.realizedPnl = m_krw.realizedPnl + m_usd.realizedPnl * m_usdKrw;
+	return result;
+}
+
+void Portfolio::setUsdKrw(double rate)
+{
+	if (rate <= 0 || rate == m_usdKrw) return;
+	m_usdKrw = rate;
+	emit totalsChanged();
+}
+
+void Portfolio::addToTotals(const Position& position, double sign)
+{
+	PortfolioTotals& totals = totalsFor(position.currency);
+	totals.costBasis += sign * position.costBasis();
+	totals.marketValue += sign * position.marketValue();
+	totals.realizedPnl += sign * position.realizedPnl;
+}
+
+bool Portfolio::addTrade(const QString& symbol, double quantity, double price, double fee)
+{
+	if (symbol.isEmpty() || quantity == 0 || price <= 0) return false;
+
+	int row = indexOf(symbol);
+	if (row < 0)
+	{
+		if (quantity < 0) return false;	// 없는 종목 매도
+
+		Position position;
+		position.symbol = symbol;
+		position.currency = currencyFor(symbol);
+		m_positions.push_back(position);
+		row = static_cast<int>(m_positions.size()) - 1;
+		m_index.insert(symbol, row);
+		emit positionsReset();
+	}
+
+	Position& position = m_positions[row];
+	if (quantity < 0 && -quantity > position.quantity + 1e-9) return false;
+
+	// 이 종목 몫을 빼고 -> 갱신 -> 다시 더함
+	addToTotals(position, -1.0);
+
+	if (quantity > 0)
+	{
+		// 매수: 수수료 포함 평균단가
+		const double cost = position.costBasis() + quantity * price + fee;
+		position.quantity += quantity;
+		position.avgCost = cost / position.quantity;
+	}
+	else
+	{
+		// 매도: 평균단가 대비 차익 확정
+		const double sold = -quantity;
+		position.realizedPnl += sold * (price - position.avgCost) - fee;
+		position.quantity -= sold;
+		if (position.quantity < 1e-9)
+		{
+			position.quantity = 0.0;
+			position.avgCost = 0.0;
+		}
+	}
+	if (position.lastPrice <= 0)
+		position.lastPrice = price;
+
+	addToTotals(position, 1.0);
+
+	emit positionChanged(row);
+	emit totalsChanged();
+	return true;
+}
+
+bool Portfolio::removePosition(const QString& symbol)
+{
+	const int row = indexOf(symbol);
+	if (row < 0) return false;
+
+	addToTotals(m_positions[row], -1.0);
+
+	// 마지막 행을 빈자리로 옮겨서 O(1) 삭제
+	const int last = static_cast<int>(m_positions.size()) - 1;
+	if (row != last)
+	{
+		m_positions[row] = std::move(m_positions[last]);
+		m_index[m_positions[row].symbol] = row;
+	}
+	m_positions.pop_back();
+	m_index.remove(symbol);
+
+	emit positionsReset();
+	emit totalsChanged();
+	return true;
+}
+
+void Portfolio::clear()
+{
+	m_positions.clear();
+	m_index.clear();
+	m_krw = PortfolioTotals();
+	m_usd = PortfolioTotals();
+	emit positionsReset();
+	emit totalsChanged();
+}
+
+void Portfolio::onTick(const StockData& data)
+{
+	if (data.currentPrice <= 0) return;
+
+	auto it = m_index.constFind(data.symbol);
+	if (it == m_index.cend()) return;
+
+	Position& position = m_positions[it.value()];
+	const double before = position.marketValue();
+	position.lastPrice = data.currentPrice;
+
+	// 평가금액 변화분만 반영
+	totalsFor(position.currency).marketValue += position.marketValue() - before;
+
+	if (++m_ticksSinceRevalue >= RevalueInterval)
+		revalue();
+
+	emit positionChanged(it.value());
+	emit totalsChanged();
+}
+
+void Portfolio::revalue()
+{
+	m_krw = PortfolioTotals();
+	m_usd = PortfolioTotals();
+	for (const Position& position : m_positions)
+		addToTotals(position, 1.0);
+	m_ticksSinceRevalue = 0;
+}
+
+bool Portfolio::load(const QString& path)
+{
+	QFile file(path);
+	if (!file.open(QIODevice::ReadOnly))
+		return false;	// 아직 저장한 적 없음
+
+	QJsonParseError error;
+	QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &error);
+	if (error.error != QJsonParseError::NoError || !doc.isObject())
+	{
+		qDebug() << "[Portfolio] 파일 형식 오류:" << path << error.errorString();
+		return false;
+	}
+
+	QJsonObject root = doc.object();
+	if (root["version"].toInt() != FILE_VERSION)
+	{
+		qDebug() << "[Portfolio] 지원하지 않는 파일 버전:" << root["version"].toInt();
+		return false;
+	}
+
+	m_positions.clear();
+	m_index.clear();
+	for (const QJsonValue& value : root["positions"].toArray())
+	{
+		QJsonObject obj = value.toObject();
+
+		Position position;
+		position.symbol = obj["symbol"].toString();
+		if (position.symbol.isEmpty() || m_index.contains(position.symbol)) continue;
+		position.currency = currencyFor(position.symbol);
+		position.quantity = obj["quantity"].toDouble();
+		position.avgCost = obj["avg_cost"].toDouble();
+		position.realizedPnl = obj["realized_pnl"].toDouble();
+		position.lastPrice = obj["last_price"].toDouble();
+
+		m_index.insert(position.symbol, static_cast<int>(m_positions.size()));
+		m_positions.push_back(position);
+	}
+	if (root["usd_krw"].toDouble() > 0)
+		m_usdKrw = root["usd_krw"].toDouble();
+
+	revalue();
+	emit positionsReset();
+	emit totalsChanged();
+	return true;
+}
+
+bool Portfolio::save(const QString& path) const
+{
+	QJsonArray array;
+	for (const Position& position : m_positions)
+	{
+		array.append(QJsonObject{
+			{ "symbol", position.symbol },
+			{ "quantity", position.quantity },
+			{ "avg_cost", position.avgCost },
+			{ "realized_pnl", position.realizedPnl },
+			{ "last_price", position.lastPrice }
+		});
+	}
+
+	QJsonObject root;
+	root["version"] = FILE_VERSION;
+	root["usd_krw"] = m_usdKrw;
+	root["positions"] = array;
+
+	QSaveFile file(path);
+	if (!file.open(QIODevice::WriteOnly))
+	{
+		qDebug() << "[Portfolio] 저장 실패:" << path;
+		return false;
+	}
+	file.write(QJsonDocument(root).toJson());
+	return file.commit();
+}
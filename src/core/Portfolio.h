@@ -0,0 +1,89 @@
+#pragma once
+
+#include <QObject>
+#include <QHash>
+#include <QString>
+#include <vector>
+#include "StockData.h"
+
+// 보유 종목 하나 (평균단가 방식)
+struct Position
+{
+	QString symbol;
+	QString currency;			// "KRW" / "USD"
+	double quantity = 0.0;
+	double avgCost = 0.0;		// 평균 매입가
+	double realizedPnl = 0.0;	// 매도로 확정된 손익 (수수료 차감)
+	double lastPrice = 0.0;		// 마지막 시세 (0 = 아직 시세 없음 -> 매입가로 평가)
+
+	double costBasis() const { return quantity * avgCost; }
+	double markPrice() const { return lastPrice > 0 ? lastPrice : avgCost; }
+	double marketValue() const { return quantity * markPrice(); }
+	double unrealizedPnl() const { return marketValue() - costBasis(); }
+};
+
+// 통화별 합계
+struct PortfolioTotals
+{
+	double costBasis = 0.0;
+	double marketValue = 0.0;
+	double realizedPnl = 0.0;
+
+	double unrealizedPnl() const { return marketValue - costBasis; }
+};
+
+// 포트폴리오 (국내 KRW + 미국 USD)
+// 시세가 오면 그 종목의 평가금액 변화분만 통화별 합계에 더함 -> 틱당 O(1), 종목 수와 무관
+// 원화 환산 합계는 통화별 합계 두 개와 환율로 바로 계산
+class Portfolio : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit Portfolio(QObject* parent = nullptr);
+
+	// 매매 기록. quantity > 0 매수, < 0 매도. 보유 수량보다 많이 팔면 false
+	bool addTrade(const QString& symbol, double quantity, double price, double fee = 0.0);
+	bool removePosition(const QString& symbol);
+	void clear();
+
+	int count() const { return static_cast<int>(m_positions.size()); }
+	const Position& at(int row) const { return m_positions[row]; }
+	int indexOf(const QString& symbol) const { return m_index.value(symbol, -1); }
+
+	const PortfolioTotals& totals(const QString& currency) const;
+	PortfolioTotals totalsInKrw() const;
+
+	// 1달러당 원화
+	double usdKrw() const { return m_usdKrw; }
+	void setUsdKrw(double rate);
+
+	// 누적된 부동소수 오차 제거용 전체 재계산 (O(n), 가끔만)
+	void revalue();
+
+	bool load(const QString& path);
+	bool save(const QString& path) const;
+
+	static QString currencyFor(const QString& symbol);
+
+public slots:
+	void onTick(const StockData& data);
+
+signals:
+	void positionChanged(int row);			// 시세/매매로 한 행이 바뀜
+	void positionsReset();					// 행 추가/삭제/불러오기
+	void totalsChanged();
+
+private:
+	static constexpr int RevalueInterval = 100000;	// 이 틱 수마다 전체 재계산
+
+	std::vector<Position> m_positions;
+	QHash<QString, int> m_index;			// 심볼 -> m_positions 위치
+	PortfolioTotals m_krw;
+	PortfolioTotals m_usd;
+	double m_usdKrw = 0.0;
+	int m_ticksSinceRevalue = 0;
+
+	PortfolioTotals& totalsFor(const QString& currency);
+	void addToTotals(const Position& position, double sign);
+};
@@ -0,0 +1,208 @@
+#include "PriceSeries.h"
+#include <algorithm>
+#include <cmath>
+
+qint64 PriceSeries::bucketSpan(int level)
+{
+	qint64 span = LevelFactor;
+	for (int i = 0; i < level; ++i) span *= LevelFactor;
+	return span;
+}
+
+PriceSeries::Bucket PriceSeries::seedBucket(int level) const
+{
+	Bucket seed{ m_times.front(), m_times.front(), m_values.front(), m_values.front() };
+	auto fold = [&seed](qint64 minTime, double min, qint64 maxTime, double max)
+	{
+		if (min < seed.min) { seed.min = min; seed.minTime = minTime; }
+		if (max > seed.max) { seed.max = max; seed.maxTime = maxTime; }
+	};
+
+	// 0단계는 원본 점, 그 위는 바로 아래 단계의 버킷 LevelFactor 개
+	if (level == 0)
+	{
+		for (int i = 1; i < LevelFactor; ++i)
+			fold(m_times[i], m_values[i], m_times[i], m_values[i]);
+	}
+	else
+	{
+		for (const Bucket& b : m_levels[level - 1])
+			fold(b.minTime, b.min, b.maxTime, b.max);
+	}
+	return seed;
+}
+
+void PriceSeries::append(qint64 time, double value)
+{
+	// 시간은 항상 증가해야 이진 탐색이 가능함 (역순 데이터는 버림)
+	if (!m_times.empty() && time < m_times.back()) return;
+
+	m_times.push_back(time);
+	m_values.push_back(value);
+
+	// 피라미드 갱신: 단계마다 마지막 버킷만 건드리므로 O(단계 수)
+	const qint64 index = static_cast<qint64>(m_times.size()) - 1;
+	for (int level = 0; ; ++level)
+	{
+		const qint64 span = bucketSpan(level);
+
+		// 원본이 버킷 하나를 채울 만큼 쌓였을 때 새 단계를 만듦
+		// 첫 버킷은 지금까지의 점 전부(방금 넣은 점 포함)를 아래 단계에서 접어서 채움
+		if (level >= static_cast<int>(m_levels.size()))
+		{
+			if (static_cast<qint64>(m_times.size()) < span) break;
+			m_levels.push_back({ seedBucket(level) });
+			continue;
+		}
+
+		std::vector<Bucket>& buckets = m_levels[level];
+		const size_t bucketIndex = static_cast<size_t>(index / span);
+
+		if (bucketIndex >= buckets.size())
+		{
+			buckets.push_back({ time, time, value, value });
+		}
+		else
+		{
+			Bucket& b = buckets[bucketIndex];
+			if (value < b.min) { b.min = value; b.minTime = time; }
+			if (value > b.max) { b.max = value; b.maxTime = time; }
+		}
+	}
+}
+
+void PriceSeries::clear()
+{
+	m_times.clear();
+	m_values.clear();
+	m_levels.clear();
+}
+
+std::vector<SeriesPoint> PriceSeries::visiblePoints(qint64 from, qint64 to, int pixelWidth) const
+{
+	std::vector<SeriesPoint> result;
+	if (m_times.empty() || pixelWidth <= 0 || to < from) return result;
+
+	// 화면 양끝 밖의 점도 하나씩 포함해야 선이 가장자리까지 이어짐
+	qint64 begin = std::lower_bound(m_times.begin(), m_times.end(), from) - m_times.begin();
+	qint64 end = std::upper_bound(m_times.begin(), m_times.end(), to) - m_times.begin();
+	if (begin > 0) --begin;
+	if (end < static_cast<qint64>(m_times.size())) ++end;
+
+	const qint64 count = end - begin;
+	const int target = pixelWidth * 2;
+
+	// 점이 충분히 적으면 원본 그대로
+	if (count <= target)
+	{
+		result.reserve(static_cast<size_t>(count));
+		for (qint64 i = begin; i < end; ++i)
+			result.push_back({ m_times[i], m_values[i] });
+		return result;
+	}
+
+	// 구간 안 버킷 수가 pixelWidth 이상인 가장 거친 단계를 찾음
+	int level = -1;
+	for (int k = static_cast<int>(m_levels.size()) - 1; k >= 0; --k)
+	{
+		if (count / bucketSpan(k) >= pixelWidth)
+		{
+			level = k;
+			break;
+		}
+	}
+
+	std::vector<SeriesPoint> source;
+	if (level < 0)
+	{
+		source.reserve(static_cast<size_t>(count));
+		for (qint64 i = begin; i < end; ++i)
+			source.push_back({ m_times[i], m_values[i] });
+	}
+	else
+	{
+		// 버킷마다 최소/최대 두 점을 시간 순서대로
+		const qint64 span = bucketSpan(level);
+		const std::vector<Bucket>& buckets = m_levels[level];
+		const size_t first = static_cast<size_t>(begin / span);
+		const size_t last = std::min(buckets.size(), static_cast<size_t>((end - 1) / span) + 1);
+
+		source.reserve((last - first) * 2);
+		for (size_t i = first; i < last; ++i)
+		{
+			const Bucket& b = buckets[i];
+			if (b.minTime <= b.maxTime)
+			{
+				source.push_back({ b.minTime, b.min });
+				if (b.maxTime != b.minTime) source.push_back({ b.maxTime, b.max });
+			}
+			else
+			{
+				source.push_back({ b.maxTime, b.max });
+				source.push_back({ b.minTime, b.min });
+			}
+		}
+
+		// 아직 버킷으로 묶이지 않은 꼬리 점들
+		for (qint64 i = static_cast<qint64>(last) * span; i < end; ++i)
+			source.push_back({ m_times[i], m_values[i] });
+	}
+
+	return lttb(source, target);
+}
+
+std::vector<SeriesPoint> PriceSeries::lttb(const std::vector<SeriesPoint>& points, int threshold)
+{
+	const int count = static_cast<int>(points.size());
+	if (threshold >= count || threshold < 3) return points;
+
+	std::vector<SeriesPoint> sampled;
+	sampled.reserve(threshold);
+
+	// 첫 점과 마지막 점은 항상 유지
+	const double every = static_cast<double>(count - 2) / (threshold - 2);
+	int a = 0;
+	sampled.push_back(points[a]);
+
+	for (int i = 0; i < threshold - 2; ++i)
+	{
+		// 다음 버킷의 평균점
+		int avgBegin = static_cast<int>(std::floor((i + 1) * every)) + 1;
+		int avgEnd = std::min(static_cast<int>(std::floor((i + 2) * every)) + 1, count);
+		double avgTime = 0.0;
+		double avgValue = 0.0;
+		for (int j = avgBegin; j < avgEnd; ++j)
+		{
+			avgTime += static_cast<double>(points[j].time);
+			avgValue += points[j].value;
+		}
+		const int avgCount = std::max(avgEnd - avgBegin, 1);
+		avgTime /= avgCount;
+		avgValue /= avgCount;
+
+		// 현재 버킷에서 (이전 선택점, 다음 평균점)과 만드는 삼각형이 가장 큰 점
+		int rangeBegin = static_cast<int>(std::floor(i * every)) + 1;
+		int rangeEnd = static_cast<int>(std::floor((i + 1) * every)) + 1;
+		const double ax = static_cast<double>(points[a].time);
+		const double ay = points[a].value;
+
+		double maxArea = -1.0;
+		int next = rangeBegin;
+		for (int j = rangeBegin; j < rangeEnd; ++j)
+		{
+			double area = std::abs((ax - avgTime) * (points[j].value - ay)
+				- (ax - static_cast<double>(points[j].time)) * (avgValue - ay));
+			if (area > maxArea)
+			{
+				maxArea = area;
+				next = j;
+			}
+		}
+
+		sampled.push_back(points[next]);
+		a = next;
+	}
+
+	sampled.push_back(points[count - 1]);
+	return sampled;
+}
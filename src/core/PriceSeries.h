@@ -0,0 +1,56 @@
+#pragma once
+#include <QtGlobal>
+#include <vector>
+
+struct SeriesPoint
+{
+	qint64 time = 0;	// epoch ms
+	double value = 0.0;
+};
+
+// 차트용 시계열 저장소
+// 원본 점 + 최소/최대 피라미드를 같이 들고 있어서
+// 점이 몇 개든 화면 폭에 맞는 개수만 뽑아서 그릴 수 있음
+class PriceSeries
+{
+public:
+	// 한 단계 올라갈 때마다 묶는 버킷 수
+	static constexpr int LevelFactor = 8;
+
+	void append(qint64 time, double value);
+	void clear();
+
+	int size() const { return static_cast<int>(m_times.size()); }
+	bool isEmpty() const { return m_times.empty(); }
+	qint64 firstTime() const { return m_times.empty() ? 0 : m_times.front(); }
+	qint64 lastTime() const { return m_times.empty() ? 0 : m_times.back(); }
+	double lastValue() const { return m_values.empty() ? 0.0 : m_values.back(); }
+	qint64 timeAt(int i) const { return m_times[i]; }
+	double valueAt(int i) const { return m_values[i]; }
+
+	// [from, to] 구간을 pixelWidth 폭에 그릴 점 목록 (최대 2 * pixelWidth 개)
+	std::vector<SeriesPoint> visiblePoints(qint64 from, qint64 to, int pixelWidth) const;
+
+	// 점 목록을 threshold 개로 줄임 (Largest-Triangle-Three-Buckets)
+	static std::vector<SeriesPoint> lttb(const std::vector<SeriesPoint>& points, int threshold);
+
+private:
+	// 버킷 하나의 최소/최대 값과 그 시각
+	struct Bucket
+	{
+		qint64 minTime;
+		qint64 maxTime;
+		double min;
+		double max;
+	};
+
+	std::vector<qint64> m_times;
+	std::vector<double> m_values;
+
+	// m_levels[k]의 버킷 하나 = 원본 점 LevelFactor^(k+1) 개
+	std::vector<std::vector<Bucket>> m_levels;
+
+	static qint64 bucketSpan(int level);
+	// 새 단계의 첫 버킷 (단계를 만드는 순간 = 원본이 정확히 bucketSpan(level) 개일 때)
+	Bucket seedBucket(int level) const;
+};
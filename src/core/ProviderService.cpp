@@ -0,0 +1,262 @@
+#include "ProviderService.h"
+#include "FinnhubAPI.h"
+#include "KisAPI.h"
+#include "QuoteMailbox.h"
+#ifdef STOCKFLOW_HAS_WEBSOCKETS
+#include "KisRealtime.h"
+#include "Endpoints.h"
+#endif
+#include <QRegularExpression>
+#include <QThread>
+#include <QTimer>
+
+ProviderService::ProviderService(StockAPI* replay, bool threaded, QObject* parent)
+	: QObject(parent)
+	, m_replayApi(replay)
+{
+	// 제공자와 타이머는 전부 m_context 밑에 두고 통째로 I/O 스레드로 옮김
+	m_context = new QObject();
+	m_usApi = new FinnhubAPI(m_context);
+	m_krApi = new KisAPI(m_context);
+	if (m_replayApi)
+		m_replayApi->setParent(m_context);
+
+	m_batchTimer = new QTimer(m_context);
+	m_batchTimer->setSingleShot(true);
+	m_batchTimer->setInterval(16);
+	connect(m_batchTimer, &QTimer::timeout, m_context, [this]() { flush(); });
+
+	// 호가: 실시간이 없으면 1초마다 구독 종목 REST 조회
+	qRegisterMetaType<OrderBook>();
+	m_orderBookTimer = new QTimer(m_context);
+	m_orderBookTimer->setInterval(1000);
+	connect(m_orderBookTimer, &QTimer::timeout, m_context, [this]()
+	{
+		for (const QString& symbol : std::as_const(m_orderBookSymbols))
+			m_krApi->fetchOrderBook(symbol);
+	});
+	connect(m_krApi, &KisAPI::orderBookReceived, this, &ProviderService::orderBookReceived);
+
+	for (StockAPI* api : { static_cast<StockAPI*>(m_usApi), static_cast<StockAPI*>(m_krApi), m_replayApi })
+	{
+		if (!api) continue;
+		// 같은 스레드 → 직접 호출. 나머지는 this(GUI 스레드)로 넘어감
+		connect(api, &StockAPI::dataReceived, m_context, [this](const StockData& data) { onQuote(data); });
+		connect(api, &StockAPI::logoReceived, this, &ProviderService::logoReceived);
+		connect(api, &StockAPI::candlesReceived, this, &ProviderService::candlesReceived);
+	}
+	connect(m_usApi, &FinnhubAPI::symbolsReceived, this, &ProviderService::symbolsReceived);
+	connect(m_usApi, &FinnhubAPI::fxRateReceived, this, &ProviderService::fxRateReceived);
+	connect(m_krApi, &KisAPI::authenticated, this, &ProviderService::authenticated);
+	if (!m_replayApi)
+		connect(m_krApi, &KisAPI::authenticated, m_context, [this]() { startRealtime(); });
+
+	if (!threaded)
+	{
+		m_context->setParent(this);
+		return;
+	}
+
+	m_thread = new QThread(this);
+	m_thread->setObjectName("ProviderIO");
+	m_context->moveToThread(m_thread);
+	// 루프가 끝날 때 I/O 스레드 안에서 정리 (응답/타이머가 다른 스레드에서 지워지지 않게)
+	connect(m_thread, &QThread::finished, m_context, &QObject::deleteLater);
+	m_thread->start();
+}
+
+ProviderService::~ProviderService()
+{
+	stop();
+}
+
+void ProviderService::stop()
+{
+	if (!m_thread) return;
+
+	m_thread->quit();
+	m_thread->wait();
+	m_thread = nullptr;
+	m_context = nullptr;
+	m_usApi = nullptr;
+	m_krApi = nullptr;
+	m_replayApi = nullptr;
+	m_batchTimer = nullptr;
+	m_orderBookTimer = nullptr;
+	m_realtime = nullptr;
+}
+
+template <typename Fn>
+void ProviderService::post(Fn&& fn)
+{
+	if (!m_context) return;
+
+	// 스레드 없이 돌 때는 예전처럼 바로 실행
+	if (!m_thread)
+		fn();
+	else
+		QMetaObject::invokeMethod(m_context, std::forward<Fn>(fn), Qt::QueuedConnection);
+}
+
+void ProviderService::setBatchInterval(int msec)
+{
+	post([this, msec]() { m_batchTimer->setInterval(msec); });
+}
+
+bool ProviderService::isDomestic(const QString& symbol) const
+{
+	static const QRegularExpression re("^[0-9]{6}$");	// 숫자 6자리 (한국 종목 패턴)
+	return re.match(symbol).hasMatch();
+}
+
+StockAPI* ProviderService::apiFor(const QString& symbol) const
+{
+	if (m_replayApi)
+		return m_replayApi;
+	return isDomestic(symbol) ? static_cast<StockAPI*>(m_krApi) : m_usApi;
+}
+
+void ProviderService::authenticate()
+{
+	post([this]() { m_krApi->authenticate(); });
+}
+
+void ProviderService::fetchStock(const QString& symbol)
+{
+	post([this, symbol]() { apiFor(symbol)->fetchStock(symbol); });
+}
+
+void ProviderService::fetchLogo(const QString& symbol)
+{
+	post([this, symbol]() { apiFor(symbol)->fetchLogo(symbol); });
+}
+
+void ProviderService::fetchStocks(const QStringList& symbols, bool withLogo)
+{
+	post([this, symbols, withLogo]()
+	{
+		for (const QString& symbol : symbols)
+		{
+			StockAPI* api = apiFor(symbol);
+			api->fetchStock(symbol);
+			if (withLogo)
+				api->fetchLogo(symbol);
+		}
+	});
+}
+
+void ProviderService::fetchCandles(const QString& symbol, CandleResolution resolution, const QDateTime& from, const QDateTime& to)
+{
+	post([this, symbol, resolution, from, to]() { apiFor(symbol)->fetchCandles(symbol, resolution, from, to); });
+}
+
+void ProviderService::fetchAllUSSymbols()
+{
+	post([this]() { m_usApi->fetchAllUSSymblos(); });
+}
+
+void ProviderService::fetchFxRate(const QString& base, const QString& quote)
+{
+	post([this, base, quote]() { m_usApi->fetchFxRate(base, quote); });
+}
+
+void ProviderService::subscribeOrderBook(const QString& symbol)
+{
+	if (m_replayApi || !isDomestic(symbol)) return;
+
+	post([this, symbol]()
+	{
+		if (m_orderBookSymbols.contains(symbol)) return;
+		m_orderBookSymbols.insert(symbol);
+
+		// 실시간은 바뀔 때만 오므로 처음 화면은 REST로 한 번 채움
+		m_krApi->fetchOrderBook(symbol);
+#ifdef STOCKFLOW_HAS_WEBSOCKETS
+		if (m_realtime)
+			m_realtime->subscribe(symbol);
+#endif
+		updateOrderBookPolling();
+	});
+}
+
+void ProviderService::unsubscribeOrderBook(const QString& symbol)
+{
+	post([this, symbol]()
+	{
+		if (!m_orderBookSymbols.remove(symbol)) return;
+#ifdef STOCKFLOW_HAS_WEBSOCKETS
+		if (m_realtime)
+			m_realtime->unsubscribe(symbol);
+#endif
+		updateOrderBookPolling();
+	});
+}
+
+void ProviderService::updateOrderBookPolling()
+{
+#ifdef STOCKFLOW_HAS_WEBSOCKETS
+	const bool realtime = m_realtime && m_realtime->isConnected();
+#else
+	const bool realtime = false;
+#endif
+	if (m_orderBookSymbols.isEmpty() || realtime)
+		m_orderBookTimer->stop();
+	else if (!m_orderBookTimer->isActive())
+		m_orderBookTimer->start();
+}
+
+void ProviderService::startRealtime()
+{
+#ifdef STOCKFLOW_HAS_WEBSOCKETS
+	// 실시간 서버가 없는 환경 (대역 서버 등)은 REST 조회만
+	const QString url = Endpoints::kisWebSocketUrl();
+	if (m_realtime || url.isEmpty()) return;
+
+	m_realtime = new KisRealtime(m_context);
+	connect(m_realtime, &KisRealtime::orderBookReceived, this, &ProviderService::orderBookReceived);
+	connect(m_realtime, &KisRealtime::connected, m_context, [this]() { updateOrderBookPolling(); });
+	connect(m_realtime, &KisRealtime::disconnected, m_context, [this]() { updateOrderBookPolling(); });
+	for (const QString& symbol : std::as_const(m_orderBookSymbols))
+		m_realtime->subscribe(symbol);
+
+	connect(m_krApi, &KisAPI::approvalKeyReceived, m_realtime, [this, url](const QString& key)
+	{
+		m_realtime->open(url, key);
+	}, Qt::SingleShotConnection);
+	m_krApi->requestApprovalKey();
+#endif
+}
+
+void ProviderService::onQuote(const StockData& data)
+{
+	// 화면용 최신값은 바로, 모든 틱(지표/알림/저널용)은 묶어서
+	if (QuoteMailbox* mailbox = m_mailbox.load(std::memory_order_acquire))
+		mailbox->post(data);
+
+	m_batches[m_filling].append(data);
+	if (!m_batchTimer->isActive())
+		m_batchTimer->start();
+}
+
+void ProviderService::flush()
+{
+	m_batchTimer->stop();	// 타이머 밖에서 불렸을 때도 다음 틱이 다시 켜도록
+	if (m_batches[m_filling].isEmpty()) return;
+
+	// GUI가 지난 묶음을 아직 처리 중이면 이번 것은 계속 모았다가 다음에
+	if (m_delivering.load(std::memory_order_acquire))
+	{
+		m_batchTimer->start();
+		return;
+	}
+
+	const int ready = m_filling;
+	m_filling ^= 1;
+	m_delivering.store(true, std::memory_order_relaxed);
+	QMetaObject::invokeMethod(this, [this, ready]()
+	{
+		emit quotesReceived(m_batches[ready]);
+		m_batches[ready].clear();	// 용량은 유지 (받는 쪽이 복사해 두지 않는 한)
+		m_delivering.store(false, std::memory_order_release);
+	}, Qt::QueuedConnection);
+}
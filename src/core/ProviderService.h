@@ -0,0 +1,99 @@
+#pragma once
+#include <QObject>
+#include <QDateTime>
+#include <QImage>
+#include <QSet>
+#include <QStringList>
+#include <QVector>
+#include <atomic>
+#include "StockData.h"
+#include "Candle.h"
+#include "OrderBook.h"
+
+class QThread;
+class QTimer;
+class StockAPI;
+class FinnhubAPI;
+class KisAPI;
+class KisRealtime;
+class QuoteMailbox;
+
+// 시세 제공자(Finnhub/KIS/재생)를 전용 I/O 스레드의 이벤트 루프에서 돌리는 창구
+// 응답 콜백, 타임아웃 타이머, TLS 핸드셰이크, JSON 파싱이 GUI 스레드의 그리기/입력과 경쟁하지 않게 함
+//
+// 요청 함수는 어느 스레드에서 불러도 I/O 스레드로 넘기고 바로 반환
+// 받은 시세는 우편함이 있으면 I/O 스레드에서 바로 넣고, 모아서 quotesReceived 한 번으로 GUI 스레드에 보냄
+// 나머지 결과 신호(로고/봉/심볼 목록/환율/인증/호가)는 받는 쪽 스레드로 넘어감
+class ProviderService : public QObject
+{
+	Q_OBJECT
+
+public:
+	// replay가 주어지면 모든 종목을 재생 API로 처리 (부모 없는 객체여야 하고 소유권을 가져감)
+	// threaded = false면 예전처럼 호출한 스레드에서 실행 (응답성 비교용)
+	explicit ProviderService(StockAPI* replay = nullptr, bool threaded = true, QObject* parent = nullptr);
+	~ProviderService();
+
+	// I/O 스레드를 멈추고 제공자 객체를 정리 (여러 번 불러도 됨)
+	void stop();
+
+	bool isReplay() const { return m_replayApi != nullptr; }
+	bool isThreaded() const { return m_thread != nullptr; }
+
+	// I/O 스레드에서 바로 넣을 화면용 우편함 (nullptr = 안 씀)
+	void setMailbox(QuoteMailbox* mailbox) { m_mailbox.store(mailbox); }
+	// 시세 묶음을 GUI로 보내는 최대 지연 (ms)
+	void setBatchInterval(int msec);
+
+	void authenticate();
+	void fetchStock(const QString& symbol);
+	void fetchLogo(const QString& symbol);
+	// 여러 종목을 요청 한 번으로 넘김 (자동 갱신 등)
+	void fetchStocks(const QStringList& symbols, bool withLogo = false);
+	void fetchCandles(const QString& symbol, CandleResolution resolution, const QDateTime& from, const QDateTime& to);
+	void fetchAllUSSymbols();
+	void fetchFxRate(const QString& base, const QString& quote);
+
+	// 국내 종목 10단계 호가 구독 (재생 모드/해외 종목은 무시)
+	// 실시간(웹소켓)이 연결돼 있으면 바뀔 때마다, 아니면 REST로 주기 조회
+	void subscribeOrderBook(const QString& symbol);
+	void unsubscribeOrderBook(const QString& symbol);
+
+signals:
+	void quotesReceived(const QVector<StockData>& quotes);
+	void logoReceived(const QString& symbol, const QImage& logo);
+	void candlesReceived(const QString& symbol, CandleResolution resolution, const QVector<Candle>& candles);
+	void symbolsReceived();
+	void fxRateReceived(const QString& base, const QString& quote, double rate);
+	void authenticated();
+	void orderBookReceived(const QString& symbol, const OrderBook& book);
+
+protected:
+	// 제공자 dataReceived -> 우편함 + 묶음 / 묶음을 GUI로 (벤치에서 직접 부를 수 있게 protected)
+	void onQuote(const StockData& data);
+	void flush();
+
+private:
+	QThread* m_thread = nullptr;		// threaded = false면 nullptr
+	QObject* m_context;					// I/O 스레드에 사는 부모 (제공자, 타이머, 연결 기준)
+	FinnhubAPI* m_usApi;
+	KisAPI* m_krApi;
+	StockAPI* m_replayApi;
+	QTimer* m_batchTimer;
+	// 시세 묶음 두 벌을 번갈아 씀 (비워도 용량은 남아서 데워지면 틱마다 할당 없음)
+	// m_filling은 I/O 스레드가 채우는 쪽, 다른 쪽은 m_delivering인 동안 GUI 스레드가 읽는 중
+	QVector<StockData> m_batches[2];
+	int m_filling = 0;					// I/O 스레드 전용
+	std::atomic<bool> m_delivering{ false };
+	std::atomic<QuoteMailbox*> m_mailbox{ nullptr };
+	QSet<QString> m_orderBookSymbols;	// I/O 스레드 전용
+	QTimer* m_orderBookTimer;			// 실시간이 없을 때 REST 주기 조회
+	KisRealtime* m_realtime = nullptr;	// Qt WebSockets가 없으면 항상 nullptr
+
+	StockAPI* apiFor(const QString& symbol) const;
+	template <typename Fn>
+	void post(Fn&& fn);
+	bool isDomestic(const QString& symbol) const;
+	void startRealtime();
+	void updateOrderBookPolling();
+};
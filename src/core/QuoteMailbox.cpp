@@ -0,0 +1,159 @@
+#include "QuoteMailbox.h"
+#include "LatencyTracer.h"
+#include <QHash>
+#include <QMutexLocker>
+#include <QTimer>
+#include <bit>
+
+QuoteMailbox::QuoteMailbox(QObject* parent)
+	: QObject(parent)
+	, m_index(new std::atomic<int>[IndexSize])
+{
+	for (std::atomic<Slot*>& chunk : m_chunks)
+		chunk.store(nullptr, std::memory_order_relaxed);
+	for (int i = 0; i < IndexSize; ++i)
+		m_index[i].store(-1, std::memory_order_relaxed);
+	for (std::atomic<quint64>& word : m_dirty)
+		word.store(0, std::memory_order_relaxed);
+
+	m_timer = new QTimer(this);
+	m_timer->setSingleShot(true);
+	connect(m_timer, &QTimer::timeout, this, &QuoteMailbox::drain);
+}
+
+QuoteMailbox::~QuoteMailbox()
+{
+	for (std::atomic<Slot*>& chunk : m_chunks)
+		delete[] chunk.load(std::memory_order_relaxed);
+}
+
+QuoteMailbox::Slot& QuoteMailbox::slot(int id) const
+{
+	return m_chunks[id / ChunkSize].load(std::memory_order_acquire)[id % ChunkSize];
+}
+
+int QuoteMailbox::find(const QString& symbol, size_t hash) const
+{
+	for (size_t i = hash & (IndexSize - 1);; i = (i + 1) & (IndexSize - 1))
+	{
+		const int id = m_index[i].load(std::memory_order_acquire);
+		if (id < 0) return -1;
+		if (slot(id).symbol == symbol) return id;
+	}
+}
+
+int QuoteMailbox::insert(const QString& symbol, size_t hash)
+{
+	QMutexLocker locker(&m_insertMutex);
+
+	// 잠금 기다리는 사이 다른 스레드가 등록했을 수 있음
+	const int existing = find(symbol, hash);
+	if (existing >= 0) return existing;
+
+	const int id = m_count.load(std::memory_order_relaxed);
+	if (id >= Capacity) return -1;
+
+	// 청크 단위로 필요할 때만 할당. 슬롯을 다 채운 뒤 색인에 공개
+	if (id % ChunkSize == 0)
+		m_chunks[id / ChunkSize].store(new Slot[ChunkSize], std::memory_order_release);
+	slot(id).symbol = symbol;
+
+	size_t i = hash & (IndexSize - 1);
+	while (m_index[i].load(std::memory_order_relaxed) >= 0)
+		i = (i + 1) & (IndexSize - 1);
+	m_index[i].store(id, std::memory_order_release);
+	m_count.store(id + 1, std::memory_order_release);
+	return id;
+}
+
+bool QuoteMailbox::post(const StockData& data)
+{
+	const size_t hash = qHash(data.symbol);
+	int id = find(data.symbol, hash);
+	if (id < 0)
+	{
+		id = insert(data.symbol, hash);
+		if (id < 0)
+		{
+			// 종목 수 한도 초과: 병합 없이 그대로 GUI 스레드로 넘김
+			m_overflow.fetch_add(1, std::memory_order_relaxed);
+			QMetaObject::invokeMethod(this, [this, data]() { emit dataReceived(data); }, Qt::QueuedConnection);
+			return false;
+		}
+	}
+
+	Slot& s = slot(id);
+	s.buffers[s.back] = data;
+	const quint8 previous = s.middle.exchange(s.back | Fresh, std::memory_order_acq_rel);
+	s.back = previous & 3;
+	m_posted.fetch_add(1, std::memory_order_relaxed);
+
+	// 안 읽은 값을 덮었으면 이미 dirty 표시와 깨우기가 끝난 상태
+	if (previous & Fresh)
+	{
+		m_conflated.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+
+	m_dirty[id / 64].fetch_or(quint64(1) << (id % 64));
+
+	// drain이 이미 예약돼 있으면 다시 깨우지 않음
+	if (!m_wakePending.exchange(true))
+		QMetaObject::invokeMethod(this, &QuoteMailbox::schedule, Qt::QueuedConnection);
+	return true;
+}
+
+void QuoteMailbox::schedule()
+{
+	if (m_timer->isActive()) return;
+
+	// 직전 drain에서 최소 간격이 안 지났으면 남은 만큼 미룸
+	const qint64 elapsed = m_sinceDrain.isValid() ? m_sinceDrain.elapsed() : m_interval;
+	m_timer->start(static_cast<int>(qMax<qint64>(0, m_interval - elapsed)));
+}
+
+void QuoteMailbox::drain()
+{
+	// 비트맵을 훑기 전에 내려야 훑는 도중 들어온 틱이 다음 drain을 예약함
+	m_wakePending.store(false);
+	m_sinceDrain.restart();
+	++m_drains;
+
+	// 비트맵 전체라도 256워드라 종목 수로 자르지 않음
+	for (int w = 0; w < DirtyWords; ++w)
+	{
+		quint64 bits = m_dirty[w].exchange(0);
+		while (bits)
+		{
+			const int id = w * 64 + std::countr_zero(bits);
+			bits &= bits - 1;
+
+			// 비트를 내린 뒤 들어온 값을 이번에 읽었으면 다음 drain에선 Fresh가 없음
+			Slot& s = slot(id);
+			if (!(s.middle.load(std::memory_order_relaxed) & Fresh)) continue;
+			const quint8 previous = s.middle.exchange(s.front, std::memory_order_acq_rel);
+			s.front = previous & 3;
+
+			++m_delivered;
+			emit dataReceived(s.buffers[s.front]);
+		}
+	}
+
+	const quint64 conflated = m_conflated.load(std::memory_order_relaxed);
+	if (conflated != m_reportedConflated)
+	{
+		LatencyTracer::countConflated(conflated - m_reportedConflated);
+		m_reportedConflated = conflated;
+	}
+}
+
+QuoteMailbox::Stats QuoteMailbox::stats() const
+{
+	Stats stats;
+	stats.posted = m_posted.load(std::memory_order_relaxed);
+	stats.conflated = m_conflated.load(std::memory_order_relaxed);
+	stats.overflow = m_overflow.load(std::memory_order_relaxed);
+	stats.delivered = m_delivered;
+	stats.drains = m_drains;
+	return stats;
+}
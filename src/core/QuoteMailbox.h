@@ -0,0 +1,93 @@
+#pragma once
+#include <QObject>
+#include <QElapsedTimer>
+#include <QMutex>
+#include <array>
+#include <atomic>
+#include <memory>
+#include "StockData.h"
+
+class QTimer;
+
+// 종목별 최신 시세 우편함 (conflation)
+// 수신 스레드가 post()로 종목 슬롯을 덮어쓰면, GUI 스레드는 자기 속도(최소 간격 16ms)로
+// 바뀐 종목만 꺼내 dataReceived로 내보냄. 그 사이 같은 종목에 여러 번 들어온 틱은 마지막 것만 남음
+// → GUI 부하가 틱 수가 아니라 프레임당 바뀐 종목 수에 비례
+// 한 종목은 한 스레드만 쓴다고 가정 (종목별로 다른 스레드는 가능)
+class QuoteMailbox : public QObject
+{
+	Q_OBJECT
+
+public:
+	struct Stats
+	{
+		quint64 posted = 0;		// post()로 들어온 틱
+		quint64 conflated = 0;	// GUI가 읽기 전에 다음 틱에 덮인 틱
+		quint64 delivered = 0;	// dataReceived로 내보낸 틱
+		quint64 drains = 0;		// drain 횟수
+		quint64 overflow = 0;	// 슬롯이 가득 차 받지 못한 틱
+	};
+
+	explicit QuoteMailbox(QObject* parent = nullptr);
+	~QuoteMailbox();
+
+	// 아무 스레드에서나 호출. 종목 슬롯이 가득 차면 병합 없이 바로 넘기고 false
+	bool post(const StockData& data);
+
+	// drain 최소 간격 (ms, 0이면 이벤트 루프가 돌 때마다)
+	void setInterval(int msec) { m_interval = msec; }
+	int interval() const { return m_interval; }
+
+	int symbolCount() const { return m_count.load(std::memory_order_acquire); }
+	Stats stats() const;
+
+public slots:
+	// GUI 스레드. 바뀐 종목마다 최신 시세 한 번씩 dataReceived
+	void drain();
+
+signals:
+	void dataReceived(const StockData& data);
+
+private:
+	static constexpr int ChunkSize = 256;
+	static constexpr int MaxChunks = 64;
+	static constexpr int Capacity = ChunkSize * MaxChunks;	// 16384 종목
+	static constexpr int IndexSize = Capacity * 2;			// 열린 주소법 (적재율 0.5 이하)
+	static constexpr int DirtyWords = Capacity / 64;
+	static constexpr quint8 Fresh = 0x4;
+
+	// 삼중 버퍼: 쓰는 쪽은 back, 읽는 쪽은 front만 만지고 가운데(middle)를 교환해서 넘김
+	// middle에 Fresh가 붙어있으면 아직 안 읽은 값
+	struct Slot
+	{
+		QString symbol;					// 등록 후 불변
+		StockData buffers[3];
+		std::atomic<quint8> middle{ 1 };
+		quint8 back = 0;				// 쓰는 스레드 전용
+		quint8 front = 2;				// GUI 스레드 전용
+	};
+
+	Slot& slot(int id) const;
+	int find(const QString& symbol, size_t hash) const;
+	int insert(const QString& symbol, size_t hash);
+	void schedule();
+
+	std::array<std::atomic<Slot*>, MaxChunks> m_chunks;
+	std::unique_ptr<std::atomic<int>[]> m_index;	// 심볼 해시 → 슬롯 번호 (-1 = 빈 칸)
+	std::atomic<int> m_count{ 0 };
+	QMutex m_insertMutex;							// 새 종목 등록만 잠금 (조회는 lock-free)
+
+	std::array<std::atomic<quint64>, DirtyWords> m_dirty;	// 안 읽은 슬롯 비트맵
+	std::atomic<bool> m_wakePending{ false };
+
+	std::atomic<quint64> m_posted{ 0 };
+	std::atomic<quint64> m_conflated{ 0 };
+	std::atomic<quint64> m_overflow{ 0 };
+	quint64 m_delivered = 0;	// GUI 스레드 전용
+	quint64 m_drains = 0;
+	quint64 m_reportedConflated = 0;
+
+	QTimer* m_timer;
+	QElapsedTimer m_sinceDrain;
+	int m_interval = 16;
+};
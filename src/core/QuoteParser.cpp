@@ -0,0 +1,295 @@
+#include "QuoteParser.h"
+#include <algorithm>
+#include <array>
+#include <charconv>
+
+namespace
+{
+	constexpr int MaxDepth = 32;	// 건너뛰는 중첩 값 깊이 제한 (깨진 응답 방어)
+
+	struct Cursor
+	{
+		const char* p;
+		const char* end;
+
+		bool atEnd() const { return p >= end; }
+		char peek() const { return p < end ? *p : '\0'; }
+
+		void skipSpace()
+		{
+			while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+				++p;
+		}
+
+		bool consume(char c)
+		{
+			skipSpace();
+			if (peek() != c) return false;
+			++p;
+			return true;
+		}
+	};
+
+	// 따옴표 안 원본 바이트 (이스케이프는 풀지 않음. 스키마 키와 숫자에는 없음)
+	bool readString(Cursor& c, std::string_view& out)
+	{
+		if (!c.consume('"')) return false;
+		const char* start = c.p;
+		while (c.p < c.end && *c.p != '"')
+		{
+			if (*c.p == '\\') ++c.p;
+			++c.p;
+		}
+		if (c.p >= c.end) return false;
+		out = std::string_view(start, static_cast<size_t>(c.p - start));
+		++c.p;
+		return true;
+	}
+
+	// 숫자, true/false/null: 구분자가 나올 때까지
+	std::string_view readScalar(Cursor& c)
+	{
+		c.skipSpace();
+		const char* start = c.p;
+		while (c.p < c.end && *c.p != ',' && *c.p != '}' && *c.p != ']'
+			&& *c.p != ' ' && *c.p != '\t' && *c.p != '\n' && *c.p != '\r')
+			++c.p;
+		return std::string_view(start, static_cast<size_t>(c.p - start));
+	}
+
+	bool skipValue(Cursor& c, int depth = 0)
+	{
+		c.skipSpace();
+		const char open = c.peek();
+		if (open == '"')
+		{
+			std::string_view ignored;
+			return readString(c, ignored);
+		}
+		if (open != '{' && open != '[')
+			return !readScalar(c).empty();
+		if (depth >= MaxDepth) return false;
+
+		const char close = open == '{' ? '}' : ']';
+		++c.p;
+		if (c.consume(close)) return true;
+		do
+		{
+			if (open == '{')
+			{
+				std::string_view key;
+				if (!readString(c, key) || !c.consume(':')) return false;
+			}
+			if (!skipValue(c, depth + 1)) return false;
+		} while (c.consume(','));
+		return c.consume(close);
+	}
+
+	// { "key": value, ... }. onValue가 값 하나를 소비
+	template <typename OnValue>
+	bool readObject(Cursor& c, OnValue&& onValue)
+	{
+		if (!c.consume('{')) return false;
+		if (c.consume('}')) return true;
+		do
+		{
+			std::string_view key;
+			if (!readString(c, key) || !c.consume(':')) return false;
+			if (!onValue(key)) return false;
+		} while (c.consume(','));
+		return c.consume('}');
+	}
+
+	// "-800", "71301.20", "+5", "" (빈 값이나 숫자가 아닌 값은 DOM 경로의 toDouble()처럼 0)
+	double toNumber(std::string_view text)
+	{
+		if (!text.empty() && text.front() == '+')
+			text.remove_prefix(1);
+
+		double value = 0.0;
+		const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+		if (ec != std::errc() || ptr != text.data() + text.size())
+			return 0.0;
+		return value;
+	}
+
+	// 12.5, "-800", null
+	bool readNumber(Cursor& c, double& value)
+	{
+		c.skipSpace();
+		std::string_view text;
+		if (c.peek() == '"')
+		{
+			if (!readString(c, text)) return false;
+		}
+		else
+		{
+			text = readScalar(c);
+			if (text == "null") text = {};
+		}
+		value = toNumber(text);
+		return true;
+	}
+
+	// container 객체 (비어 있으면 최상위) 안에서 lookup(key)가 0 이상인 키만 숫자로 읽어 onValue(번호, 값)
+	// 나머지 키, 객체/배열 값은 만들지 않고 건너뜀
+	template <typename Lookup, typename OnValue>
+	bool readNumbers(QByteArrayView json, std::string_view container, Lookup lookup, OnValue onValue)
+	{
+		Cursor c{ json.data(), json.data() + json.size() };
+
+		auto readField = [&](std::string_view key)
+		{
+			const int index = lookup(key);
+			c.skipSpace();
+			if (index < 0 || c.peek() == '{' || c.peek() == '[') return skipValue(c);
+
+			double value = 0.0;
+			if (!readNumber(c, value)) return false;
+			onValue(index, value);
+			return true;
+		};
+
+		if (container.empty())
+			return readObject(c, readField);
+
+		return readObject(c, [&](std::string_view key)
+		{
+			c.skipSpace();
+			if (key != container || c.peek() != '{') return skipValue(c);
+			return readObject(c, readField);
+		});
+	}
+
+	void setOrderBookValue(OrderBook& book, OrderBookColumn column, int level, double value)
+	{
+		switch (column)
+		{
+		case OrderBookColumn::AskPrice:    book.asks[level].price = value; break;
+		case OrderBookColumn::BidPrice:    book.bids[level].price = value; break;
+		case OrderBookColumn::AskQuantity: book.asks[level].quantity = static_cast<qint64>(value); break;
+		case OrderBookColumn::BidQuantity: book.bids[level].quantity = static_cast<qint64>(value); break;
+		case OrderBookColumn::TotalAsk:    book.totalAskQuantity = static_cast<qint64>(value); break;
+		case OrderBookColumn::TotalBid:    book.totalBidQuantity = static_cast<qint64>(value); break;
+		}
+	}
+
+	void apply(StockData& data, QuoteField field, double value)
+	{
+		switch (field)
+		{
+		case QuoteField::CurrentPrice: data.currentPrice = value; break;
+		case QuoteField::HighPrice:    data.highPrice = value; break;
+		case QuoteField::LowPrice:     data.lowPrice = value; break;
+		case QuoteField::OpenPrice:    data.openPrice = value; break;
+		case QuoteField::PrevClose:    data.prevClose = value; break;
+		case QuoteField::Volume:       data.volume = static_cast<long long>(value); break;
+		default: break;
+		}
+	}
+}
+
+bool QuoteParser::parse(QByteArrayView json, const QuoteSchemaSpec& schema, StockData& data)
+{
+	std::array<bool, static_cast<int>(QuoteField::Count)> seen{};
+	double change = 0.0;
+
+	const bool ok = readNumbers(json, schema.container,
+		[&schema](std::string_view key)
+		{
+			for (int i = 0; i < schema.fieldCount; ++i)
+			{
+				if (schema.fields[i].key == key) return i;
+			}
+			return -1;
+		},
+		[&](int index, double value)
+		{
+			const QuoteField field = schema.fields[index].field;
+			seen[static_cast<int>(field)] = true;
+			if (field == QuoteField::Change)
+				change = value;
+			else
+				apply(data, field, value);
+		});
+
+	if (!ok || !seen[static_cast<int>(QuoteField::CurrentPrice)]) return false;
+
+	// 전일 종가를 따로 안 주는 응답 (한투)
+	if (seen[static_cast<int>(QuoteField::Change)] && !seen[static_cast<int>(QuoteField::PrevClose)])
+		data.prevClose = data.currentPrice - change;
+	return true;
+}
+
+bool QuoteParser::parseKisOrderBook(QByteArrayView json, OrderBook& book)
+{
+	int found = 0;
+	const bool ok = readNumbers(json, QuoteSchema::KisOrderBookContainer,
+		[](std::string_view key)
+		{
+			// 호가 키는 전부 askp/bidp/total로 시작 (나머지 키는 첫 글자에서 걸러짐)
+			if (key.empty() || (key.front() != 'a' && key.front() != 'b' && key.front() != 't')) return -1;
+			for (int i = 0; i < static_cast<int>(std::size(QuoteSchema::KisOrderBookFields)); ++i)
+			{
+				if (QuoteSchema::KisOrderBookFields[i].key == key) return i;
+			}
+			return -1;
+		},
+		[&](int index, double value)
+		{
+			const OrderBookFieldSpec& spec = QuoteSchema::KisOrderBookFields[index];
+			setOrderBookValue(book, spec.column, spec.level, value);
+			++found;
+		});
+
+	return ok && found > 0;
+}
+
+bool QuoteParser::parseKisOrderBookFrame(QByteArrayView records, int recordCount, OrderBook& book, QByteArrayView* symbol)
+{
+	namespace Frame = QuoteSchema::KisOrderBookFrame;
+	if (recordCount < 1) return false;
+
+	// 여러 건이 한 프레임에 오면 '^'로 이어 붙어 있음 -> 마지막 (가장 최근) 건만
+	const std::string_view text(records.data(), static_cast<size_t>(records.size()));
+	const size_t fieldCount = static_cast<size_t>(std::count(text.begin(), text.end(), '^')) + 1;
+	const size_t perRecord = fieldCount / static_cast<size_t>(recordCount);
+	if (perRecord < static_cast<size_t>(Frame::MinFieldCount) || perRecord * recordCount != fieldCount) return false;
+
+	size_t start = 0;
+	for (size_t skip = perRecord * (recordCount - 1); skip > 0; --skip)
+		start = text.find('^', start) + 1;
+
+	// 필드 번호 -> (열, 단계)
+	auto column = [](int field, OrderBookColumn& col, int& level)
+	{
+		if (field >= Frame::AskPrice && field < Frame::TotalAsk)
+		{
+			static constexpr OrderBookColumn columns[] = {
+				OrderBookColumn::AskPrice, OrderBookColumn::BidPrice, OrderBookColumn::AskQuantity, OrderBookColumn::BidQuantity
+			};
+			col = columns[(field - Frame::AskPrice) / OrderBook::Depth];
+			level = (field - Frame::AskPrice) % OrderBook::Depth;
+			return true;
+		}
+		level = 0;
+		if (field == Frame::TotalAsk) { col = OrderBookColumn::TotalAsk; return true; }
+		if (field == Frame::TotalBid) { col = OrderBookColumn::TotalBid; return true; }
+		return false;
+	};
+
+	for (int field = 0; field < Frame::MinFieldCount; ++field)
+	{
+		const size_t end = std::min(text.find('^', start), text.size());
+		const std::string_view value = text.substr(start, end - start);
+		start = end + 1;
+
+		OrderBookColumn col;
+		int level;
+		if (field == Frame::Symbol && symbol)
+			*symbol = QByteArrayView(value.data(), static_cast<qsizetype>(value.size()));
+		else if (column(field, col, level))
+			setOrderBookValue(book, col, level, toNumber(value));
+	}
+	return true;
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <QByteArrayView>
+#include "QuoteSchema.h"
+#include "StockData.h"
+#include "OrderBook.h"
+
+// 시세/호가 응답 본문을 앞에서부터 한 번만 훑으면서 스키마에 있는 키만 StockData에 바로 채움
+// QJsonDocument(DOM)도, 키/값마다 QString도 만들지 않음. 모르는 키와 중첩 값은 건너뜀
+class QuoteParser
+{
+public:
+	// 가격 필드만 채움 (심볼/이름/시각은 호출한 쪽에서). 형식이 깨졌거나 현재가가 없으면 false
+	static bool parse(QByteArrayView json, const QuoteSchemaSpec& schema, StockData& data);
+
+	// 한투 호가 조회 응답 (FHKST01010200). 호가 키가 하나도 없으면 false
+	static bool parseKisOrderBook(QByteArrayView json, OrderBook& book);
+	// 한투 실시간 호가 (H0STASP0) 프레임의 데이터 부분 ("005930^093730^0^..."). recordCount건 중 마지막 건만
+	static bool parseKisOrderBookFrame(QByteArrayView records, int recordCount, OrderBook& book, QByteArrayView* symbol = nullptr);
+};
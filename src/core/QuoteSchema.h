@@ -0,0 +1,126 @@
+#pragma once
+#include <QtGlobal>
+#include <iterator>
+#include <string_view>
+
+// 시세 응답에서 꺼내는 값 (StockData 가격 필드)
+enum class QuoteField : quint8
+{
+	CurrentPrice,	// 현재가
+	HighPrice,		// 고가
+	LowPrice,		// 저가
+	OpenPrice,		// 시가
+	PrevClose,		// 전일 종가
+	Change,			// 전일 대비 (전일 종가가 없는 응답은 현재가 - 대비로 계산)
+	Volume,			// 누적 거래량
+	Count
+};
+
+// 호가 응답에서 꺼내는 값 (OrderBook)
+enum class OrderBookColumn : quint8
+{
+	AskPrice,		// 매도호가 n
+	BidPrice,		// 매수호가 n
+	AskQuantity,	// 매도호가 잔량 n
+	BidQuantity,	// 매수호가 잔량 n
+	TotalAsk,		// 총 매도호가 잔량
+	TotalBid		// 총 매수호가 잔량
+};
+
+struct OrderBookFieldSpec
+{
+	std::string_view key;
+	OrderBookColumn column;
+	quint8 level;			// 0 = 1호가
+};
+
+struct QuoteFieldSpec
+{
+	std::string_view key;	// JSON 키 (이스케이프 없는 ASCII)
+	QuoteField field;
+};
+
+// 제공자별 시세 응답 형태 (숫자는 그대로 와도 "71200"처럼 문자열로 와도 됨)
+struct QuoteSchemaSpec
+{
+	std::string_view container;		// 값들이 들어 있는 객체 키 (비어 있으면 최상위)
+	const QuoteFieldSpec* fields;
+	int fieldCount;
+};
+
+namespace QuoteSchema
+{
+	using F = QuoteField;
+
+	// /quote: {"c":261.74,"d":0.5,"dp":0.19,"h":263.31,"l":260.68,"o":261.07,"pc":261.24,"t":1727812801}
+	constexpr QuoteFieldSpec FinnhubFields[] = {
+		{ "c", F::CurrentPrice }, { "h", F::HighPrice }, { "l", F::LowPrice },
+		{ "o", F::OpenPrice }, { "pc", F::PrevClose },
+	};
+
+	// inquire-price: {"output":{"stck_prpr":"71200","prdy_vrss":"-800", ...}, "rt_cd":"0", ...}
+	constexpr QuoteFieldSpec KisFields[] = {
+		{ "stck_prpr", F::CurrentPrice }, { "stck_hgpr", F::HighPrice }, { "stck_lwpr", F::LowPrice },
+		{ "stck_oprc", F::OpenPrice }, { "prdy_vrss", F::Change }, { "acml_vol", F::Volume },
+	};
+
+	constexpr QuoteSchemaSpec Finnhub{ "", FinnhubFields, static_cast<int>(std::size(FinnhubFields)) };
+	constexpr QuoteSchemaSpec Kis{ "output", KisFields, static_cast<int>(std::size(KisFields)) };
+
+	// 주식현재가 호가/예상체결 (FHKST01010200): {"output1":{"askp1":"71300", ..., "total_askp_rsqn":"..."}, "output2":{...}}
+	constexpr std::string_view KisOrderBookContainer = "output1";
+
+	using C = OrderBookColumn;
+	constexpr OrderBookFieldSpec KisOrderBookFields[] = {
+		{ "askp1", C::AskPrice, 0 }, { "askp2", C::AskPrice, 1 }, { "askp3", C::AskPrice, 2 }, { "askp4", C::AskPrice, 3 }, { "askp5", C::AskPrice, 4 },
+		{ "askp6", C::AskPrice, 5 }, { "askp7", C::AskPrice, 6 }, { "askp8", C::AskPrice, 7 }, { "askp9", C::AskPrice, 8 }, { "askp10", C::AskPrice, 9 },
+		{ "bidp1", C::BidPrice, 0 }, { "bidp2", C::BidPrice, 1 }, { "bidp3", C::BidPrice, 2 }, { "bidp4", C::BidPrice, 3 }, { "bidp5", C::BidPrice, 4 },
+		{ "bidp6", C::BidPrice, 5 }, { "bidp7", C::BidPrice, 6 }, { "bidp8", C::BidPrice, 7 }, { "bidp9", C::BidPrice, 8 }, { "bidp10", C::BidPrice, 9 },
+		{ "askp_rsqn1", C::AskQuantity, 0 }, { "askp_rsqn2", C::AskQuantity, 1 }, { "askp_rsqn3", C::AskQuantity, 2 }, { "askp_rsqn4", C::AskQuantity, 3 }, { "askp_rsqn5", C::AskQuantity, 4 },
+		{ "askp_rsqn6", C::AskQuantity, 5 }, { "askp_rsqn7", C::AskQuantity, 6 }, { "askp_rsqn8", C::AskQuantity, 7 }, { "askp_rsqn9", C::AskQuantity, 8 }, { "askp_rsqn10", C::AskQuantity, 9 },
+		{ "bidp_rsqn1", C::BidQuantity, 0 }, { "bidp_rsqn2", C::BidQuantity, 1 }, { "bidp_rsqn3", C::BidQuantity, 2 }, { "bidp_rsqn4", C::BidQuantity, 3 }, { "bidp_rsqn5", C::BidQuantity, 4 },
+		{ "bidp_rsqn6", C::BidQuantity, 5 }, { "bidp_rsqn7", C::BidQuantity, 6 }, { "bidp_rsqn8", C::BidQuantity, 7 }, { "bidp_rsqn9", C::BidQuantity, 8 }, { "bidp_rsqn10", C::BidQuantity, 9 },
+		{ "total_askp_rsqn", C::TotalAsk, 0 }, { "total_bidp_rsqn", C::TotalBid, 0 },
+	};
+
+	// 실시간 호가 (H0STASP0): "0|H0STASP0|001|005930^093730^0^매도호가1^...", 값은 '^' 구분
+	// 앞에서부터 종목코드, 영업시간, 시간구분, 매도호가 1~10, 매수호가 1~10, 매도잔량 1~10, 매수잔량 1~10, 총 매도잔량, 총 매수잔량 ...
+	namespace KisOrderBookFrame
+	{
+		constexpr int Symbol = 0;
+		constexpr int AskPrice = 3;
+		constexpr int BidPrice = AskPrice + 10;
+		constexpr int AskQuantity = BidPrice + 10;
+		constexpr int BidQuantity = AskQuantity + 10;
+		constexpr int TotalAsk = BidQuantity + 10;
+		constexpr int TotalBid = TotalAsk + 1;
+		constexpr int MinFieldCount = TotalBid + 1;
+	}
+
+	// 키 중복이 있으면 뒤 값이 앞 값을 덮으므로 컴파일 시간에 막음
+	constexpr bool hasUniqueKeys(const QuoteSchemaSpec& schema)
+	{
+		for (int i = 0; i < schema.fieldCount; ++i)
+		{
+			for (int j = i + 1; j < schema.fieldCount; ++j)
+			{
+				if (schema.fields[i].key == schema.fields[j].key) return false;
+			}
+		}
+		return true;
+	}
+
+	// 현재가가 없으면 응답으로 인정하지 않음
+	constexpr bool hasField(const QuoteSchemaSpec& schema, QuoteField field)
+	{
+		for (int i = 0; i < schema.fieldCount; ++i)
+		{
+			if (schema.fields[i].field == field) return true;
+		}
+		return false;
+	}
+
+	static_assert(hasUniqueKeys(Finnhub) && hasUniqueKeys(Kis), "시세 스키마 키 중복");
+	static_assert(std::size(KisOrderBookFields) == 4 * 10 + 2, "호가 스키마는 10단계 x 4 + 총 잔량 2");
+	static_assert(hasField(Finnhub, F::CurrentPrice) && hasField(Kis, F::CurrentPrice), "시세 스키마에 현재가 없음");
+}
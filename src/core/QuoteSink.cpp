@@ -0,0 +1,159 @@
+#include "QuoteSink.h"
+#include <QFileInfo>
+#include <QDir>
+#include <QDebug>
+
+namespace
+{
+	constexpr int FlushThreshold = 64 * 1024;	// 버퍼가 이만큼 차면 flush() 전이라도 씀
+
+	// CSV 칸에 쉼표/따옴표가 있으면 따옴표로 감쌈
+	QByteArray csvField(const QString& text)
+	{
+		QByteArray bytes = text.toUtf8();
+		if (!bytes.contains(',') && !bytes.contains('"') && !bytes.contains('\n'))
+			return bytes;
+		bytes.replace("\"", "\"\"");
+		return '"' + bytes + '"';
+	}
+
+	QByteArray number(double value)
+	{
+		return QByteArray::number(value, 'g', 12);
+	}
+}
+
+std::unique_ptr<QuoteSink> QuoteSink::create(const QString& format, const QString& path)
+{
+	const QString name = format.trimmed().toLower();
+	if (name == "csv")
+		return std::make_unique<TextQuoteSink>(TextQuoteSink::Format::Csv, path);
+	if (name == "ndjson" || name == "jsonl")
+		return std::make_unique<TextQuoteSink>(TextQuoteSink::Format::Ndjson, path);
+	if (name == "journal")
+		return std::make_unique<JournalQuoteSink>(path);
+
+	qDebug() << "[QuoteSink] 알 수 없는 형식:" << format;
+	return nullptr;
+}
+
+TextQuoteSink::TextQuoteSink(Format format, const QString& path) : m_format(format), m_file(path)
+{
+}
+
+TextQuoteSink::~TextQuoteSink()
+{
+	close();
+}
+
+bool TextQuoteSink::open()
+{
+	QDir().mkpath(QFileInfo(m_file.fileName()).absolutePath());
+	if (!m_file.open(QIODevice::WriteOnly | QIODevice::Append))
+	{
+		qDebug() << "[QuoteSink] 파일 열기 실패:" << m_file.fileName();
+		return false;
+	}
+
+	// 새 CSV 파일이면 헤더부터
+	if (m_format == Format::Csv && m_file.size() == 0)
+		m_buffer += "t,symbol,name,c,o,h,l,pc,v\n";
+	return true;
+}
+
+bool TextQuoteSink::write(const StockData& data)
+{
+	if (!m_file.isOpen()) return false;
+
+	if (m_format == Format::Csv)
+		appendCsv(data);
+	else
+		appendNdjson(data);
+	++m_written;
+
+	if (m_buffer.size() >= FlushThreshold)
+		flush();
+	return true;
+}
+
+void TextQuoteSink::appendCsv(const StockData& data)
+{
+	m_buffer += QByteArray::number(data.timestamp);
+	m_buffer += ',';
+	m_buffer += csvField(data.symbol);
+	m_buffer += ',';
+	m_buffer += csvField(data.name);
+	m_buffer += ',';
+	m_buffer += number(data.currentPrice);
+	m_buffer += ',';
+	m_buffer += number(data.openPrice);
+	m_buffer += ',';
+	m_buffer += number(data.highPrice);
+	m_buffer += ',';
+	m_buffer += number(data.lowPrice);
+	m_buffer += ',';
+	m_buffer += number(data.prevClose);
+	m_buffer += ',';
+	m_buffer += QByteArray::number(data.volume);
+	m_buffer += '\n';
+}
+
+void TextQuoteSink::appendNdjson(const StockData& data)
+{
+	// 심볼은 종목코드/티커라 이스케이프할 문자가 없음
+	m_buffer += "{\"t\":";
+	m_buffer += QByteArray::number(data.timestamp);
+	m_buffer += ",\"symbol\":\"";
+	m_buffer += data.symbol.toUtf8();
+	m_buffer += "\",\"c\":";
+	m_buffer += number(data.currentPrice);
+	m_buffer += ",\"o\":";
+	m_buffer += number(data.openPrice);
+	m_buffer += ",\"h\":";
+	m_buffer += number(data.highPrice);
+	m_buffer += ",\"l\":";
+	m_buffer += number(data.lowPrice);
+	m_buffer += ",\"pc\":";
+	m_buffer += number(data.prevClose);
+	m_buffer += ",\"v\":";
+	m_buffer += QByteArray::number(data.volume);
+	m_buffer += "}\n";
+}
+
+void TextQuoteSink::flush()
+{
+	if (!m_file.isOpen() || m_buffer.isEmpty()) return;
+
+	if (m_file.write(m_buffer) != m_buffer.size())
+		qDebug() << "[QuoteSink] 쓰기 실패:" << m_file.fileName() << m_file.errorString();
+	m_file.flush();
+	m_buffer.clear();
+}
+
+void TextQuoteSink::close()
+{
+	if (!m_file.isOpen()) return;
+	flush();
+	m_file.close();
+}
+
+JournalQuoteSink::JournalQuoteSink(const QString& dir) : m_journal(dir)
+{
+}
+
+bool JournalQuoteSink::open()
+{
+	return m_journal.start();
+}
+
+bool JournalQuoteSink::write(const StockData& data)
+{
+	if (!m_journal.record(data)) return false;
+	++m_written;
+	return true;
+}
+
+void JournalQuoteSink::close()
+{
+	m_journal.stop();
+}
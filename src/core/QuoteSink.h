@@ -0,0 +1,68 @@
+#pragma once
+#include <QString>
+#include <QFile>
+#include <memory>
+#include "StockData.h"
+#include "TickJournal.h"
+
+// 수신한 시세를 어딘가에 계속 기록하는 출력 (수집기/GUI 공용)
+//
+// 형식
+//   - csv    : t,symbol,name,c,o,h,l,pc,v 헤더가 붙은 CSV (이어쓰기)
+//   - ndjson : ReplayAPI가 그대로 읽는 한 줄 JSON (이어쓰기)
+//   - journal: TickJournal 바이너리 저널 (path = 디렉터리)
+class QuoteSink
+{
+public:
+	virtual ~QuoteSink() = default;
+
+	virtual bool open() = 0;
+	virtual bool write(const StockData& data) = 0;
+	virtual void flush() {}
+	virtual void close() {}
+
+	quint64 writtenCount() const { return m_written; }
+
+	// format: "csv" / "ndjson" / "journal". 모르는 형식이면 nullptr
+	static std::unique_ptr<QuoteSink> create(const QString& format, const QString& path);
+
+protected:
+	quint64 m_written = 0;
+};
+
+// CSV / NDJSON 공통 (텍스트 한 줄씩 덧붙임)
+class TextQuoteSink : public QuoteSink
+{
+public:
+	enum class Format { Csv, Ndjson };
+
+	TextQuoteSink(Format format, const QString& path);
+	~TextQuoteSink() override;
+
+	bool open() override;
+	bool write(const StockData& data) override;
+	void flush() override;
+	void close() override;
+
+private:
+	Format m_format;
+	QFile m_file;
+	QByteArray m_buffer;		// flush() 전까지 모아두는 줄들
+
+	void appendCsv(const StockData& data);
+	void appendNdjson(const StockData& data);
+};
+
+// TickJournal 래퍼 (기록은 저널 전용 스레드가 함)
+class JournalQuoteSink : public QuoteSink
+{
+public:
+	explicit JournalQuoteSink(const QString& dir);
+
+	bool open() override;
+	bool write(const StockData& data) override;
+	void close() override;
+
+private:
+	TickJournal m_journal;
+};
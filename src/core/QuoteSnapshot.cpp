@@ -0,0 +1,90 @@
+#include "QuoteSnapshot.h"
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+#include <QDebug>
+#include <cstring>
+
+bool QuoteSnapshot::save(const QString& path, const QVector<Entry>& entries, qint64 savedAt)
+{
+	// 쓰는 도중 꺼져도 이전 스냅샷이 남도록 임시 파일에 쓰고 교체
+	QSaveFile file(path);
+	if (!file.open(QIODevice::WriteOnly))
+	{
+		qDebug() << "[Snapshot] 저장 실패:" << path;
+		return false;
+	}
+
+	QDataStream out(&file);
+	out.setVersion(QDataStream::Qt_6_0);
+	out.setByteOrder(QDataStream::LittleEndian);
+	out.writeRawData(Magic, sizeof(Magic));
+	out << Version << savedAt << static_cast<quint32>(entries.size());
+
+	for (const Entry& entry : entries)
+	{
+		const StockData& quote = entry.quote;
+		out << quote.symbol.toUtf8() << quote.name.toUtf8() << entry.logoFile.toUtf8();
+		out << quote.currentPrice << quote.openPrice << quote.highPrice << quote.lowPrice << quote.prevClose;
+		out << static_cast<qint64>(quote.volume) << quote.timestamp;
+	}
+
+	return out.status() == QDataStream::Ok && file.commit();
+}
+
+bool QuoteSnapshot::load(const QString& path, QVector<Entry>& entries, qint64* savedAt)
+{
+	entries.clear();
+
+	QFile file(path);
+	if (!file.open(QIODevice::ReadOnly))
+		return false;	// 아직 저장한 적 없음
+
+	// 수십 KB라 한 번에 읽고 메모리에서 풂
+	const QByteArray bytes = file.readAll();
+	QDataStream in(bytes);
+	in.setVersion(QDataStream::Qt_6_0);
+	in.setByteOrder(QDataStream::LittleEndian);
+
+	char magic[sizeof(Magic)] = {};
+	quint32 version = 0;
+	qint64 time = 0;
+	quint32 count = 0;
+	in.readRawData(magic, sizeof(magic));
+	in >> version >> time >> count;
+	if (in.status() != QDataStream::Ok || std::memcmp(magic, Magic, sizeof(Magic)) != 0 || version != Version || count > MaxEntries)
+	{
+		qDebug() << "[Snapshot] 형식이 다르거나 지원하지 않는 버전:" << path;
+		return false;
+	}
+
+	entries.reserve(count);
+	for (quint32 i = 0; i < count; ++i)
+	{
+		QByteArray symbol, name, logoFile;
+		qint64 volume = 0;
+		Entry entry;
+		StockData& quote = entry.quote;
+		in >> symbol >> name >> logoFile;
+		in >> quote.currentPrice >> quote.openPrice >> quote.highPrice >> quote.lowPrice >> quote.prevClose;
+		in >> volume >> quote.timestamp;
+		if (in.status() != QDataStream::Ok || symbol.isEmpty()) break;
+
+		quote.symbol = QString::fromUtf8(symbol);
+		quote.name = QString::fromUtf8(name);
+		quote.volume = volume;
+		entry.logoFile = QString::fromUtf8(logoFile);
+		entries.append(entry);
+	}
+
+	if (entries.size() != static_cast<qsizetype>(count))
+	{
+		qDebug() << "[Snapshot] 파일이 잘림:" << path;
+		entries.clear();
+		return false;
+	}
+
+	if (savedAt)
+		*savedAt = time;
+	return true;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <QString>
+#include <QVector>
+#include "StockData.h"
+
+// 마지막 시세 스냅샷 (빠른 시작용)
+// 관심종목의 마지막 시세/이름/로고 파일 이름을 작은 바이너리 파일로 저장해두고,
+// 다음 실행 때 인증/네트워크를 기다리지 않고 첫 화면에 그림 (실시간 시세가 오면 덮임)
+//
+// [헤더] magic "SFQS", version(u32), savedAt(i64, epoch ms), count(u32)
+// [종목 x count] 심볼, 이름, 로고 파일 (각각 u32 길이 + UTF-8), 현재가/시가/고가/저가/전일종가(double), 거래량, 시각(i64)
+// 리틀 엔디언. 중간에 잘렸거나 버전이 다르면 통째로 버림
+class QuoteSnapshot
+{
+public:
+	struct Entry
+	{
+		StockData quote;
+		QString logoFile;	// 로고 캐시 폴더 기준 파일 이름 (없으면 빈 문자열)
+	};
+
+	static bool save(const QString& path, const QVector<Entry>& entries, qint64 savedAt);
+	// 실패하면 entries는 비어있음
+	static bool load(const QString& path, QVector<Entry>& entries, qint64* savedAt = nullptr);
+
+private:
+	static constexpr char Magic[4] = { 'S', 'F', 'Q', 'S' };
+	static constexpr quint32 Version = 1;
+	static constexpr quint32 MaxEntries = 100000;	// 깨진 파일에서 터무니없는 크기를 잡지 않게
+};
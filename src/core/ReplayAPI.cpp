@@ -0,0 +1,196 @@
+#include "ReplayAPI.h"
+#include "TickJournalReader.h"
+#include "StockCodeMap.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QDebug>
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+	// 최대 속도 모드에서 이벤트 루프 한 번에 내보낼 틱 수 (그 사이에 화면이 그려짐)
+	constexpr size_t MaxBatch = 512;
+}
+
+ReplayAPI::ReplayAPI(const QString& path, double speed, QObject* parent)
+	: StockAPI(parent), m_path(path), m_speed(speed)
+{
+	m_timer = new QTimer(this);
+	m_timer->setSingleShot(true);
+	m_timer->setTimerType(Qt::PreciseTimer);
+	connect(m_timer, &QTimer::timeout, this, &ReplayAPI::emitDueTicks);
+}
+
+bool ReplayAPI::load()
+{
+	m_ticks.clear();
+
+	QFileInfo info(m_path);
+	bool ok = (info.isDir() || info.suffix() == "sfj") ? loadJournal() : loadNdjson();
+	if (!ok) return false;
+
+	// 여러 파일을 합친 경우를 위해 시간순 정렬 (같은 시각은 기록 순서 유지)
+	std::stable_sort(m_ticks.begin(), m_ticks.end(),
+		[](const StockData& a, const StockData& b) { return a.timestamp < b.timestamp; });
+
+	qDebug() << "[Replay]" << m_path << "에서" << m_ticks.size() << "개 틱 로드";
+	return !m_ticks.empty();
+}
+
+bool ReplayAPI::loadNdjson()
+{
+	QFile file(m_path);
+	if (!file.open(QIODevice::ReadOnly))
+	{
+		qDebug() << "[Replay] 파일을 찾을 수 없음:" << m_path;
+		return false;
+	}
+
+	// 같은 심볼은 QString 하나를 공유
+	QHash<QString, QString> symbols;
+	int lineNo = 0;
+
+	while (!file.atEnd())
+	{
+		QByteArray line = file.readLine().trimmed();
+		++lineNo;
+		if (line.isEmpty()) continue;
+
+		QJsonObject obj = QJsonDocument::fromJson(line).object();
+		QString symbol = obj["symbol"].toString();
+		if (symbol.isEmpty())
+		{
+			qDebug() << "[Replay] 잘못된 줄 무시:" << lineNo;
+			continue;
+		}
+
+		auto it = symbols.constFind(symbol);
+		if (it == symbols.cend())
+			it = symbols.insert(symbol, symbol);
+
+		StockData data;
+		data.symbol = it.value();
+		data.name = StockCodeMap::getName(data.symbol);
+		data.timestamp = static_cast<qint64>(obj["t"].toDouble());
+		data.currentPrice = obj["c"].toDouble();
+		data.openPrice = obj["o"].toDouble();
+		data.highPrice = obj["h"].toDouble();
+		data.lowPrice = obj["l"].toDouble();
+		data.prevClose = obj["pc"].toDouble();
+		data.volume = static_cast<long long>(obj["v"].toDouble());
+		m_ticks.push_back(data);
+	}
+	return true;
+}
+
+bool ReplayAPI::loadJournal()
+{
+	TickJournalReader reader(m_path);
+	if (reader.segments().isEmpty())
+	{
+		qDebug() << "[Replay] 저널 세그먼트가 없음:" << m_path;
+		return false;
+	}
+
+	QHash<QString, QString> symbols;
+	reader.scan(std::numeric_limits<qint64>::min(), std::numeric_limits<qint64>::max(),
+		[&](const JournalRecord& record)
+		{
+			QString symbol = QString::fromUtf8(record.symbol);
+			auto it = symbols.constFind(symbol);
+			if (it == symbols.cend())
+				it = symbols.insert(symbol, symbol);
+
+			StockData data;
+			data.symbol = it.value();
+			data.name = StockCodeMap::getName(data.symbol);
+			data.timestamp = record.timestamp;
+			data.currentPrice = record.price;
+			data.openPrice = record.open;
+			data.highPrice = record.high;
+			data.lowPrice = record.low;
+			data.prevClose = record.prevClose;
+			data.volume = record.volume;
+			m_ticks.push_back(data);
+			return true;
+		});
+	return true;
+}
+
+void ReplayAPI::start()
+{
+	if (m_ticks.empty()) return;
+
+	m_next = 0;
+	m_maxLagMs = 0;
+	m_lastEmitted.clear();
+	m_clock.start();
+
+	qDebug() << "[Replay] 시작 (배속:" << (m_speed > 0 ? QString::number(m_speed) : QString("max")) << ")";
+	m_timer->start(0);
+}
+
+void ReplayAPI::stop()
+{
+	m_timer->stop();
+}
+
+void ReplayAPI::emitDueTicks()
+{
+	const qint64 base = m_ticks.front().timestamp;
+	const qint64 elapsed = m_clock.elapsed();
+	size_t emitted = 0;
+
+	while (m_next < m_ticks.size())
+	{
+		const StockData& tick = m_ticks[m_next];
+
+		if (m_speed > 0)
+		{
+			// 원래 간격 / 배속 = 재생 시각
+			const qint64 due = static_cast<qint64>((tick.timestamp - base) / m_speed);
+			if (due > elapsed)
+			{
+				m_timer->start(static_cast<int>(qMin<qint64>(due - elapsed, std::numeric_limits<int>::max())));
+				return;
+			}
+			m_maxLagMs = qMax(m_maxLagMs, elapsed - due);
+		}
+		else if (emitted >= MaxBatch)
+		{
+			m_timer->start(0);
+			return;
+		}
+
+		m_lastEmitted.insert(tick.symbol, m_next);
+		++m_next;
+		++emitted;
+		emit dataReceived(tick);
+	}
+
+	finish();
+}
+
+void ReplayAPI::finish()
+{
+	const qint64 elapsed = qMax<qint64>(m_clock.elapsed(), 1);
+	qDebug().noquote() << QString("[Replay] 완료: %1 틱 / %2 ms (%3 ticks/s), 최대 지연 %4 ms")
+		.arg(m_ticks.size()).arg(elapsed)
+		.arg(m_ticks.size() * 1000.0 / elapsed, 0, 'f', 0)
+		.arg(m_maxLagMs);
+	emit finished();
+}
+
+void ReplayAPI::fetchStock(const QString& symbol)
+{
+	auto it = m_lastEmitted.constFind(symbol);
+	if (it != m_lastEmitted.cend())
+		emit dataReceived(m_ticks[it.value()]);
+}
+
+void ReplayAPI::fetchLogo(const QString&)
+{
+}
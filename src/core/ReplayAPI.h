@@ -0,0 +1,54 @@
+#pragma once
+
+#include "StockAPI.h"
+#include <QElapsedTimer>
+#include <QHash>
+#include <QTimer>
+#include <vector>
+
+// 기록해둔 시세를 원래 간격대로 (또는 배속/최대 속도로) 다시 내보내는 가짜 API
+// 네트워크 없이 장 시작 폭주 같은 상황을 재현해서 GUI 처리량을 잴 때 사용
+//
+// 입력 형식
+//   - NDJSON (*.ndjson, *.jsonl): 한 줄에 {"t":epoch ms,"symbol":..,"c":..,"o":..,"h":..,"l":..,"pc":..,"v":..}
+//   - 틱 저널 (*.sfj 파일 또는 세그먼트가 든 디렉터리)
+class ReplayAPI : public StockAPI
+{
+	Q_OBJECT
+
+public:
+	// speed: 1.0 = 실시간, 10.0 = 10배속, 0 이하 = 기다리지 않고 최대한 빠르게
+	explicit ReplayAPI(const QString& path, double speed = 1.0, QObject* parent = nullptr);
+
+	bool load();
+	void start();
+	void stop();
+
+	int tickCount() const { return static_cast<int>(m_ticks.size()); }
+
+	// 마지막으로 내보낸 시세를 다시 보내줌 (로고는 없음)
+	void fetchStock(const QString& symbol) override;
+	void fetchLogo(const QString& symbol) override;
+
+signals:
+	void finished();
+
+private slots:
+	void emitDueTicks();
+
+private:
+	QString m_path;
+	double m_speed;
+
+	std::vector<StockData> m_ticks;		// 시간순
+	size_t m_next = 0;
+	QHash<QString, size_t> m_lastEmitted;	// 심볼별 마지막으로 보낸 틱 위치
+
+	QTimer* m_timer;
+	QElapsedTimer m_clock;
+	qint64 m_maxLagMs = 0;				// 예정 시각보다 늦게 나간 최대 시간
+
+	bool loadNdjson();
+	bool loadJournal();
+	void finish();
+};
@@ -0,0 +1,266 @@
+#include "Screener.h"
+#include <QDebug>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+	constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+	// 조건 하나 = 배열 한 번. 분기 없이 마스크에 AND (NaN은 비교가 모두 거짓이라 자연히 탈락)
+	void applyRange(const double* values, int count, double min, double max, quint8* mask)
+	{
+		for (int i = 0; i < count; ++i)
+			mask[i] &= static_cast<quint8>((values[i] >= min) & (values[i] <= max));
+	}
+
+	void applyFlag(const quint8* values, int count, quint8 required, quint8* mask)
+	{
+		for (int i = 0; i < count; ++i)
+			mask[i] &= static_cast<quint8>(values[i] == required);
+	}
+
+	void applyEquals(const qint32* values, int count, qint32 required, quint8* mask)
+	{
+		for (int i = 0; i < count; ++i)
+			mask[i] &= static_cast<quint8>(values[i] == required);
+	}
+
+	void applyMarkets(const quint8* markets, int count, quint8 allowed, quint8* mask)
+	{
+		for (int i = 0; i < count; ++i)
+			mask[i] &= static_cast<quint8>((allowed >> markets[i]) & 1);
+	}
+}
+
+Screener::Screener(QObject* parent) : QObject(parent)
+{
+}
+
+void Screener::clear()
+{
+	m_codes.clear();
+	m_names.clear();
+	m_index.clear();
+	for (std::vector<double>& column : m_columns)
+		column.clear();
+	m_prevClose.clear();
+	m_listedShares.clear();
+	m_market.clear();
+	m_industry.clear();
+	m_halted.clear();
+	m_quoted.clear();
+	++m_version;
+}
+
+void Screener::loadUniverse(const MstTable& master)
+{
+	// 쓰는 열만 해석 (나머지 필드는 MstTable에 원본 그대로)
+	const std::vector<qint64>& basePrice = master.integers(MstField::BasePrice);
+	const std::vector<qint64>& listedShares = master.integers(MstField::ListedShares);
+	const std::vector<qint64>& prevVolume = master.integers(MstField::PrevVolume);
+	const std::vector<qint64>& listingDate = master.integers(MstField::ListingDate);
+	const std::vector<qint64>& industry = master.integers(MstField::IndustryLarge);
+	const std::vector<quint8>& halted = master.flags(MstField::Halted);
+	const std::vector<quint8>& administrative = master.flags(MstField::Administrative);
+
+	const int before = count();
+	const int n = master.count();
+	reserve(before + n);
+	for (int row = 0; row < n; ++row)
+	{
+		const QString name = master.name(row);
+		if (name.isEmpty()) continue;
+		addSymbol(master.code(row), name, master.market(row),
+			double(basePrice[row]),
+			double(listedShares[row]) * 1000.0,		// 천주 단위
+			double(prevVolume[row]),
+			halted[row] || administrative[row],
+			static_cast<int>(industry[row]),
+			double(listingDate[row]));
+	}
+	qDebug() << "[Screener]" << count() - before << "종목 추가";
+	emit universeChanged();
+}
+
+void Screener::reserve(int size)
+{
+	m_codes.reserve(size);
+	m_names.reserve(size);
+	m_index.reserve(size);
+	for (std::vector<double>& column : m_columns)
+		column.reserve(size);
+	m_prevClose.reserve(size);
+	m_listedShares.reserve(size);
+	m_market.reserve(size);
+	m_industry.reserve(size);
+	m_halted.reserve(size);
+	m_quoted.reserve(size);
+}
+
+void Screener::applyDelta(const MstTable& master, const MstDelta& delta)
+{
+	for (const QString& code : delta.removed)
+		removeSymbol(code);
+
+	for (const MstDelta::Entry& entry : delta.renamed)
+	{
+		const int row = indexOf(entry.code);
+		if (row >= 0)
+			m_names[row] = entry.name;
+	}
+
+	if (!delta.added.isEmpty())
+	{
+		const std::vector<qint64>& basePrice = master.integers(MstField::BasePrice);
+		const std::vector<qint64>& listedShares = master.integers(MstField::ListedShares);
+		const std::vector<qint64>& prevVolume = master.integers(MstField::PrevVolume);
+		const std::vector<qint64>& listingDate = master.integers(MstField::ListingDate);
+		const std::vector<qint64>& industry = master.integers(MstField::IndustryLarge);
+		const std::vector<quint8>& halted = master.flags(MstField::Halted);
+		const std::vector<quint8>& administrative = master.flags(MstField::Administrative);
+
+		for (const MstDelta::Entry& entry : delta.added)
+		{
+			const int row = master.indexOf(entry.code);
+			if (row < 0) continue;
+			addSymbol(entry.code, entry.name, entry.market,
+				double(basePrice[row]), double(listedShares[row]) * 1000.0, double(prevVolume[row]),
+				halted[row] || administrative[row], static_cast<int>(industry[row]), double(listingDate[row]));
+		}
+	}
+
+	++m_version;
+	if (!delta.added.isEmpty() || !delta.removed.isEmpty())
+		emit universeChanged();
+}
+
+bool Screener::removeSymbol(const QString& code)
+{
+	auto it = m_index.find(code);
+	if (it == m_index.end()) return false;
+	const int row = it.value();
+	m_index.erase(it);
+
+	// 마지막 행을 빈 자리로 옮김 (열마다 O(1))
+	const int last = count() - 1;
+	auto moveLast = [row, last](auto& column)
+	{
+		if (row != last)
+			column[row] = std::move(column[last]);
+		column.pop_back();
+	};
+	if (row != last)
+		m_index[m_codes[last]] = row;
+	moveLast(m_codes);
+	moveLast(m_names);
+	for (std::vector<double>& column : m_columns)
+		moveLast(column);
+	moveLast(m_prevClose);
+	moveLast(m_listedShares);
+	moveLast(m_market);
+	moveLast(m_industry);
+	moveLast(m_halted);
+	moveLast(m_quoted);
+
+	++m_version;
+	return true;
+}
+
+int Screener::addSymbol(const QString& code, const QString& name, Market market,
+	double basePrice, double listedShares, double prevVolume, bool halted, int industry, double listingDate)
+{
+	if (m_index.contains(code)) return -1;
+
+	const int row = count();
+	m_index.insert(code, row);
+	m_codes.push_back(code);
+	m_names.push_back(name);
+
+	// 시세가 오기 전에는 기준가(전일 종가)로 가격/시가총액을 채우고 등락률/거래량은 비워둠
+	m_columns[static_cast<int>(ScreenerField::Price)].push_back(basePrice);
+	m_columns[static_cast<int>(ScreenerField::ChangePercent)].push_back(NaN);
+	m_columns[static_cast<int>(ScreenerField::Volume)].push_back(NaN);
+	m_columns[static_cast<int>(ScreenerField::MarketCap)].push_back(basePrice * listedShares / 1e8);
+	m_columns[static_cast<int>(ScreenerField::PrevVolume)].push_back(prevVolume);
+	m_columns[static_cast<int>(ScreenerField::ListingDate)].push_back(listingDate);
+	m_prevClose.push_back(basePrice);
+	m_listedShares.push_back(listedShares);
+	m_market.push_back(static_cast<quint8>(market));
+	m_industry.push_back(industry);
+	m_halted.push_back(halted ? 1 : 0);
+	m_quoted.push_back(0);
+
+	++m_version;
+	return row;
+}
+
+void Screener::onTick(const StockData& data)
+{
+	auto it = m_index.constFind(data.symbol);
+	if (it == m_index.cend()) return;	// 미국 종목 등 목록에 없는 종목
+	const int row = it.value();
+
+	const double prevClose = data.prevClose > 0 ? data.prevClose : m_prevClose[row];
+	m_prevClose[row] = prevClose;
+	column(ScreenerField::Price)[row] = data.currentPrice;
+	column(ScreenerField::ChangePercent)[row] = prevClose > 0 ? (data.currentPrice - prevClose) / prevClose * 100.0 : NaN;
+	column(ScreenerField::Volume)[row] = static_cast<double>(data.volume);
+	column(ScreenerField::MarketCap)[row] = data.currentPrice * m_listedShares[row] / 1e8;
+	m_quoted[row] = 1;
+	++m_version;
+}
+
+std::vector<int> Screener::query(const ScreenerQuery& query) const
+{
+	const int n = count();
+	m_mask.assign(static_cast<size_t>(n), 1);
+	quint8* mask = m_mask.data();
+
+	if (query.markets != 0xFF)
+		applyMarkets(m_market.data(), n, query.markets, mask);
+	if (query.industry >= 0)
+		applyEquals(m_industry.data(), n, query.industry, mask);
+	if (query.excludeHalted)
+		applyFlag(m_halted.data(), n, 0, mask);
+	if (query.quotedOnly)
+		applyFlag(m_quoted.data(), n, 1, mask);
+	for (int f = 0; f < static_cast<int>(ScreenerField::Count); ++f)
+	{
+		const ScreenerQuery::Range& range = query.ranges[f];
+		if (range.enabled)
+			applyRange(m_columns[f].data(), n, range.min, range.max, mask);
+	}
+
+	std::vector<int> rows;
+	rows.reserve(static_cast<size_t>(n));
+	for (int i = 0; i < n; ++i)
+	{
+		if (mask[i])
+			rows.push_back(i);
+	}
+
+	// 값이 없는(NaN) 종목은 정렬 방향과 관계없이 맨 뒤
+	const double* key = column(query.sortBy);
+	const bool descending = query.descending;
+	auto before = [key, descending](int a, int b)
+	{
+		const double x = key[a];
+		const double y = key[b];
+		if (std::isnan(x) || std::isnan(y))
+			return !std::isnan(x) && std::isnan(y);
+		return descending ? x > y : x < y;
+	};
+
+	if (query.limit > 0 && static_cast<size_t>(query.limit) < rows.size())
+	{
+		std::partial_sort(rows.begin(), rows.begin() + query.limit, rows.end(), before);
+		rows.resize(static_cast<size_t>(query.limit));
+	}
+	else
+	{
+		std::sort(rows.begin(), rows.end(), before);
+	}
+	return rows;
+}
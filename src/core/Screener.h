@@ -0,0 +1,109 @@
+#pragma once
+
+#include <QObject>
+#include <QHash>
+#include <QString>
+#include <vector>
+#include "StockData.h"
+#include "MstTable.h"
+
+// 정렬/필터 대상 열
+enum class ScreenerField
+{
+	Price,
+	ChangePercent,
+	Volume,
+	MarketCap,		// 억원 (현재가 x 상장주수, 시세가 없으면 MST 기준가)
+	PrevVolume,		// MST 전일 거래량
+	ListingDate,	// MST 상장일자 (yyyyMMdd)
+	Count
+};
+
+// 화면 조건. 범위는 켠 것만 적용 (꺼진 조건은 시세 없는 종목도 통과)
+struct ScreenerQuery
+{
+	struct Range
+	{
+		bool enabled = false;
+		double min = -1e300;
+		double max = 1e300;
+	};
+
+	quint8 markets = 0xFF;					// 비트 = Market
+	Range ranges[static_cast<int>(ScreenerField::Count)];
+	bool excludeHalted = true;				// 거래정지/관리종목 제외
+	bool quotedOnly = false;				// 시세를 받은 종목만
+	int industry = -1;						// MST 지수업종 대분류 코드 (-1 = 전체)
+
+	ScreenerField sortBy = ScreenerField::ChangePercent;
+	bool descending = true;
+	int limit = 100;						// 0 = 전부
+
+	Range& range(ScreenerField field) { return ranges[static_cast<int>(field)]; }
+	const Range& range(ScreenerField field) const { return ranges[static_cast<int>(field)]; }
+};
+
+// 국내 전 종목 스크리너
+// 종목별 값을 열마다 연속된 배열(SoA)로 들고 있어 조건 하나가 배열 한 번 훑기 -> 컴파일러가 SIMD로 펼침
+// 시세가 오면 해당 종목 칸만 고침 (O(1)), 조회는 요청할 때 처음부터 다시 계산
+class Screener : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit Screener(QObject* parent = nullptr);
+
+	// MST 마스터 전 종목을 목록에 추가 (필요한 열만 해석됨)
+	void loadUniverse(const MstTable& master);
+	// MST 없이 직접 추가. 이미 있으면 -1
+	int addSymbol(const QString& code, const QString& name, Market market,
+		double basePrice, double listedShares, double prevVolume, bool halted = false,
+		int industry = 0, double listingDate = 0.0);
+	// 마스터 변경분만 반영 (폐지 종목은 마지막 행과 자리를 바꿔 제거 -> 행 번호가 바뀜)
+	void applyDelta(const MstTable& master, const MstDelta& delta);
+	bool removeSymbol(const QString& code);
+	void clear();
+
+	int count() const { return static_cast<int>(m_codes.size()); }
+	int indexOf(const QString& code) const { return m_index.value(code, -1); }
+
+	// 조건에 맞는 행 번호 (정렬, limit 적용)
+	std::vector<int> query(const ScreenerQuery& query) const;
+
+	const QString& code(int row) const { return m_codes[row]; }
+	const QString& name(int row) const { return m_names[row]; }
+	Market market(int row) const { return static_cast<Market>(m_market[row]); }
+	bool isQuoted(int row) const { return m_quoted[row] != 0; }
+	double value(int row, ScreenerField field) const { return column(field)[row]; }
+
+	// 시세가 들어올 때마다 증가 (결과 다시 계산할지 판단용)
+	quint64 version() const { return m_version; }
+
+public slots:
+	void onTick(const StockData& data);
+
+signals:
+	void universeChanged();		// 종목이 추가/삭제됨 (이전 조회 결과의 행 번호는 무효)
+
+private:
+	// 문자열 열 (조회에는 안 씀)
+	std::vector<QString> m_codes;
+	std::vector<QString> m_names;
+	QHash<QString, int> m_index;
+
+	// 숫자 열 (조회 대상)
+	std::vector<double> m_columns[static_cast<int>(ScreenerField::Count)];
+	std::vector<double> m_prevClose;
+	std::vector<double> m_listedShares;		// 주
+	std::vector<quint8> m_market;
+	std::vector<qint32> m_industry;
+	std::vector<quint8> m_halted;
+	std::vector<quint8> m_quoted;
+
+	mutable std::vector<quint8> m_mask;		// 조회용 작업 공간 (재할당 방지)
+	quint64 m_version = 0;
+
+	void reserve(int size);
+	const double* column(ScreenerField field) const { return m_columns[static_cast<int>(field)].data(); }
+	double* column(ScreenerField field) { return m_columns[static_cast<int>(field)].data(); }
+};
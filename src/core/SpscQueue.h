@@ -0,0 +1,69 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+// 단일 생산자 / 단일 소비자 lock-free 링버퍼
+// 생산자(GUI 스레드)는 절대 기다리지 않음. 가득 차면 tryPush()가 false 반환
+template <typename T, size_t Capacity>
+class SpscQueue
+{
+	static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+	SpscQueue() : m_slots(new T[Capacity]) {}
+
+	SpscQueue(const SpscQueue&) = delete;
+	SpscQueue& operator=(const SpscQueue&) = delete;
+
+	// 생산자 스레드 전용
+	bool tryPush(const T& value)
+	{
+		const size_t head = m_head.load(std::memory_order_relaxed);
+		if (head - m_tailCache >= Capacity)
+		{
+			m_tailCache = m_tail.load(std::memory_order_acquire);
+			if (head - m_tailCache >= Capacity) return false;
+		}
+
+		m_slots[head & Mask] = value;
+		m_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	// 소비자 스레드 전용
+	bool tryPop(T& out)
+	{
+		const size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail == m_headCache)
+		{
+			m_headCache = m_head.load(std::memory_order_acquire);
+			if (tail == m_headCache) return false;
+		}
+
+		out = std::move(m_slots[tail & Mask]);
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	// 소비자 스레드 전용
+	bool isEmpty() const
+	{
+		return m_tail.load(std::memory_order_relaxed) == m_head.load(std::memory_order_acquire);
+	}
+
+	size_t capacity() const { return Capacity; }
+
+private:
+	static constexpr size_t Mask = Capacity - 1;
+
+	// 생산자/소비자 인덱스를 다른 캐시라인에 둬서 false sharing 방지
+	alignas(64) std::atomic<size_t> m_head{ 0 };
+	size_t m_tailCache = 0;		// 생산자가 본 마지막 tail
+
+	alignas(64) std::atomic<size_t> m_tail{ 0 };
+	size_t m_headCache = 0;		// 소비자가 본 마지막 head
+
+	std::unique_ptr<T[]> m_slots;
+};
@@ -1,6 +1,8 @@
 #include "Config.h"
 #include "StockAPI.h"
 #include "NetworkUtils.h"
+#include "LatencyTracer.h"
+#include "StockCodeMap.h"
 
 StockAPI::StockAPI(QObject* parent)	: QObject(parent)
 {
@@ -22,11 +24,58 @@ void StockAPI::downloadLogoFromUrl(const QString& symbol, const QString& url)
 	QNetworkRequest request((QUrl(url)));
 	QNetworkReply* reply = manager->get(request);
 	reply->setProperty("TargetSymbol", symbol);
+	LatencyTracer::traceReply(reply, "logo", request.url().host(), symbol);
 	NetworkUtils::addTimeOut(reply, 10000);
 
 	connect(reply, &QNetworkReply::finished, this, &StockAPI::onGenericLogoDownloaded);
 }
 
+StockAPI::QuoteTarget& StockAPI::quoteTarget(const QString& symbol)
+{
+	auto it = m_quoteTargets.find(symbol);
+	if (it == m_quoteTargets.end())
+	{
+		it = m_quoteTargets.insert(symbol, QuoteTarget());
+		it->symbol = symbol;
+	}
+	return it.value();
+}
+
+void StockAPI::resetQuoteRequests()
+{
+	for (QuoteTarget& target : m_quoteTargets)
+	{
+		target.request = QNetworkRequest();
+		target.orderBookRequest = QNetworkRequest();
+	}
+}
+
+void StockAPI::stampIdentity(StockData& data, const QString& symbol)
+{
+	QuoteTarget& target = quoteTarget(symbol);
+
+	const quint64 revision = StockCodeMap::revision();
+	if (target.nameRevision != revision)
+	{
+		target.name = StockCodeMap::getName(symbol);
+		target.nameRevision = revision;
+	}
+
+	data.symbol = target.symbol;
+	data.name = target.name;
+}
+
+QByteArrayView StockAPI::readReply(QNetworkReply* reply)
+{
+	// resize는 용량을 줄이지 않으므로 응답 크기가 비슷하면 할당 없이 덮어씀
+	const qint64 available = reply->bytesAvailable();
+	if (available <= 0) return QByteArrayView();
+	m_replyBuffer.resize(available);
+
+	const qint64 read = reply->read(m_replyBuffer.data(), available);
+	return QByteArrayView(m_replyBuffer.constData(), qMax<qint64>(read, 0));
+}
+
 void StockAPI::onGenericLogoDownloaded()
 {
 	QNetworkReply* reply = qobject_cast<QNetworkReply*>(sender());
@@ -42,10 +91,75 @@ void StockAPI::onGenericLogoDownloaded()
 
 	// 데이터 -> 이미지 변환
 	QByteArray data = reply->readAll();
-	QPixmap logo;
+	QImage logo;
 	if (logo.loadFromData(data))
 	{
 		QString symbol = reply->property("TargetSymbol").toString();
 		emit logoReceived(symbol, logo);
 	}
+}
+
+void StockAPI::fetchCandles(const QString& symbol, CandleResolution resolution, const QDateTime& from, const QDateTime& to)
+{
+	const qint64 fromMs = from.toMSecsSinceEpoch();
+	const qint64 toMs = to.toMSecsSinceEpoch();
+	if (symbol.isEmpty() || toMs < fromMs) return;
+
+	QVector<CandleCache::Range> missing = m_candleCache.missingRanges(symbol, resolution, fromMs, toMs);
+
+	// 전부 캐시에 있으면 네트워크 없이 바로 응답
+	if (missing.isEmpty())
+	{
+		emit candlesReceived(symbol, resolution, m_candleCache.read(symbol, resolution, fromMs, toMs));
+		return;
+	}
+
+	// 서버 한도에 맞게 구간 쪼개기
+	const qint64 span = maxCandleSpan(resolution);
+	QVector<CandleCache::Range> chunks;
+	for (const CandleCache::Range& range : missing)
+	{
+		if (span <= 0)
+		{
+			chunks.append(range);
+			continue;
+		}
+		for (qint64 begin = range.first; begin <= range.second; begin += span)
+			chunks.append({ begin, qMin(begin + span - 1, range.second) });
+	}
+
+	const int requestId = m_nextCandleRequestId++;
+	m_candleRequests.insert(requestId, { symbol, resolution, fromMs, toMs, static_cast<int>(chunks.size()) });
+
+	for (const CandleCache::Range& chunk : chunks)
+		requestCandles(requestId, symbol, resolution, chunk.first, chunk.second);
+}
+
+void StockAPI::requestCandles(int requestId, const QString& symbol, CandleResolution, qint64 from, qint64 to)
+{
+	qDebug() << "봉 데이터를 지원하지 않는 API:" << symbol;
+	finishCandleRequest(requestId, from, to, {}, false);
+}
+
+qint64 StockAPI::maxCandleSpan(CandleResolution) const
+{
+	return 0;
+}
+
+void StockAPI::finishCandleRequest(int requestId, qint64 from, qint64 to, const QVector<Candle>& candles, bool ok)
+{
+	auto it = m_candleRequests.find(requestId);
+	if (it == m_candleRequests.end()) return;
+
+	// 성공한 구간만 캐시에 기록 (실패한 구간은 다음 요청 때 다시 받음)
+	if (ok)
+		m_candleCache.merge(it->symbol, it->resolution, from, to, candles);
+
+	if (--it->pending > 0) return;
+
+	CandleRequest request = it.value();
+	m_candleRequests.erase(it);
+
+	emit candlesReceived(request.symbol, request.resolution,
+		m_candleCache.read(request.symbol, request.resolution, request.from, request.to));
 }
\ No newline at end of file
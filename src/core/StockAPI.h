@@ -3,7 +3,14 @@
 #include <QObject>
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
+#include <QDateTime>
+#include <QHash>
+#include <QVector>
+#include <QImage>
+#include <QByteArrayView>
 #include "StockData.h"
+#include "Candle.h"
+#include "CandleCache.h"
 
 class StockAPI : public QObject
 {
@@ -17,15 +24,60 @@ public:
 	virtual void fetchStock(const QString& symbol) = 0;
 	virtual void fetchLogo(const QString& symbol) = 0;
 
+	// 과거 봉 데이터 요청 (캐시에 없는 구간만 서버에 요청)
+	void fetchCandles(const QString& symbol, CandleResolution resolution, const QDateTime& from, const QDateTime& to);
+
 signals:
 	// 데이터를 다 받으면
 	void dataReceived(const StockData& data);
-	void logoReceived(const QString& symbol, const QPixmap& logo);
+	// QPixmap은 GUI 스레드 전용이라 QImage로 넘김 (GUI에서 QPixmap::fromImage)
+	void logoReceived(const QString& symbol, const QImage& logo);
+	void candlesReceived(const QString& symbol, CandleResolution resolution, const QVector<Candle>& candles);
 
 protected:
 	QNetworkAccessManager* manager;	// 통신을 담당하는 qt 객체
 	void downloadLogoFromUrl(const QString& symbol, const QString& url);
 
+	// 종목별로 처음 한 번만 만들고 매 틱 재사용
+	// 심볼/이름 문자열을 공유하므로 시세마다 QString을 새로 만들지 않음
+	struct QuoteTarget
+	{
+		QString symbol;
+		QString name;
+		QNetworkRequest request;		// 비어있으면 하위 클래스가 처음 요청할 때 채움
+		QNetworkRequest orderBookRequest;	// 호가 조회 (호가가 있는 제공자만, 채우는 방식은 request와 같음)
+		quint64 nameRevision = ~quint64(0);	// 이름을 찾았을 때의 StockCodeMap::revision()
+	};
+	QuoteTarget& quoteTarget(const QString& symbol);
+	// 헤더(토큰 등)가 바뀌면 만들어둔 요청을 버림
+	void resetQuoteRequests();
+	// 파싱한 시세에 공유 심볼/이름을 붙임 (이름은 종목 사전이 바뀌었을 때만 다시 찾음)
+	void stampIdentity(StockData& data, const QString& symbol);
+	// 응답 본문을 재사용 버퍼로 읽음. 다음 readReply 전까지만 유효
+	QByteArrayView readReply(QNetworkReply* reply);
+
+	// 빠진 구간 하나를 실제로 요청. 응답이 오면 finishCandleRequest() 호출
+	virtual void requestCandles(int requestId, const QString& symbol, CandleResolution resolution, qint64 from, qint64 to);
+	// 한 번에 요청할 수 있는 최대 구간 (0 = 제한 없음)
+	virtual qint64 maxCandleSpan(CandleResolution resolution) const;
+	void finishCandleRequest(int requestId, qint64 from, qint64 to, const QVector<Candle>& candles, bool ok);
+
 private slots:
 	void onGenericLogoDownloaded();
+
+private:
+	struct CandleRequest
+	{
+		QString symbol;
+		CandleResolution resolution;
+		qint64 from;
+		qint64 to;
+		int pending;	// 아직 응답이 안 온 구간 수
+	};
+
+	CandleCache m_candleCache;
+	QHash<QString, QuoteTarget> m_quoteTargets;
+	QByteArray m_replyBuffer;	// 한 번 커지면 줄이지 않음
+	QHash<int, CandleRequest> m_candleRequests;
+	int m_nextCandleRequestId = 1;
 };
\ No newline at end of file
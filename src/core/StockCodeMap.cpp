@@ -3,8 +3,12 @@
 #include <QDebug>
 #include <QStringDecoder>
 #include <QDir>
+#include <algorithm>
 
-QHash<QString, QString> StockCodeMap::m_map;
+SymbolTable StockCodeMap::m_table;
+SymbolSearchIndex StockCodeMap::m_index;
+QReadWriteLock StockCodeMap::m_lock;
+std::atomic<quint64> StockCodeMap::m_revision{ 0 };
 
 void StockCodeMap::loadFromMstFiles()
 {
@@ -15,7 +19,7 @@ void StockCodeMap::loadFromMstFiles()
     parseMstFile("kospi_code.mst");
     parseMstFile("kosdaq_code.mst");
 
-    qDebug() << "로딩 완료! 총" << m_map.size() << "개 종목 등록됨.";
+    qDebug() << "로딩 완료! 총" << size() << "개 종목 등록됨.";
 }
 
 void StockCodeMap::parseMstFile(const QString& filePath)
@@ -32,6 +36,7 @@ void StockCodeMap::parseMstFile(const QString& filePath)
     auto toUtf16 = QStringDecoder(QStringDecoder::System);
 
     // 한 줄씩 읽기
+    QWriteLocker locker(&m_lock);
     while (!file.atEnd()) {
         QByteArray line = file.readLine();
 
@@ -56,97 +61,104 @@ void StockCodeMap::parseMstFile(const QString& filePath)
             code = code.mid(1); // 맨 앞 글자 자르기
         }
 
-        // 맵에 저장 (비어있지 않은 것만)
-        if (!code.isEmpty() && !name.isEmpty())
-        {
-            m_map.insert(code, name);
-        }
+        // 사전에 저장 (비어있지 않은 것만)
+        m_index.set(m_table.insert(code, name), name);
     }
 
     file.close();
+    ++m_revision;
     qDebug() << filePath << "파싱 완료";
 }
 
 QString StockCodeMap::getName(const QString& code)
 {
-    return m_map.value(code, code);
+    QReadLocker locker(&m_lock);
+    const SymbolTable::Id id = m_table.find(code.toUtf8());
+    return id != SymbolTable::InvalidId ? m_table.nameString(id) : code;
 }
 
 QString StockCodeMap::getCodeByName(const QString& name)
 {
-    return m_map.key(name, "없음");
+    QReadLocker locker(&m_lock);
+    const SymbolTable::Id id = m_table.findByName(name.toUtf8());
+    return id != SymbolTable::InvalidId ? m_table.codeString(id) : QString("없음");
 }
 
 QStringList StockCodeMap::getAllSearchKeywords()
 {
+    QReadLocker locker(&m_lock);
     QStringList list;
-    list.reserve(m_map.size() * 2);
+    list.reserve(m_table.size() * 2);
 
-    QHashIterator<QString, QString> i(m_map);
-    while (i.hasNext())
+    m_table.forEach([&list](SymbolTable::Id id)
     {
-        i.next();
-        list << i.value();
-        list << i.key();
-    }
+        list << m_table.nameString(id);
+        list << m_table.codeString(id);
+    });
 
     list.sort();
 
     return list;
 }
 
-QStringList StockCodeMap::searchKeywords(const QString& keyword, int limit)
+QStringList StockCodeMap::searchKeywords(const QString& keyword, int limit, bool fuzzy)
 {
     QStringList list;
     if (keyword.isEmpty()) return list;
 
-    QString lowerKey = keyword.toLower();
-    QHashIterator<QString, QString> i(m_map);
-    QStringList highPriority; // 일치
-    QStringList midPriority; // 코드, 이름검색
-    QStringList lowPriority; // 그냥 포함
+    // 오타 허용은 검색어 길이에 따라 (짧은 검색어는 정확히 포함하는 것만)
+    const int maxDistance = fuzzy ? SymbolSearchIndex::defaultMaxDistance(keyword.size()) : 0;
 
-    while (i.hasNext())
-    {
-        i.next();
+    QReadLocker locker(&m_lock);
+    const QVector<SymbolSearchIndex::Match> matches = m_index.search(m_table, keyword, limit, maxDistance);
+    list.reserve(matches.size());
 
-        QString code = i.key();
-        QString name = i.value();
-
-        QString lowerCode = code.toLower();
-        QString lowerName = name.toLower();
-
-        QString display = QString("%1 (%2)").arg(name, code);
+    // 같은 (거리, 순위) 묶음 안에서만 가나다순 정렬
+    qsizetype groupStart = 0;
+    for (qsizetype i = 0; i < matches.size(); ++i)
+    {
+        const SymbolTable::Id id = matches[i].id;
+        list.append(QString("%1 (%2)").arg(m_table.nameString(id), m_table.codeString(id)));
 
-        if ((lowerCode == lowerKey || lowerName ==lowerKey) && highPriority.size() < limit)
+        const bool groupEnd = i + 1 == matches.size()
+            || matches[i + 1].distance != matches[i].distance
+            || matches[i + 1].rank != matches[i].rank;
+        if (groupEnd)
         {
-            highPriority.append(display);
-        }
-        else if ((lowerCode.startsWith(lowerKey) || lowerName.startsWith(lowerKey))
-            && midPriority.size() < limit)
-        {
-            midPriority.append(display);
-        }
-        else if (lowerCode.contains(lowerKey) || lowerName.contains(lowerKey))
-        {
-            if(highPriority.size() + midPriority.size() + lowPriority.size() < limit)
-                lowPriority.append(display);
+            std::sort(list.begin() + groupStart, list.end());
+            groupStart = i + 1;
         }
     }
 
-    highPriority.sort();
-    midPriority.sort();
-    lowPriority.sort();
-
-    list = highPriority + midPriority + lowPriority;
-
     return list;
 }
 
 void StockCodeMap::addStock(const QString& code, const QString& name)
 {
-    if (!code.isEmpty() && !name.isEmpty())
-    {
-        m_map.insert(code, name);
-    }
-}
\ No newline at end of file
+    QWriteLocker locker(&m_lock);
+    m_index.set(m_table.insert(code, name), name);
+    ++m_revision;
+}
+
+void StockCodeMap::removeStock(const QString& code)
+{
+    QWriteLocker locker(&m_lock);
+    const QByteArray codeUtf8 = code.toUtf8();
+    m_index.remove(m_table.find(codeUtf8));
+    m_table.remove(codeUtf8);
+    ++m_revision;
+}
+
+int StockCodeMap::size()
+{
+    QReadLocker locker(&m_lock);
+    return m_table.size();
+}
+
+void StockCodeMap::clear()
+{
+    QWriteLocker locker(&m_lock);
+    m_table.clear();
+    m_index.clear();
+    ++m_revision;
+}
@@ -1,7 +1,12 @@
 #pragma once
 #include <QString>
-#include <QHash>
+#include <QStringList>
+#include <QReadWriteLock>
+#include <atomic>
+#include "SymbolTable.h"
+#include "SymbolSearchIndex.h"
 
+// 종목코드 <-> 종목명. I/O 스레드(미국 심볼 목록)와 GUI 스레드(검색)가 같이 쓰므로 읽기/쓰기 잠금
 class StockCodeMap
 {
 public:
@@ -11,12 +16,20 @@ public:
     static QString getName(const QString& code);
     static QString getCodeByName(const QString& name);
     static QStringList getAllSearchKeywords();
-    static QStringList searchKeywords(const QString& keyword, int limit = 25);
+    static QStringList searchKeywords(const QString& keyword, int limit = 25, bool fuzzy = true);
     static void addStock(const QString& code, const QString& name);
+    static void removeStock(const QString& code);
+    static int size();
+    // 사전이 바뀔 때마다 증가 (이름을 캐시해둔 쪽이 다시 찾아야 하는지 판단용)
+    static quint64 revision() { return m_revision.load(std::memory_order_acquire); }
+    static void clear();
 
-private:
-    static QHash<QString, QString> m_map;
-
-    // 내부에서만 쓰는 진짜 파싱 함수
+    // MST 파일 하나 파싱 (벤치마크에서도 직접 호출)
     static void parseMstFile(const QString& filePath);
+
+private:
+    static SymbolTable m_table;     // 코드/이름 UTF-8 arena + 정수 id (검색도 여기서 바로)
+    static SymbolSearchIndex m_index;   // 한글 이름의 초성 키만 (id는 m_table과 같음)
+    static QReadWriteLock m_lock;
+    static std::atomic<quint64> m_revision;
 };
\ No newline at end of file
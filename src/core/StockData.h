@@ -1,20 +1,22 @@
 #pragma once
 #include <QString>
-#include <QPixmap>
 
+// 시세 한 건. 틱마다 복사되므로 값과 공유 문자열만 둠 (로고 같은 화면 자원은 모델이 종목별로 가짐)
 struct StockData
 {
 	QString symbol;	// 티커 
 	QString name;	// 종목명
-	QPixmap logo;
 
-	double currentPrice; // 현재가
-	double previousPrice; // 직전가
-	double openPrice;	// 시가
-	double highPrice;	// 고가
-	double lowPrice;	// 저가
-	double prevClose;	// 전일 종가
-	long long volume;	// 거래량
+	double currentPrice = 0.0; // 현재가
+	double previousPrice = 0.0; // 직전가
+	double openPrice = 0.0;	// 시가
+	double highPrice = 0.0;	// 고가
+	double lowPrice = 0.0;	// 저가
+	double prevClose = 0.0;	// 전일 종가
+	long long volume = 0;	// 거래량
+	qint64 timestamp = 0;	// 수신 시각 (epoch ms)
+	quint64 traceId = 0;	// 지연 추적 ID (LatencyTracer, 0 = 추적 안 함)
+	bool stale = false;		// 지난 실행의 스냅샷에서 복원한 값 (실시간 시세가 오면 덮임)
 
 	// 변동률 계산 함수
 	double getChangePercentage() const
@@ -22,4 +24,4 @@ struct StockData
 		if (prevClose == 0) return 0.0;
 		return ((currentPrice - prevClose) / prevClose) * 100.0;
 	}
-};
\ No newline at end of file
+};
@@ -0,0 +1,271 @@
+#include "SymbolSearchIndex.h"
+#include "FuzzyMatcher.h"
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+
+namespace
+{
+	constexpr int MaxDistance = 2;
+
+	std::u16string_view toView(const QString& text)
+	{
+		return std::u16string_view(reinterpret_cast<const char16_t*>(text.constData()), static_cast<size_t>(text.size()));
+	}
+
+	char16_t foldAscii(char16_t c)
+	{
+		return (c >= u'A' && c <= u'Z') ? static_cast<char16_t>(c + (u'a' - u'A')) : c;
+	}
+
+	// 음절 초성 순서대로 호환 자모 (키보드로 자음만 치면 나오는 글자)
+	constexpr char16_t Initials[19] = {
+		u'ㄱ', u'ㄲ', u'ㄴ', u'ㄷ', u'ㄸ', u'ㄹ', u'ㅁ', u'ㅂ', u'ㅃ', u'ㅅ',
+		u'ㅆ', u'ㅇ', u'ㅈ', u'ㅉ', u'ㅊ', u'ㅋ', u'ㅌ', u'ㅍ', u'ㅎ'
+	};
+	constexpr char16_t SyllableFirst = 0xAC00;	// 가
+	constexpr char16_t SyllableLast = 0xD7A3;	// 힣
+	constexpr int SyllablesPerInitial = 21 * 28;	// 중성 x 종성
+
+	// 한글 음절이면 초성, 아니면 그대로
+	char16_t initialOf(char16_t c)
+	{
+		if (c < SyllableFirst || c > SyllableLast) return c;
+		return Initials[(c - SyllableFirst) / SyllablesPerInitial];
+	}
+
+	bool isInitial(char16_t c)
+	{
+		return c >= u'ㄱ' && c <= u'ㅎ';
+	}
+
+	// UTF-8 -> UTF-16 (ASCII만 소문자로)
+	// out은 SymbolSearchIndex::MaxTextLength 글자, 넘는 뒷부분은 버림. 쓴 글자 수 반환
+	size_t decode(QByteArrayView utf8, char16_t* out)
+	{
+		const uchar* p = reinterpret_cast<const uchar*>(utf8.data());
+		const uchar* end = p + utf8.size();
+		size_t length = 0;
+		while (p < end && length < SymbolSearchIndex::MaxTextLength)
+		{
+			char32_t c = *p;
+			if (c < 0x80)
+			{
+				out[length++] = foldAscii(static_cast<char16_t>(c));
+				++p;
+				continue;
+			}
+
+			// 잘린 멀티바이트는 U+FFFD (arena는 QString에서 만든 UTF-8이라 실제로는 없음)
+			int extra = (c & 0xE0) == 0xC0 ? 1 : (c & 0xF0) == 0xE0 ? 2 : (c & 0xF8) == 0xF0 ? 3 : -1;
+			if (extra < 0 || end - p <= extra)
+			{
+				c = 0xFFFD;
+				extra = 0;
+			}
+			else
+			{
+				c &= 0x3F >> extra;
+				for (int i = 1; i <= extra; ++i)
+					c = (c << 6) | (p[i] & 0x3F);
+			}
+			p += extra + 1;
+
+			if (c >= 0x10000)
+			{
+				if (length + 2 > SymbolSearchIndex::MaxTextLength) break;
+				c -= 0x10000;
+				out[length++] = static_cast<char16_t>(0xD800 + (c >> 10));
+				c = 0xDC00 + (c & 0x3FF);
+			}
+			out[length++] = static_cast<char16_t>(c);
+		}
+		return length;
+	}
+
+	// 글자마다 이름이나 초성 키 한쪽만 맞으면 됨
+	bool matchesAt(std::u16string_view name, std::u16string_view initials, std::u16string_view key)
+	{
+		if (name.size() < key.size()) return false;
+		for (size_t i = 0; i < key.size(); ++i)
+		{
+			if (key[i] != name[i] && key[i] != initials[i]) return false;
+		}
+		return true;
+	}
+}
+
+void SymbolSearchIndex::set(SymbolTable::Id id, const QString& name)
+{
+	if (id < 0) return;
+
+	// 초성 키는 불러올 때 한 번만 만듦. 한글(음절/자모)이 없는 이름은 키가 없음
+	std::u16string initials;
+	bool hangul = false;
+	for (qsizetype i = 0; i < name.size() && i < MaxTextLength; ++i)
+	{
+		const char16_t c = name[i].unicode();
+		hangul = hangul || isInitial(c) || (c >= SyllableFirst && c <= SyllableLast);
+		initials.push_back(initialOf(foldAscii(c)));
+	}
+
+	auto it = std::lower_bound(m_keys.begin(), m_keys.end(), id, [](const Key& key, SymbolTable::Id value) { return key.id < value; });
+	const bool found = it != m_keys.end() && it->id == id;
+	if (found)
+		m_garbage += it->length;
+
+	if (!hangul)
+	{
+		if (found)
+		{
+			m_keys.erase(it);
+			compactIfNeeded();
+		}
+		return;
+	}
+
+	// id는 늘어나는 순서로 발급되므로 보통 맨 뒤에 붙음
+	const Key key{ id, static_cast<quint32>(m_text.size()), static_cast<quint16>(initials.size()) };
+	m_text.insert(m_text.end(), initials.begin(), initials.end());
+	if (found)
+		*it = key;
+	else
+		m_keys.insert(it, key);
+	compactIfNeeded();
+}
+
+void SymbolSearchIndex::remove(SymbolTable::Id id)
+{
+	auto it = std::lower_bound(m_keys.begin(), m_keys.end(), id, [](const Key& key, SymbolTable::Id value) { return key.id < value; });
+	if (it == m_keys.end() || it->id != id) return;
+
+	m_garbage += it->length;
+	m_keys.erase(it);
+	compactIfNeeded();
+}
+
+void SymbolSearchIndex::clear()
+{
+	m_keys.clear();
+	m_text.clear();
+	m_garbage = 0;
+}
+
+qsizetype SymbolSearchIndex::memoryUsage() const
+{
+	return static_cast<qsizetype>(m_keys.capacity() * sizeof(Key) + m_text.capacity() * sizeof(char16_t));
+}
+
+void SymbolSearchIndex::compactIfNeeded()
+{
+	if (m_garbage * 2 <= static_cast<qsizetype>(m_text.size())) return;
+
+	std::vector<char16_t> text;
+	text.reserve(m_text.size() - static_cast<size_t>(m_garbage));
+	for (Key& key : m_keys)
+	{
+		const quint32 offset = static_cast<quint32>(text.size());
+		text.insert(text.end(), m_text.begin() + key.offset, m_text.begin() + key.offset + key.length);
+		key.offset = offset;
+	}
+	m_text = std::move(text);
+	m_garbage = 0;
+}
+
+QVector<SymbolSearchIndex::Match> SymbolSearchIndex::search(const SymbolTable& table, const QString& query, int limit, int maxDistance) const
+{
+	QVector<Match> result;
+	if (query.isEmpty() || limit <= 0) return result;
+
+	// 패턴 길이 제한을 넘는 검색어는 앞부분만 (이름이 그보다 긴 종목은 없음)
+	// 대소문자는 종목 쪽과 같게 ASCII만 맞춤
+	QString folded = query.left(FuzzyMatcher::MaxLength);
+	for (QChar& c : folded)
+		c = QChar(foldAscii(c.unicode()));
+	const std::u16string_view key = toView(folded);
+	const FuzzyMatcher matcher(folded);
+	maxDistance = qBound(0, maxDistance, MaxDistance);
+
+	// 초성이 섞인 검색어는 이미 줄여 친 것이라 오타까지 허용하면 너무 많이 걸림
+	const bool byInitials = std::any_of(key.begin(), key.end(), isInitial);
+	if (byInitials)
+		maxDistance = 0;
+
+	// (거리, 순위)별 묶음. 묶음마다 limit개면 충분
+	std::array<std::vector<SymbolTable::Id>, (MaxDistance + 1) * RankCount> buckets;
+	std::array<int, MaxDistance + 1> counts{};
+	int bound = maxDistance;	// 이 거리를 넘는 종목은 이미 limit개 뒤로 밀려서 볼 필요 없음
+
+	char16_t codeBuffer[MaxTextLength];
+	char16_t nameBuffer[MaxTextLength];
+
+	// 초성 검색어는 한글이 있는 이름(초성 키가 있는 종목)에만 맞을 수 있으니 그것만 훑음
+	const qsizetype count = byInitials ? static_cast<qsizetype>(m_keys.size()) : table.idCount();
+	for (qsizetype i = 0; i < count; ++i)
+	{
+		const SymbolTable::Id id = byInitials ? m_keys[i].id : static_cast<SymbolTable::Id>(i);
+		if (!table.isValid(id)) continue;
+
+		std::u16string_view name(nameBuffer, decode(table.name(id), nameBuffer));
+		std::u16string_view code;
+		if (!byInitials)
+			code = std::u16string_view(codeBuffer, decode(table.code(id), codeBuffer));
+
+		int distance = 0;
+		Rank rank = Contains;
+		if (byInitials)
+		{
+			// 코드에는 초성이 없으니 이름만. 키는 이름과 같은 길이 (잘린 경우만 짧은 쪽에 맞춤)
+			const std::u16string_view initials(m_text.data() + m_keys[i].offset, qMin<size_t>(m_keys[i].length, name.size()));
+			name = name.substr(0, initials.size());
+			if (matchesAt(name, initials, key))
+				rank = name.size() == key.size() ? Exact : Prefix;
+			else if (matcher.distance(name.data(), initials.data(), static_cast<qsizetype>(name.size()), 0) > 0)
+				continue;
+		}
+		else if (code == key || name == key)
+			rank = Exact;
+		else if (code.starts_with(key) || name.starts_with(key))
+			rank = Prefix;
+		else
+		{
+			distance = matcher.distance(code.data(), static_cast<qsizetype>(code.size()), bound);
+			if (distance > 0)
+				distance = qMin(distance, matcher.distance(name.data(), static_cast<qsizetype>(name.size()), bound));
+			if (distance > bound) continue;
+		}
+
+		std::vector<SymbolTable::Id>& bucket = buckets[distance * RankCount + rank];
+		if (static_cast<int>(bucket.size()) >= limit) continue;
+		bucket.push_back(id);
+		++counts[distance];
+
+		int better = 0;
+		for (int d = 0; d < bound; ++d)
+			better += counts[d];
+		while (bound > 0 && better >= limit)
+		{
+			--bound;
+			better -= counts[bound];
+		}
+	}
+
+	result.reserve(limit);
+	for (int i = 0; i < static_cast<int>(buckets.size()) && result.size() < limit; ++i)
+	{
+		for (SymbolTable::Id id : buckets[i])
+		{
+			if (result.size() >= limit) break;
+			result.append(Match{ id, i / RankCount, static_cast<Rank>(i % RankCount) });
+		}
+	}
+	return result;
+}
+
+int SymbolSearchIndex::defaultMaxDistance(qsizetype queryLength)
+{
+	if (queryLength <= 2) return 0;
+	if (queryLength <= 4) return 1;
+	return MaxDistance;
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <QString>
+#include <QVector>
+#include <vector>
+#include "SymbolTable.h"
+
+// 검색창용 검색 (결과 id는 SymbolTable id)
+// 코드/이름은 사본을 두지 않고 SymbolTable의 UTF-8 arena를 그대로 훑음
+// 종목마다 스택 버퍼에 UTF-16으로 풀면서 ASCII만 소문자로 맞춤 (할당 없음)
+// 한글 이름만 음절을 초성으로 바꾼 키(삼성전자 -> ㅅㅅㅈㅈ)를 넣을 때 한 번 만들어 id 순서로 저장해 두고
+// 검색어에 초성이 섞이면 키가 있는 종목만, 글자마다 이름/초성 키 어느 쪽이든 맞으면 같은 글자로 봄 ("ㅅㅅ전자", "삼ㅅㅈㅈ")
+// 스레드 안전하지 않음 (StockCodeMap이 잠금)
+class SymbolSearchIndex
+{
+public:
+	// 정렬 순서: 편집 거리가 먼저, 같은 거리 안에서는 일치 > 시작 > 포함
+	enum Rank
+	{
+		Exact = 0,
+		Prefix,
+		Contains,
+		RankCount
+	};
+
+	struct Match
+	{
+		SymbolTable::Id id;
+		int distance;
+		Rank rank;
+	};
+
+	// 코드/이름에서 앞부분 이만큼만 검색 (실제 종목명은 훨씬 짧음)
+	static constexpr int MaxTextLength = 256;
+
+	// 종목 추가 / 이름 변경 때 초성 키를 다시 만듦 (SymbolTable::insert 결과 id)
+	void set(SymbolTable::Id id, const QString& name);
+	void remove(SymbolTable::Id id);
+	void clear();
+
+	// maxDistance만큼 오타 허용 (0이면 기존 부분 문자열 검색과 같음)
+	// 결과는 (거리, 순위) 묶음 순서, 묶음 안에서는 id 순서
+	QVector<Match> search(const SymbolTable& table, const QString& query, int limit, int maxDistance) const;
+
+	// 검색어 길이별 허용 오타 수 (짧을수록 엉뚱한 결과가 많아서 줄임)
+	static int defaultMaxDistance(qsizetype queryLength);
+
+	qsizetype memoryUsage() const;
+
+private:
+	// 한글이 있는 이름 하나의 초성 키 (m_text 안, 이름 UTF-16과 같은 길이)
+	struct Key
+	{
+		SymbolTable::Id id;
+		quint32 offset;
+		quint16 length;
+	};
+
+	std::vector<Key> m_keys;		// id 순서
+	std::vector<char16_t> m_text;
+	qsizetype m_garbage = 0;		// 지우거나 이름을 바꿔 안 쓰는 글자 수
+
+	void compactIfNeeded();
+};
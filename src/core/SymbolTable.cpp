@@ -0,0 +1,193 @@
+#include "SymbolTable.h"
+#include <QHashFunctions>
+#include <bit>
+
+namespace
+{
+	constexpr int MinIndexSize = 64;
+
+	size_t hashOf(QByteArrayView key)
+	{
+		return qHash(key, 0);
+	}
+}
+
+SymbolTable::Id SymbolTable::insert(QByteArrayView code, QByteArrayView name)
+{
+	if (code.isEmpty() || name.isEmpty() || code.size() > 0xFF) return InvalidId;
+	if (name.size() > 0xFFFF)
+		name = name.first(0xFFFF);
+
+	// 새 항목이든 이름 변경이든 색인에 한 칸 더 씀
+	if ((m_live + m_tombstones + 1) * 2 > static_cast<int>(m_codeIndex.size()))
+		rehash(m_live + 1);
+
+	const Id existing = find(code);
+	if (existing != InvalidId)
+	{
+		// 이름 변경: 새 이름을 뒤에 붙이고 이전 이름 바이트는 버림
+		Entry& entry = m_entries[existing];
+		if (this->name(existing) == name) return existing;
+
+		unlink(m_nameIndex, existing, this->name(existing));
+		m_garbage += entry.nameLength;
+		entry.name = append(name);
+		entry.nameLength = static_cast<quint16>(name.size());
+		link(m_nameIndex, existing, name);
+		return existing;
+	}
+
+	const Id id = idCount();
+	Entry entry;
+	entry.code = append(code);
+	entry.codeLength = static_cast<quint8>(code.size());
+	entry.name = append(name);
+	entry.nameLength = static_cast<quint16>(name.size());
+	entry.removed = false;
+	m_entries.push_back(entry);
+
+	link(m_codeIndex, id, code);
+	link(m_nameIndex, id, name);
+	++m_live;
+	return id;
+}
+
+bool SymbolTable::remove(QByteArrayView code)
+{
+	const Id id = find(code);
+	if (id == InvalidId) return false;
+
+	// id는 남겨두고 (밖에서 들고 있을 수 있음) 색인에서만 뺌
+	unlink(m_codeIndex, id, code);
+	unlink(m_nameIndex, id, name(id));
+	Entry& entry = m_entries[id];
+	entry.removed = true;
+	m_garbage += entry.codeLength + entry.nameLength;
+	--m_live;
+
+	// 버린 바이트가 절반을 넘으면 arena를 다시 채움
+	if (m_garbage * 2 > m_arena.size())
+		compact();
+	return true;
+}
+
+void SymbolTable::clear()
+{
+	m_arena.clear();
+	m_entries.clear();
+	m_codeIndex.clear();
+	m_nameIndex.clear();
+	m_live = 0;
+	m_tombstones = 0;
+	m_garbage = 0;
+}
+
+void SymbolTable::reserve(int count, qsizetype arenaBytes)
+{
+	m_arena.reserve(arenaBytes);
+	m_entries.reserve(static_cast<size_t>(count));
+	if (count * 2 > static_cast<int>(m_codeIndex.size()))
+		rehash(count);
+}
+
+SymbolTable::Id SymbolTable::find(QByteArrayView code) const
+{
+	return lookup(m_codeIndex, code, false);
+}
+
+SymbolTable::Id SymbolTable::findByName(QByteArrayView name) const
+{
+	return lookup(m_nameIndex, name, true);
+}
+
+qsizetype SymbolTable::memoryUsage() const
+{
+	return m_arena.capacity()
+		+ static_cast<qsizetype>(m_entries.capacity() * sizeof(Entry))
+		+ static_cast<qsizetype>((m_codeIndex.capacity() + m_nameIndex.capacity()) * sizeof(Id));
+}
+
+quint32 SymbolTable::append(QByteArrayView bytes)
+{
+	const quint32 offset = static_cast<quint32>(m_arena.size());
+	m_arena.append(bytes);
+	return offset;
+}
+
+SymbolTable::Id SymbolTable::lookup(const std::vector<Id>& index, QByteArrayView key, bool byName) const
+{
+	if (index.empty()) return InvalidId;
+
+	const size_t mask = index.size() - 1;
+	for (size_t i = hashOf(key) & mask;; i = (i + 1) & mask)
+	{
+		const Id id = index[i];
+		if (id == Empty) return InvalidId;
+		if (id == Tombstone) continue;
+		if ((byName ? name(id) : code(id)) == key) return id;
+	}
+}
+
+void SymbolTable::link(std::vector<Id>& index, Id id, QByteArrayView key)
+{
+	const size_t mask = index.size() - 1;
+	size_t i = hashOf(key) & mask;
+	while (index[i] >= 0)
+		i = (i + 1) & mask;
+	if (index[i] == Tombstone)
+		--m_tombstones;
+	index[i] = id;
+}
+
+void SymbolTable::unlink(std::vector<Id>& index, Id id, QByteArrayView key)
+{
+	const size_t mask = index.size() - 1;
+	for (size_t i = hashOf(key) & mask; index[i] != Empty; i = (i + 1) & mask)
+	{
+		if (index[i] == id)
+		{
+			index[i] = Tombstone;
+			++m_tombstones;
+			return;
+		}
+	}
+}
+
+void SymbolTable::rehash(int minimumCount)
+{
+	const size_t size = std::bit_ceil(static_cast<size_t>(qMax(MinIndexSize, minimumCount * 2)));
+	m_codeIndex.assign(size, Empty);
+	m_nameIndex.assign(size, Empty);
+	m_tombstones = 0;
+
+	for (Id id = 0; id < idCount(); ++id)
+	{
+		if (m_entries[id].removed) continue;
+		link(m_codeIndex, id, code(id));
+		link(m_nameIndex, id, name(id));
+	}
+}
+
+void SymbolTable::compact()
+{
+	QByteArray arena;
+	arena.reserve(m_arena.size() - m_garbage);
+	for (Entry& entry : m_entries)
+	{
+		if (entry.removed)
+		{
+			entry.code = entry.name = 0;
+			entry.codeLength = 0;
+			entry.nameLength = 0;
+			continue;
+		}
+		const quint32 code = static_cast<quint32>(arena.size());
+		arena.append(m_arena.constData() + entry.code, entry.codeLength);
+		const quint32 name = static_cast<quint32>(arena.size());
+		arena.append(m_arena.constData() + entry.name, entry.nameLength);
+		entry.code = code;
+		entry.name = name;
+	}
+	m_arena = std::move(arena);
+	m_garbage = 0;
+}
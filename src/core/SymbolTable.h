@@ -0,0 +1,91 @@
+#pragma once
+#include <QByteArray>
+#include <QByteArrayView>
+#include <QString>
+#include <vector>
+
+// 종목 사전 저장소 (KR + US 약 35k)
+// 코드/이름을 UTF-8로 arena 하나에 이어 붙이고, 종목마다 정수 id와 12바이트 항목만 둠
+// 코드 -> id, 이름 -> id는 각각 id 배열 하나짜리 열린 주소법 해시 (키 비교는 arena에서)
+// QHash<QString, QString>처럼 종목마다 UTF-16 문자열 두 개 + 해시 노드를 할당하지 않음
+//
+// id는 지워도 재사용하지 않으므로 밖에서 들고 있어도 됨 (isValid로 확인)
+// 스레드 안전하지 않음 (StockCodeMap이 잠금)
+class SymbolTable
+{
+public:
+	using Id = qint32;
+	static constexpr Id InvalidId = -1;
+
+	// 코드가 이미 있으면 이름만 바꿈. 빈 코드/이름은 무시하고 InvalidId
+	Id insert(QByteArrayView code, QByteArrayView name);
+	Id insert(const QString& code, const QString& name)
+	{
+		const QByteArray codeUtf8 = code.toUtf8();
+		const QByteArray nameUtf8 = name.toUtf8();
+		return insert(QByteArrayView(codeUtf8), QByteArrayView(nameUtf8));
+	}
+	bool remove(QByteArrayView code);
+	void clear();
+	void reserve(int count, qsizetype arenaBytes);
+
+	Id find(QByteArrayView code) const;
+	Id findByName(QByteArrayView name) const;
+
+	// 살아있는 종목 수 / 발급한 id 수 (지운 것 포함, 순회 범위)
+	int size() const { return m_live; }
+	int idCount() const { return static_cast<int>(m_entries.size()); }
+	bool isValid(Id id) const { return id >= 0 && id < idCount() && !m_entries[id].removed; }
+
+	QByteArrayView code(Id id) const { return view(m_entries[id].code, m_entries[id].codeLength); }
+	QByteArrayView name(Id id) const { return view(m_entries[id].name, m_entries[id].nameLength); }
+	QString codeString(Id id) const { return QString::fromUtf8(code(id)); }
+	QString nameString(Id id) const { return QString::fromUtf8(name(id)); }
+
+	// 살아있는 종목만 id 순서대로
+	template <typename Fn>
+	void forEach(Fn&& fn) const
+	{
+		for (Id id = 0; id < idCount(); ++id)
+		{
+			if (!m_entries[id].removed)
+				fn(id);
+		}
+	}
+
+	qsizetype memoryUsage() const;
+
+private:
+	struct Entry
+	{
+		quint32 code;			// arena 오프셋
+		quint32 name;
+		quint16 nameLength;
+		quint8 codeLength;
+		bool removed;
+	};
+	static_assert(sizeof(Entry) == 12, "Entry should stay 12 bytes");
+
+	static constexpr Id Empty = -1;
+	static constexpr Id Tombstone = -2;
+
+	QByteArray m_arena;
+	std::vector<Entry> m_entries;
+	std::vector<Id> m_codeIndex;	// 크기 2의 거듭제곱, 적재율 0.5 이하
+	std::vector<Id> m_nameIndex;
+	int m_live = 0;
+	int m_tombstones = 0;			// 두 색인의 묘비 수 합 (재해싱 판단은 넉넉하게)
+	qsizetype m_garbage = 0;		// 지우거나 이름을 바꿔 안 쓰는 arena 바이트
+
+	QByteArrayView view(quint32 offset, int length) const
+	{
+		return QByteArrayView(m_arena.constData() + offset, length);
+	}
+
+	quint32 append(QByteArrayView bytes);
+	Id lookup(const std::vector<Id>& index, QByteArrayView key, bool byName) const;
+	void link(std::vector<Id>& index, Id id, QByteArrayView key);
+	void unlink(std::vector<Id>& index, Id id, QByteArrayView key);
+	void rehash(int minimumCount);
+	void compact();
+};
@@ -0,0 +1,23 @@
+#include "TickHistory.h"
+
+void TickHistory::append(const Tick& tick)
+{
+	m_ticks[m_head] = tick;
+	m_head = (m_head + 1) % Capacity;
+	if (m_count < Capacity) ++m_count;
+	++m_revision;
+}
+
+void TickHistory::clear()
+{
+	m_head = 0;
+	m_count = 0;
+	++m_revision;
+}
+
+const Tick& TickHistory::at(int i) const
+{
+	// 가득 차 있으면 m_head 위치가 가장 오래된 틱
+	int start = (m_count == Capacity) ? m_head : 0;
+	return m_ticks[(start + i) % Capacity];
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <QtGlobal>
+#include <array>
+
+// 시세 한 건 (시각, 가격, 누적 거래량)
+struct Tick
+{
+	qint64 timestamp = 0;	// epoch ms
+	double price = 0.0;
+	long long volume = 0;
+};
+
+// 종목별 최근 틱 기록 (고정 크기 링버퍼)
+// 배열을 미리 잡아두고 덮어쓰기만 하므로 앱을 오래 켜둬도 메모리가 늘지 않음
+class TickHistory
+{
+public:
+	static constexpr int Capacity = 240;
+
+	void append(const Tick& tick);
+	void clear();
+
+	int size() const { return m_count; }
+	bool isEmpty() const { return m_count == 0; }
+
+	// 0 = 가장 오래된 틱, size() - 1 = 가장 최근 틱
+	const Tick& at(int i) const;
+	const Tick& last() const { return at(m_count - 1); }
+
+	// 틱이 추가될 때마다 증가 (캐시 무효화 판단용)
+	quint64 revision() const { return m_revision; }
+
+private:
+	std::array<Tick, Capacity> m_ticks{};
+	int m_head = 0;		// 다음에 쓸 위치
+	int m_count = 0;
+	quint64 m_revision = 0;
+};
@@ -0,0 +1,287 @@
+#include "TickJournal.h"
+#include "TickJournalFormat.h"
+#include <QDir>
+#include <QDateTime>
+#include <QDebug>
+#include <cstring>
+
+using namespace TickJournalFormat;
+
+namespace
+{
+	constexpr quint64 InitialSegmentSize = 1 << 20;	// 1 MiB 부터 두 배씩
+}
+
+TickJournal::TickJournal(const QString& dir) : m_dir(dir)
+{
+}
+
+TickJournal::~TickJournal()
+{
+	stop();
+}
+
+bool TickJournal::start()
+{
+	if (m_thread) return true;
+
+	if (!QDir().mkpath(m_dir))
+	{
+		qDebug() << "[TickJournal] 디렉터리 생성 실패:" << m_dir;
+		return false;
+	}
+
+	m_stopping.store(false);
+	m_idle.store(false);
+	m_wake.acquire(m_wake.available());
+	m_thread = QThread::create([this]() { run(); });
+	m_thread->setObjectName("TickJournal");
+	m_thread->start(QThread::LowPriority);
+
+	qDebug() << "[TickJournal] 기록 시작:" << m_dir;
+	return true;
+}
+
+void TickJournal::stop()
+{
+	if (!m_thread) return;
+
+	m_stopping.store(true, std::memory_order_release);
+	m_wake.release();
+	m_thread->wait();
+	delete m_thread;
+	m_thread = nullptr;
+
+	qDebug() << "[TickJournal] 기록 종료. 저장:" << writtenCount() << "버림:" << droppedCount();
+}
+
+bool TickJournal::record(const StockData& data)
+{
+	if (!m_thread) return false;
+
+	Entry entry;
+	entry.symbol = data.symbol;
+	entry.timestamp = data.timestamp;
+	entry.price = data.currentPrice;
+	entry.open = data.openPrice;
+	entry.high = data.highPrice;
+	entry.low = data.lowPrice;
+	entry.prevClose = data.prevClose;
+	entry.volume = data.volume;
+
+	if (!m_queue.tryPush(entry))
+	{
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	wake();
+	return true;
+}
+
+void TickJournal::wake()
+{
+	// 넣은 뒤에 m_idle을 읽어야 기록 스레드가 빈 큐를 보고 잠드는 것과 엇갈리지 않음 (run()과 짝)
+	// 깨어 있는 동안에는 원자 변수 하나만 읽으므로 틱마다 락을 잡지 않음
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (m_idle.load(std::memory_order_relaxed) && m_idle.exchange(false, std::memory_order_acq_rel))
+		m_wake.release();
+}
+
+void TickJournal::run()
+{
+	Entry entry;
+	while (true)
+	{
+		// stop 플래그를 먼저 읽어야 그 전에 들어온 항목을 전부 비우고 끝낼 수 있음
+		const bool stopping = m_stopping.load(std::memory_order_acquire);
+
+		bool wrote = false;
+		while (m_queue.tryPop(entry))
+		{
+			write(entry);
+			wrote = true;
+		}
+		if (wrote) commit();
+
+		if (stopping) break;
+		if (wrote) continue;
+
+		// 잠들기 전에 큐를 한 번 더 봐서, 그 사이 들어온 항목을 놓치지 않음
+		m_idle.store(true, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (m_queue.isEmpty() && !m_stopping.load(std::memory_order_acquire))
+			m_wake.acquire();
+		else if (!m_idle.exchange(false, std::memory_order_acq_rel))
+			m_wake.acquire();	// record()가 이미 깨웠으면 그 신호를 소비
+	}
+
+	closeSegment();
+}
+
+void TickJournal::write(const Entry& entry)
+{
+	// 날짜가 바뀌면 새 세그먼트
+	if (!m_map || entry.timestamp < m_dayStart || entry.timestamp >= m_dayEnd)
+	{
+		closeSegment();
+		if (!openSegment(entry.timestamp)) return;
+	}
+
+	// 심볼 사전
+	quint32 id;
+	auto it = m_symbolIds.constFind(entry.symbol);
+	if (it == m_symbolIds.cend())
+	{
+		id = static_cast<quint32>(m_states.size());
+		m_symbolIds.insert(entry.symbol, id);
+		m_states.emplace_back();
+
+		const QByteArray utf8 = entry.symbol.toUtf8();
+		if (!ensureCapacity(1 + 5 + 5 + utf8.size())) return;
+
+		uchar* p = m_map + m_offset;
+		*p++ = TagSymbolDef;
+		p += writeVarint(p, id);
+		p += writeVarint(p, static_cast<quint64>(utf8.size()));
+		std::memcpy(p, utf8.constData(), utf8.size());
+		p += utf8.size();
+		m_offset = static_cast<quint64>(p - m_map);
+	}
+	else
+	{
+		id = it.value();
+	}
+
+	if (!ensureCapacity(MaxTickRecordSize)) return;
+
+	// 시장 시각이 역전되어 들어와도 기록 순서를 유지하도록 Δ시각은 부호 있는 값
+	const qint64 base = (m_recordCount == 0) ? m_dayStart : m_lastTime;
+	SymbolState& state = m_states[id];
+	const SymbolState next = {
+		toFixed(entry.price), toFixed(entry.open), toFixed(entry.high),
+		toFixed(entry.low), toFixed(entry.prevClose), entry.volume
+	};
+
+	uchar* p = m_map + m_offset;
+	*p++ = TagTick;
+	p += writeVarint(p, id);
+	p += writeVarint(p, zigzag(entry.timestamp - base));
+	p += writeVarint(p, zigzag(next.price - state.price));
+	p += writeVarint(p, zigzag(next.open - state.open));
+	p += writeVarint(p, zigzag(next.high - state.high));
+	p += writeVarint(p, zigzag(next.low - state.low));
+	p += writeVarint(p, zigzag(next.prevClose - state.prevClose));
+	p += writeVarint(p, zigzag(next.volume - state.volume));
+	m_offset = static_cast<quint64>(p - m_map);
+
+	state = next;
+	m_minTime = (m_recordCount == 0) ? entry.timestamp : qMin(m_minTime, entry.timestamp);
+	m_maxTime = (m_recordCount == 0) ? entry.timestamp : qMax(m_maxTime, entry.timestamp);
+	m_lastTime = entry.timestamp;
+	++m_recordCount;
+	m_written.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool TickJournal::openSegment(qint64 timestamp)
+{
+	const QDate day = QDateTime::fromMSecsSinceEpoch(timestamp).date();
+	m_dayStart = day.startOfDay().toMSecsSinceEpoch();
+	m_dayEnd = day.addDays(1).startOfDay().toMSecsSinceEpoch();
+
+	// 같은 날 이미 기록한 세그먼트가 있으면 다음 번호로
+	QString path;
+	for (int part = 1; ; ++part)
+	{
+		path = QString("%1/ticks-%2-%3.sfj").arg(m_dir, day.toString("yyyyMMdd")).arg(part, 3, 10, QChar('0'));
+		if (!QFile::exists(path)) break;
+	}
+
+	m_file.setFileName(path);
+	if (!m_file.open(QIODevice::ReadWrite) || !m_file.resize(InitialSegmentSize))
+	{
+		qDebug() << "[TickJournal] 세그먼트 생성 실패:" << path << m_file.errorString();
+		m_file.close();
+		return false;
+	}
+
+	m_capacity = InitialSegmentSize;
+	m_map = m_file.map(0, m_capacity);
+	if (!m_map)
+	{
+		qDebug() << "[TickJournal] mmap 실패:" << path;
+		m_file.close();
+		return false;
+	}
+
+	m_offset = sizeof(SegmentHeader);
+	m_recordCount = 0;
+	m_lastTime = 0;
+	m_minTime = 0;
+	m_maxTime = 0;
+	m_symbolIds.clear();
+	m_states.clear();
+
+	SegmentHeader header = {};
+	std::memcpy(header.magic, Magic, sizeof(Magic));
+	header.version = Version;
+	header.dayStart = m_dayStart;
+	header.committed = m_offset;
+	std::memcpy(m_map, &header, sizeof(header));
+	return true;
+}
+
+void TickJournal::commit()
+{
+	if (!m_map) return;
+
+	// 헤더의 committed를 마지막에 갱신해야 읽는 쪽이 덜 쓴 레코드를 보지 않음
+	SegmentHeader header;
+	std::memcpy(&header, m_map, sizeof(header));
+	header.recordCount = m_recordCount;
+	header.minTime = m_minTime;
+	header.maxTime = m_maxTime;
+	header.committed = m_offset;
+	std::memcpy(m_map, &header, sizeof(header));
+}
+
+bool TickJournal::ensureCapacity(quint64 bytes)
+{
+	if (m_offset + bytes <= m_capacity) return true;
+
+	commit();
+	m_file.unmap(m_map);
+	m_map = nullptr;
+
+	quint64 capacity = m_capacity * 2;
+	while (m_offset + bytes > capacity) capacity *= 2;
+
+	if (!m_file.resize(static_cast<qint64>(capacity)))
+	{
+		qDebug() << "[TickJournal] 세그먼트 확장 실패:" << m_file.errorString();
+		m_file.close();
+		return false;
+	}
+
+	m_map = m_file.map(0, static_cast<qint64>(capacity));
+	if (!m_map)
+	{
+		m_file.close();
+		return false;
+	}
+
+	m_capacity = capacity;
+	return true;
+}
+
+void TickJournal::closeSegment()
+{
+	if (!m_map) return;
+
+	commit();
+	m_file.unmap(m_map);
+	m_map = nullptr;
+
+	// 예약해둔 빈 공간 잘라내기
+	m_file.resize(static_cast<qint64>(m_offset));
+	m_file.close();
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <QString>
+#include <QFile>
+#include <QHash>
+#include <QThread>
+#include <QSemaphore>
+#include <atomic>
+#include <vector>
+#include "StockData.h"
+#include "SpscQueue.h"
+
+// 수신한 시세를 하루 단위 바이너리 저널에 계속 덧붙여 기록 (포맷은 TickJournalFormat.h)
+//
+// record()는 GUI 스레드에서 호출되며 lock-free 큐에 넣기만 하고 바로 리턴.
+// 디스크 쓰기는 전용 스레드가 mmap 한 세그먼트 파일에 직접 기록함
+class TickJournal
+{
+public:
+	explicit TickJournal(const QString& dir);
+	~TickJournal();
+
+	bool start();
+	void stop();
+	bool isRunning() const { return m_thread != nullptr; }
+
+	// 큐가 가득 차면 버리고 false (GUI를 막지 않는 게 우선)
+	bool record(const StockData& data);
+
+	quint64 writtenCount() const { return m_written.load(std::memory_order_relaxed); }
+	quint64 droppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+	// 큐에 들어가는 항목 (QString은 참조 카운트만 복사되므로 할당 없음)
+	struct Entry
+	{
+		QString symbol;
+		qint64 timestamp = 0;
+		double price = 0.0;
+		double open = 0.0;
+		double high = 0.0;
+		double low = 0.0;
+		double prevClose = 0.0;
+		long long volume = 0;
+	};
+
+	// 세그먼트 안에서 심볼별 직전 값 (델타 인코딩 기준)
+	struct SymbolState
+	{
+		qint64 price = 0;
+		qint64 open = 0;
+		qint64 high = 0;
+		qint64 low = 0;
+		qint64 prevClose = 0;
+		qint64 volume = 0;
+	};
+
+	QString m_dir;
+	QThread* m_thread = nullptr;
+	std::atomic<bool> m_stopping{ false };
+	std::atomic<quint64> m_written{ 0 };
+	std::atomic<quint64> m_dropped{ 0 };
+
+	// 기록 스레드가 큐가 비어 잠들 때 true. record()가 보고 한 번만 깨움
+	std::atomic<bool> m_idle{ false };
+	QSemaphore m_wake;
+
+	SpscQueue<Entry, 16384> m_queue;
+
+	// 이하 기록 스레드 전용
+	QFile m_file;
+	uchar* m_map = nullptr;
+	quint64 m_capacity = 0;
+	quint64 m_offset = 0;
+	quint64 m_recordCount = 0;
+	qint64 m_dayStart = 0;
+	qint64 m_dayEnd = 0;
+	qint64 m_lastTime = 0;
+	qint64 m_minTime = 0;
+	qint64 m_maxTime = 0;
+	QHash<QString, quint32> m_symbolIds;
+	std::vector<SymbolState> m_states;
+
+	void run();
+	void wake();
+	void write(const Entry& entry);
+	bool openSegment(qint64 timestamp);
+	void closeSegment();
+	bool ensureCapacity(quint64 bytes);
+	void commit();
+};
@@ -0,0 +1,80 @@
+#pragma once
+#include <QtGlobal>
+#include <cstring>
+
+// 틱 저널 파일 포맷 (TickJournal / TickJournalReader 공용)
+//
+// 파일: <dir>/ticks-yyyyMMdd-NNN.sfj  (하루 단위 세그먼트, 재시작하면 NNN 증가)
+//
+// [헤더 64바이트] [레코드...] [미사용 예약 영역]
+//   committed 오프셋까지만 유효. 쓰는 도중에도 읽을 수 있음
+//
+// 레코드 (정수는 LEB128 varint, 부호 있는 값은 zigzag)
+//   SymbolDef: 0x01, id, 길이, UTF-8 바이트      - 세그먼트마다 심볼 사전을 새로 만듦
+//   Tick:      0x02, id, Δ시각, Δ현재가, Δ시가, Δ고가, Δ저가, Δ전일종가, Δ거래량
+//     - Δ시각: 직전 레코드 대비 (첫 레코드는 세그먼트 시작 시각 대비), ms
+//     - 가격/거래량: 같은 심볼의 직전 틱 대비, 가격은 PriceScale 배 고정소수점
+namespace TickJournalFormat
+{
+	constexpr char Magic[4] = { 'S', 'F', 'T', 'J' };
+	constexpr quint32 Version = 1;
+	constexpr qint64 PriceScale = 10000;
+
+	constexpr quint8 TagSymbolDef = 0x01;
+	constexpr quint8 TagTick = 0x02;
+
+	// 레코드 하나의 최대 크기 (tag + id + varint 7개)
+	constexpr int MaxTickRecordSize = 1 + 5 + 7 * 10;
+
+	struct SegmentHeader
+	{
+		char magic[4];
+		quint32 version;
+		qint64 dayStart;		// 세그먼트 기준 시각 (그날 0시, epoch ms)
+		quint64 committed;		// 유효 데이터 끝 오프셋 (헤더 포함)
+		quint64 recordCount;	// 틱 레코드 수
+		qint64 minTime;			// 틱 시각의 최소/최대 (시각이 역전될 수 있어 첫/마지막 레코드와 다를 수 있음)
+		qint64 maxTime;
+		quint8 reserved[16];
+	};
+	static_assert(sizeof(SegmentHeader) == 64, "SegmentHeader must be 64 bytes");
+
+	inline quint64 zigzag(qint64 v) { return (static_cast<quint64>(v) << 1) ^ static_cast<quint64>(v >> 63); }
+	inline qint64 unzigzag(quint64 v) { return static_cast<qint64>(v >> 1) ^ -static_cast<qint64>(v & 1); }
+
+	// 쓴 바이트 수 반환
+	inline int writeVarint(uchar* out, quint64 v)
+	{
+		int n = 0;
+		while (v >= 0x80)
+		{
+			out[n++] = static_cast<uchar>(v | 0x80);
+			v >>= 7;
+		}
+		out[n++] = static_cast<uchar>(v);
+		return n;
+	}
+
+	// 실패(잘린 데이터)하면 false
+	inline bool readVarint(const uchar*& p, const uchar* end, quint64& v)
+	{
+		v = 0;
+		for (int shift = 0; shift < 64 && p < end; shift += 7)
+		{
+			const uchar byte = *p++;
+			v |= static_cast<quint64>(byte & 0x7F) << shift;
+			if (!(byte & 0x80)) return true;
+		}
+		return false;
+	}
+
+	inline qint64 toFixed(double price)
+	{
+		return static_cast<qint64>(price * PriceScale + (price >= 0 ? 0.5 : -0.5));
+	}
+
+	inline double fromFixed(qint64 fixed)
+	{
+		return static_cast<double>(fixed) / PriceScale;
+	}
+}
@@ -0,0 +1,132 @@
+#include "TickJournalReader.h"
+#include "TickJournalFormat.h"
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QDebug>
+#include <cstring>
+#include <vector>
+
+using namespace TickJournalFormat;
+
+TickJournalReader::TickJournalReader(const QString& dir)
+{
+	QFileInfo info(dir);
+	if (info.isFile())
+	{
+		m_segments << info.absoluteFilePath();
+		return;
+	}
+
+	QDir journalDir(dir);
+	for (const QString& name : journalDir.entryList({ "ticks-*.sfj" }, QDir::Files, QDir::Name))
+		m_segments << journalDir.absoluteFilePath(name);
+}
+
+qint64 TickJournalReader::scan(qint64 from, qint64 to, const Callback& callback) const
+{
+	qint64 total = 0;
+	for (const QString& path : m_segments)
+	{
+		bool stopped = false;
+		total += scanSegment(path, from, to, callback, &stopped);
+		if (stopped) break;
+	}
+	return total;
+}
+
+qint64 TickJournalReader::scanSegment(const QString& path, qint64 from, qint64 to, const Callback& callback, bool* stopped)
+{
+	QFile file(path);
+	if (!file.open(QIODevice::ReadOnly) || file.size() < static_cast<qint64>(sizeof(SegmentHeader)))
+		return 0;
+
+	SegmentHeader header;
+	if (file.read(reinterpret_cast<char*>(&header), sizeof(header)) != sizeof(header)
+		|| std::memcmp(header.magic, Magic, sizeof(Magic)) != 0 || header.version != Version)
+	{
+		qDebug() << "[TickJournalReader] 저널 파일이 아님:" << path;
+		return 0;
+	}
+
+	// 헤더만 보고 구간 밖 세그먼트는 건너뜀
+	if (header.recordCount == 0 || header.maxTime < from || header.minTime > to)
+		return 0;
+
+	const qint64 committed = qMin(static_cast<qint64>(header.committed), file.size());
+	const uchar* map = file.map(0, committed);
+	if (!map) return 0;
+
+	struct SymbolState
+	{
+		QByteArrayView name;
+		qint64 price = 0, open = 0, high = 0, low = 0, prevClose = 0, volume = 0;
+	};
+	std::vector<SymbolState> symbols;
+
+	const uchar* p = map + sizeof(SegmentHeader);
+	const uchar* end = map + committed;
+	qint64 time = header.dayStart;
+	qint64 delivered = 0;
+	bool truncated = false;
+
+	while (p < end)
+	{
+		const quint8 tag = *p++;
+		quint64 id = 0;
+		if (!readVarint(p, end, id)) { truncated = true; break; }
+
+		if (tag == TagSymbolDef)
+		{
+			quint64 length = 0;
+			if (!readVarint(p, end, length) || p + length > end) { truncated = true; break; }
+			if (id >= symbols.size()) symbols.resize(id + 1);
+			symbols[id].name = QByteArrayView(reinterpret_cast<const char*>(p), static_cast<qsizetype>(length));
+			p += length;
+			continue;
+		}
+
+		if (tag != TagTick || id >= symbols.size()) { truncated = true; break; }
+
+		quint64 v[7];
+		bool ok = true;
+		for (quint64& field : v)
+			ok = ok && readVarint(p, end, field);
+		if (!ok) { truncated = true; break; }
+
+		SymbolState& s = symbols[id];
+		time += unzigzag(v[0]);
+		s.price += unzigzag(v[1]);
+		s.open += unzigzag(v[2]);
+		s.high += unzigzag(v[3]);
+		s.low += unzigzag(v[4]);
+		s.prevClose += unzigzag(v[5]);
+		s.volume += unzigzag(v[6]);
+
+		// 시각이 역전된 레코드가 있을 수 있어 구간을 넘어도 끝까지 봄
+		if (time < from || time > to) continue;
+
+		JournalRecord record;
+		record.symbol = s.name;
+		record.timestamp = time;
+		record.price = fromFixed(s.price);
+		record.open = fromFixed(s.open);
+		record.high = fromFixed(s.high);
+		record.low = fromFixed(s.low);
+		record.prevClose = fromFixed(s.prevClose);
+		record.volume = s.volume;
+
+		++delivered;
+		if (!callback(record))
+		{
+			if (stopped) *stopped = true;
+			break;
+		}
+	}
+
+	if (truncated)
+		qDebug() << "[TickJournalReader] 손상된 레코드에서 중단:" << path;
+
+	file.unmap(const_cast<uchar*>(map));
+	return delivered;
+}
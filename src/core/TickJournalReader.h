@@ -0,0 +1,42 @@
+#pragma once
+#include <QString>
+#include <QStringList>
+#include <QByteArrayView>
+#include <functional>
+
+// 저널에서 읽은 틱 한 건
+// symbol은 mmap 된 파일 안을 그대로 가리킴 (콜백 안에서만 유효)
+struct JournalRecord
+{
+	QByteArrayView symbol;	// UTF-8
+	qint64 timestamp = 0;
+	double price = 0.0;
+	double open = 0.0;
+	double high = 0.0;
+	double low = 0.0;
+	double prevClose = 0.0;
+	long long volume = 0;
+};
+
+// TickJournal이 남긴 세그먼트를 시간 구간으로 훑는 리더
+// 세그먼트 파일을 mmap 해서 제자리에서 디코딩하므로 파일 내용을 복사하지 않음
+class TickJournalReader
+{
+public:
+	// 콜백이 false를 반환하면 스캔 중단
+	using Callback = std::function<bool(const JournalRecord&)>;
+
+	explicit TickJournalReader(const QString& dir);
+
+	// 디렉터리 또는 세그먼트 파일 하나
+	QStringList segments() const { return m_segments; }
+
+	// [from, to] 구간 틱을 기록 순서대로 전달 (시장 시각이 역전된 틱은 그대로 역전). 전달한 개수 반환
+	qint64 scan(qint64 from, qint64 to, const Callback& callback) const;
+
+	// 세그먼트 파일 하나 전체
+	static qint64 scanSegment(const QString& path, qint64 from, qint64 to, const Callback& callback, bool* stopped = nullptr);
+
+private:
+	QStringList m_segments;	// 이름순 = 시간순
+};
@@ -0,0 +1,338 @@
+#include "MockServer.h"
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QDateTime>
+#include <QPointer>
+#include <QTimer>
+#include <QDebug>
+#include <cmath>
+#include <algorithm>
+
+MockServer::MockServer(const MockServerConfig& config, QObject* parent)
+	: QObject(parent), m_config(config),
+	  m_random(config.seed ? config.seed : QRandomGenerator::global()->generate())
+{
+	m_server = new QTcpServer(this);
+	connect(m_server, &QTcpServer::newConnection, this, &MockServer::onNewConnection);
+
+	m_clock.start();
+	m_tokens = m_config.rateLimit;
+}
+
+bool MockServer::listen(const QHostAddress& address)
+{
+	if (!m_server->listen(address, m_config.port))
+	{
+		qDebug() << "[MockServer] listen 실패:" << m_server->errorString();
+		return false;
+	}
+	return true;
+}
+
+QString MockServer::baseUrl() const
+{
+	return QString("http://127.0.0.1:%1").arg(port());
+}
+
+void MockServer::onNewConnection()
+{
+	while (QTcpSocket* socket = m_server->nextPendingConnection())
+	{
+		m_connections.insert(socket, Connection());
+		connect(socket, &QTcpSocket::readyRead, this, &MockServer::onReadyRead);
+		connect(socket, &QTcpSocket::disconnected, this, &MockServer::onDisconnected);
+	}
+}
+
+void MockServer::onDisconnected()
+{
+	QTcpSocket* socket = qobject_cast<QTcpSocket*>(sender());
+	if (!socket) return;
+
+	m_connections.remove(socket);
+	socket->deleteLater();
+}
+
+void MockServer::onReadyRead()
+{
+	QTcpSocket* socket = qobject_cast<QTcpSocket*>(sender());
+	if (!socket) return;
+
+	m_connections[socket].buffer.append(socket->readAll());
+	processBuffer(socket);
+}
+
+void MockServer::processBuffer(QTcpSocket* socket)
+{
+	auto it = m_connections.find(socket);
+	if (it == m_connections.end() || it->busy) return;
+
+	Request request;
+	if (!parseRequest(it->buffer, request)) return;
+
+	// 응답을 보내기 전까지 같은 연결의 다음 요청은 처리하지 않음 (순서 보장)
+	it->busy = true;
+	m_requests.fetch_add(1, std::memory_order_relaxed);
+
+	Response response;
+	if (!takeToken())
+	{
+		m_rateLimited.fetch_add(1, std::memory_order_relaxed);
+		response.status = 429;
+		response.body = request.path.startsWith("/uapi") || request.path.startsWith("/oauth2")
+			? QJsonDocument(QJsonObject{ { "rt_cd", "1" }, { "msg_cd", "EGW00201" },
+				{ "msg1", "초당 거래건수를 초과하였습니다." } }).toJson(QJsonDocument::Compact)
+			: QByteArray(R"({"error":"API limit reached. Please try again later."})");
+	}
+	else if (m_config.errorRate > 0 && m_random.generateDouble() < m_config.errorRate)
+	{
+		m_errors.fetch_add(1, std::memory_order_relaxed);
+		response.status = 500;
+		response.body = R"({"error":"mock internal error"})";
+	}
+	else
+	{
+		response = route(request);
+	}
+
+	const int delay = m_config.latencyMs
+		+ (m_config.jitterMs > 0 ? static_cast<int>(m_random.bounded(m_config.jitterMs + 1)) : 0);
+
+	QPointer<QTcpSocket> guard(socket);
+	QTimer::singleShot(delay, this, [this, guard, request, response]()
+	{
+		if (!guard) return;
+		send(guard, request, response);
+	});
+}
+
+bool MockServer::parseRequest(QByteArray& buffer, Request& request) const
+{
+	const qsizetype headerEnd = buffer.indexOf("\r\n\r\n");
+	if (headerEnd < 0) return false;
+
+	const QList<QByteArray> lines = buffer.left(headerEnd).split('\n');
+	const QList<QByteArray> requestLine = lines.value(0).trimmed().split(' ');
+	if (requestLine.size() < 3) return false;
+
+	qsizetype contentLength = 0;
+	request.keepAlive = (requestLine[2] == "HTTP/1.1");
+	for (qsizetype i = 1; i < lines.size(); ++i)
+	{
+		const QByteArray line = lines[i].trimmed();
+		const qsizetype colon = line.indexOf(':');
+		if (colon <= 0) continue;
+
+		const QByteArray name = line.left(colon).trimmed().toLower();
+		const QByteArray value = line.mid(colon + 1).trimmed();
+		if (name == "content-length") contentLength = value.toLongLong();
+		else if (name == "connection") request.keepAlive = (value.toLower() != "close");
+	}
+
+	const qsizetype total = headerEnd + 4 + contentLength;
+	if (buffer.size() < total) return false;	// 본문이 아직 다 안 옴
+
+	const QByteArray target = requestLine[1];
+	const qsizetype q = target.indexOf('?');
+	request.method = requestLine[0];
+	request.path = (q < 0) ? target : target.left(q);
+	request.query = QUrlQuery(q < 0 ? QString() : QString::fromUtf8(target.mid(q + 1)));
+	request.body = buffer.mid(headerEnd + 4, contentLength);
+
+	buffer.remove(0, total);
+	return true;
+}
+
+bool MockServer::takeToken()
+{
+	if (m_config.rateLimit <= 0) return true;
+
+	const qint64 now = m_clock.elapsed();
+	m_tokens = qMin<double>(m_config.rateLimit, m_tokens + (now - m_lastRefill) * m_config.rateLimit / 1000.0);
+	m_lastRefill = now;
+
+	if (m_tokens < 1.0) return false;
+	m_tokens -= 1.0;
+	return true;
+}
+
+void MockServer::send(QTcpSocket* socket, const Request& request, const Response& response)
+{
+	const char* reason;
+	switch (response.status)
+	{
+	case 200: reason = "OK"; break;
+	case 400: reason = "Bad Request"; break;
+	case 404: reason = "Not Found"; break;
+	case 429: reason = "Too Many Requests"; break;
+	case 500: reason = "Internal Server Error"; break;
+	default:
+		// 표에 없는 코드는 분류만 맞춰서 (클라이언트는 상태 코드만 봄)
+		reason = response.status >= 500 ? "Server Error"
+			: response.status >= 400 ? "Client Error"
+			: response.status >= 300 ? "Redirection"
+			: "OK";
+		break;
+	}
+
+	QByteArray head = "HTTP/1.1 " + QByteArray::number(response.status) + ' ' + reason + "\r\n"
+		"Content-Type: application/json; charset=utf-8\r\n"
+		"Content-Length: " + QByteArray::number(response.body.size()) + "\r\n"
+		+ (request.keepAlive ? "Connection: keep-alive\r\n" : "Connection: close\r\n")
+		+ "\r\n";
+
+	socket->write(head);
+	socket->write(response.body);
+
+	if (!request.keepAlive)
+	{
+		socket->disconnectFromHost();
+		return;
+	}
+
+	// 다음 요청이 이미 버퍼에 있으면 이어서 처리
+	auto it = m_connections.find(socket);
+	if (it == m_connections.end()) return;
+	it->busy = false;
+	processBuffer(socket);
+}
+
+MockServer::Response MockServer::route(const Request& request)
+{
+	if (request.path == "/quote") return finnhubQuote(request);
+	if (request.path == "/stock/profile2") return finnhubProfile(request);
+	if (request.path == "/stock/symbol") return finnhubSymbols(request);
+	if (request.path == "/forex/rates") return finnhubFxRates(request);
+	if (request.path == "/oauth2/tokenP") return kisToken(request);
+	if (request.path == "/uapi/domestic-stock/v1/quotations/inquire-price") return kisPrice(request);
+
+	return { 404, R"({"error":"not found"})" };
+}
+
+MockServer::Quote& MockServer::tick(const QString& symbol, bool korean)
+{
+	auto it = m_quotes.find(symbol);
+	if (it == m_quotes.end())
+	{
+		// 심볼마다 그럴듯한 시작가 (한국: 1,000 ~ 300,000원, 미국: 5 ~ 500달러)
+		double base = korean ? 1000 + m_random.bounded(299000) : 5 + m_random.generateDouble() * 495;
+		if (korean) base = std::round(base / 100) * 100;
+		it = m_quotes.insert(symbol, { base, base, base, base, base, 0 });
+	}
+
+	// 랜덤 워크 (틱당 최대 ±0.5%)
+	Quote& q = it.value();
+	double next = q.price * (1.0 + (m_random.generateDouble() - 0.5) * 0.01);
+	next = korean ? std::max(1.0, std::round(next)) : std::max(0.01, std::round(next * 100) / 100);
+
+	q.price = next;
+	q.high = qMax(q.high, next);
+	q.low = qMin(q.low, next);
+	q.volume += 1 + m_random.bounded(1000);
+	return q;
+}
+
+MockServer::Response MockServer::finnhubQuote(const Request& request)
+{
+	const QString symbol = request.query.queryItemValue("symbol");
+	if (symbol.isEmpty()) return { 400, R"({"error":"symbol required"})" };
+
+	const Quote& q = tick(symbol, false);
+	QJsonObject obj{
+		{ "c", q.price },
+		{ "d", q.price - q.prevClose },
+		{ "dp", (q.price - q.prevClose) / q.prevClose * 100.0 },
+		{ "h", q.high },
+		{ "l", q.low },
+		{ "o", q.open },
+		{ "pc", q.prevClose },
+		{ "t", QDateTime::currentSecsSinceEpoch() }
+	};
+	return { 200, QJsonDocument(obj).toJson(QJsonDocument::Compact) };
+}
+
+MockServer::Response MockServer::finnhubProfile(const Request& request)
+{
+	const QString symbol = request.query.queryItemValue("symbol");
+
+	// 로고 주소는 비워둠 (외부 이미지 서버로 나가지 않도록)
+	QJsonObject obj{
+		{ "ticker", symbol },
+		{ "name", symbol + " Mock Inc" },
+		{ "country", "US" },
+		{ "currency", "USD" },
+		{ "exchange", "MOCK" },
+		{ "logo", "" }
+	};
+	return { 200, QJsonDocument(obj).toJson(QJsonDocument::Compact) };
+}
+
+MockServer::Response MockServer::finnhubSymbols(const Request&)
+{
+	// 자주 쓰는 종목 + 가짜 종목 (MK0001 ...)
+	QJsonArray array;
+	for (const char* symbol : { "AAPL", "GOOGL", "NVDA", "MSFT", "AMZN", "TSLA", "META" })
+		array.append(QJsonObject{ { "symbol", symbol }, { "description", QString(symbol) + " MOCK" }, { "type", "Common Stock" } });
+
+	for (int i = 1; i <= m_config.symbolCount; ++i)
+	{
+		QString symbol = QString("MK%1").arg(i, 4, 10, QChar('0'));
+		array.append(QJsonObject{ { "symbol", symbol }, { "description", "MOCK COMPANY " + QString::number(i) }, { "type", "Common Stock" } });
+	}
+	return { 200, QJsonDocument(array).toJson(QJsonDocument::Compact) };
+}
+
+MockServer::Response MockServer::finnhubFxRates(const Request& request)
+{
+	if (request.query.queryItemValue("base") != "USD")
+		return { 200, R"({"base":"","quote":{}})" };
+
+	// 1달러 = 1,300 ~ 1,400원 사이에서 흔들림
+	QJsonObject quote{
+		{ "KRW", 1300.0 + m_random.generateDouble() * 100.0 },
+		{ "JPY", 140.0 + m_random.generateDouble() * 10.0 },
+		{ "EUR", 0.9 + m_random.generateDouble() * 0.05 }
+	};
+	return { 200, QJsonDocument(QJsonObject{ { "base", "USD" }, { "quote", quote } }).toJson(QJsonDocument::Compact) };
+}
+
+MockServer::Response MockServer::kisToken(const Request& request)
+{
+	if (request.method != "POST") return { 404, R"({"error":"not found"})" };
+
+	QJsonObject obj{
+		{ "access_token", "mock-access-token" },
+		{ "token_type", "Bearer" },
+		{ "expires_in", 86400 },
+		{ "access_token_token_expired", QDateTime::currentDateTime().addDays(1).toString("yyyy-MM-dd HH:mm:ss") }
+	};
+	return { 200, QJsonDocument(obj).toJson(QJsonDocument::Compact) };
+}
+
+MockServer::Response MockServer::kisPrice(const Request& request)
+{
+	const QString symbol = request.query.queryItemValue("fid_input_iscd");
+	if (symbol.isEmpty())
+		return { 500, QJsonDocument(QJsonObject{ { "rt_cd", "1" }, { "msg1", "종목코드 오류" } }).toJson(QJsonDocument::Compact) };
+
+	// 한투는 숫자도 문자열로 내려줌
+	const Quote& q = tick(symbol, true);
+	auto str = [](double v) { return QString::number(static_cast<long long>(v)); };
+	QJsonObject output{
+		{ "stck_prpr", str(q.price) },
+		{ "prdy_vrss", str(q.price - q.prevClose) },
+		{ "prdy_ctrt", QString::number((q.price - q.prevClose) / q.prevClose * 100.0, 'f', 2) },
+		{ "stck_oprc", str(q.open) },
+		{ "stck_hgpr", str(q.high) },
+		{ "stck_lwpr", str(q.low) },
+		{ "acml_vol", QString::number(q.volume) }
+	};
+	QJsonObject obj{
+		{ "rt_cd", "0" },
+		{ "msg_cd", "MCA00000" },
+		{ "msg1", "정상처리 되었습니다." },
+		{ "output", output }
+	};
+	return { 200, QJsonDocument(obj).toJson(QJsonDocument::Compact) };
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QHash>
+#include <QUrlQuery>
+#include <QElapsedTimer>
+#include <QRandomGenerator>
+#include <atomic>
+
+// 부하/지연 테스트용 Finnhub + KIS 대역 서버
+// 실제 응답과 같은 모양의 JSON을 가짜 시세로 돌려줌
+//
+// 지원 경로
+//   Finnhub: GET /quote, /stock/profile2, /stock/symbol
+//   KIS:     POST /oauth2/tokenP, GET /uapi/domestic-stock/v1/quotations/inquire-price
+struct MockServerConfig
+{
+	quint16 port = 18080;
+	int latencyMs = 0;			// 기본 응답 지연
+	int jitterMs = 0;			// 지연에 더해지는 무작위 값 (0 ~ jitterMs)
+	double errorRate = 0.0;		// 500 응답 비율 (0.0 ~ 1.0)
+	int rateLimit = 0;			// 초당 허용 요청 수 (0 = 무제한, 초과 시 429)
+	int symbolCount = 5000;		// /stock/symbol 응답 종목 수
+	quint32 seed = 0;			// 0이면 매번 다른 시세
+};
+
+class MockServer : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit MockServer(const MockServerConfig& config, QObject* parent = nullptr);
+
+	bool listen(const QHostAddress& address = QHostAddress::LocalHost);
+	quint16 port() const { return m_server->serverPort(); }
+	QString baseUrl() const;
+
+	// 통계 (다른 스레드에서 읽어도 됨)
+	quint64 requestCount() const { return m_requests.load(); }
+	quint64 rateLimitedCount() const { return m_rateLimited.load(); }
+	quint64 errorCount() const { return m_errors.load(); }
+
+private slots:
+	void onNewConnection();
+	void onReadyRead();
+	void onDisconnected();
+
+private:
+	struct Request
+	{
+		QByteArray method;
+		QByteArray path;
+		QUrlQuery query;
+		QByteArray body;
+		bool keepAlive = true;
+	};
+
+	struct Response
+	{
+		int status = 200;
+		QByteArray body;
+	};
+
+	// 연결마다 아직 처리 못 한 바이트와 응답 대기 여부
+	struct Connection
+	{
+		QByteArray buffer;
+		bool busy = false;
+	};
+
+	// 종목별 가짜 시세 (랜덤 워크)
+	struct Quote
+	{
+		double price;
+		double open;
+		double high;
+		double low;
+		double prevClose;
+		long long volume;
+	};
+
+	MockServerConfig m_config;
+	QTcpServer* m_server;
+	QHash<QTcpSocket*, Connection> m_connections;
+	QHash<QString, Quote> m_quotes;
+	QRandomGenerator m_random;
+
+	// 초당 요청 제한 (토큰 버킷)
+	QElapsedTimer m_clock;
+	double m_tokens = 0.0;
+	qint64 m_lastRefill = 0;
+
+	std::atomic<quint64> m_requests{ 0 };
+	std::atomic<quint64> m_rateLimited{ 0 };
+	std::atomic<quint64> m_errors{ 0 };
+
+	void processBuffer(QTcpSocket* socket);
+	bool parseRequest(QByteArray& buffer, Request& request) const;
+	Response route(const Request& request);
+	void send(QTcpSocket* socket, const Request& request, const Response& response);
+	bool takeToken();
+
+	Quote& tick(const QString& symbol, bool korean);
+
+	Response finnhubQuote(const Request& request);
+	Response finnhubProfile(const Request& request);
+	Response finnhubSymbols(const Request& request);
+	Response finnhubFxRates(const Request& request);
+	Response kisToken(const Request& request);
+	Response kisPrice(const Request& request);
+};
@@ -0,0 +1,52 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QTimer>
+#include <QDebug>
+#include "MockServer.h"
+
+int main(int argc, char* argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("StockFlow용 Finnhub/KIS 대역 서버");
+    parser.addHelpOption();
+    QCommandLineOption portOption("port", "포트", "port", "18080");
+    QCommandLineOption latencyOption("latency", "기본 응답 지연 (ms)", "ms", "0");
+    QCommandLineOption jitterOption("jitter", "추가 무작위 지연 최대값 (ms)", "ms", "0");
+    QCommandLineOption errorOption("error-rate", "500 응답 비율 (0.0 ~ 1.0)", "rate", "0");
+    QCommandLineOption rateOption("rate-limit", "초당 허용 요청 수 (0 = 무제한)", "rps", "0");
+    QCommandLineOption symbolsOption("symbols", "/stock/symbol 응답 종목 수", "count", "5000");
+    QCommandLineOption seedOption("seed", "시세 난수 시드 (0 = 무작위)", "seed", "0");
+    parser.addOptions({ portOption, latencyOption, jitterOption, errorOption, rateOption, symbolsOption, seedOption });
+    parser.process(app);
+
+    MockServerConfig config;
+    config.port = static_cast<quint16>(parser.value(portOption).toUInt());
+    config.latencyMs = parser.value(latencyOption).toInt();
+    config.jitterMs = parser.value(jitterOption).toInt();
+    config.errorRate = parser.value(errorOption).toDouble();
+    config.rateLimit = parser.value(rateOption).toInt();
+    config.symbolCount = parser.value(symbolsOption).toInt();
+    config.seed = parser.value(seedOption).toUInt();
+
+    MockServer server(config);
+    if (!server.listen())
+        return 1;
+
+    qDebug().noquote() << "Mock server:" << server.baseUrl();
+    qDebug().noquote() << "  STOCKFLOW_FINNHUB_BASE_URL=" + server.baseUrl()
+                       << " STOCKFLOW_KIS_BASE_URL=" + server.baseUrl();
+
+    // 5초마다 통계
+    QTimer stats;
+    QObject::connect(&stats, &QTimer::timeout, [&server]()
+    {
+        qDebug() << "requests:" << server.requestCount()
+                 << "429:" << server.rateLimitedCount()
+                 << "500:" << server.errorCount();
+    });
+    stats.start(5000);
+
+    return app.exec();
+}
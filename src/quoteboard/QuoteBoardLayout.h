@@ -0,0 +1,71 @@
+#pragma once
+#include <QtGlobal>
+#include <atomic>
+#include <cstddef>
+
+// 공유 메모리 시세판 배치 (StockFlow가 쓰고 다른 프로세스가 읽음)
+//
+// [Header 64B][Slot 0 128B][Slot 1 128B]...
+// 슬롯은 종목 하나. 처음 나온 종목에 다음 슬롯을 배정하고 symbolCount를 올려서 공개함
+// 슬롯 값은 seqlock으로 보호: 쓰는 쪽은 seq를 홀수로 만들고 값을 쓴 뒤 짝수로 되돌림,
+// 읽는 쪽은 읽기 전후 seq가 같은 짝수일 때만 값을 채택 (락 없음, 쓰는 쪽을 절대 막지 않음)
+//
+// 값 필드를 std::atomic으로 두는 이유: 쓰는 중에 읽는 것이 데이터 경합(UB)이 되지 않도록.
+// relaxed load/store라 x86/ARM64 모두 일반 mov/ldr와 같은 비용
+namespace QuoteBoardLayout
+{
+	constexpr quint32 Magic = 0x42514653;	// "SFQB"
+	constexpr quint32 Version = 1;
+	constexpr int SymbolBytes = 16;			// UTF-8, 널 종료 (최대 15바이트)
+	constexpr int DefaultSlotCount = 4096;
+	constexpr const char* DefaultKey = "StockFlowQuoteBoard";
+
+	struct alignas(64) Header
+	{
+		quint32 magic;
+		quint32 version;
+		quint32 slotCount;
+		quint32 slotSize;
+		std::atomic<quint32> generation;	// 쓰는 쪽이 새로 초기화할 때마다 증가 (읽는 쪽 캐시 무효화)
+		std::atomic<quint32> symbolCount;	// 공개된 슬롯 수 (release로 증가)
+		std::atomic<quint64> publishCount;	// 누적 갱신 수
+		std::atomic<qint64> heartbeat;		// 마지막 갱신 시각 (epoch ms)
+	};
+
+	struct alignas(64) Slot
+	{
+		std::atomic<quint32> seq;			// 홀수 = 쓰는 중
+		char symbol[SymbolBytes];			// 슬롯 공개 전에 한 번만 씀
+		std::atomic<qint64> timestamp;		// epoch ms
+		std::atomic<double> price;
+		std::atomic<double> open;
+		std::atomic<double> high;
+		std::atomic<double> low;
+		std::atomic<double> prevClose;
+		std::atomic<qint64> volume;
+		std::atomic<quint64> updateCount;	// 이 종목 갱신 횟수
+	};
+
+	static_assert(sizeof(Header) == 64, "QuoteBoard Header 크기가 바뀌면 Version을 올릴 것");
+	static_assert(sizeof(Slot) == 128, "QuoteBoard Slot 크기가 바뀌면 Version을 올릴 것");
+	static_assert(std::atomic<quint64>::is_always_lock_free && std::atomic<double>::is_always_lock_free,
+		"프로세스 간 공유에는 lock-free atomic이 필요");
+
+	constexpr qsizetype segmentSize(int slotCount)
+	{
+		return static_cast<qsizetype>(sizeof(Header)) + static_cast<qsizetype>(sizeof(Slot)) * slotCount;
+	}
+}
+
+// 슬롯 하나의 일관된 사본
+struct QuoteBoardQuote
+{
+	qint64 timestamp = 0;
+	double price = 0.0;
+	double open = 0.0;
+	double high = 0.0;
+	double low = 0.0;
+	double prevClose = 0.0;
+	qint64 volume = 0;
+	quint64 updateCount = 0;
+};
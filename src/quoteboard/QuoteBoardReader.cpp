@@ -0,0 +1,164 @@
+#include "QuoteBoardReader.h"
+#include <QThread>
+#include <QDebug>
+#include <cstring>
+
+using namespace QuoteBoardLayout;
+
+namespace
+{
+	// 쓰는 쪽이 값을 쓰는 도중 죽으면 seq가 홀수로 남음 -> 무한 대기 대신 포기
+	constexpr int MaxReadAttempts = 1000;
+}
+
+QuoteBoardReader::QuoteBoardReader(const QString& key)
+{
+	m_memory.setKey(key);
+}
+
+QuoteBoardReader::~QuoteBoardReader()
+{
+	close();
+}
+
+bool QuoteBoardReader::open()
+{
+	if (isOpen()) return true;
+
+	if (!m_memory.attach(QSharedMemory::ReadOnly))
+	{
+		qDebug() << "[QuoteBoard] 시세판 없음 (StockFlow 실행 중인지 확인):" << m_memory.errorString();
+		return false;
+	}
+
+	const Header* header = static_cast<const Header*>(m_memory.constData());
+	if (m_memory.size() < static_cast<qsizetype>(sizeof(Header)) || header->magic != Magic
+		|| header->version != Version || header->slotSize != sizeof(Slot)
+		|| m_memory.size() < segmentSize(static_cast<int>(header->slotCount)))
+	{
+		qDebug() << "[QuoteBoard] 형식이 맞지 않음 (버전이 다른 StockFlow?)";
+		m_memory.detach();
+		return false;
+	}
+
+	m_header = header;
+	m_base = reinterpret_cast<const Slot*>(static_cast<const char*>(m_memory.constData()) + sizeof(Header));
+	m_slotCount = static_cast<int>(header->slotCount);
+	m_index.clear();
+	m_indexed = 0;
+	m_generation = 0;
+	return true;
+}
+
+void QuoteBoardReader::close()
+{
+	if (!isOpen()) return;
+	m_header = nullptr;
+	m_base = nullptr;
+	m_index.clear();
+	m_memory.detach();
+}
+
+void QuoteBoardReader::refreshIndex()
+{
+	// 쓰는 쪽이 다시 초기화했으면 슬롯 배정이 달라졌으므로 처음부터
+	const quint32 generation = m_header->generation.load(std::memory_order_acquire);
+	if (generation != m_generation)
+	{
+		m_index.clear();
+		m_indexed = 0;
+		m_generation = generation;
+	}
+
+	const int count = qMin(static_cast<int>(m_header->symbolCount.load(std::memory_order_acquire)), m_slotCount);
+	for (int i = m_indexed; i < count; ++i)
+	{
+		const char* symbol = m_base[i].symbol;
+		m_index.insert(QString::fromUtf8(symbol, static_cast<qsizetype>(strnlen(symbol, SymbolBytes))), i);
+	}
+	m_indexed = qMax(m_indexed, count);
+}
+
+QStringList QuoteBoardReader::symbols()
+{
+	if (!isOpen()) return {};
+	refreshIndex();
+
+	QStringList list(m_indexed);
+	for (auto it = m_index.cbegin(); it != m_index.cend(); ++it)
+		list[it.value()] = it.key();
+	return list;
+}
+
+int QuoteBoardReader::indexOf(const QString& symbol)
+{
+	if (!isOpen()) return -1;
+
+	if (m_header->generation.load(std::memory_order_acquire) == m_generation)
+	{
+		auto it = m_index.constFind(symbol);
+		if (it != m_index.cend())
+			return it.value();
+	}
+
+	// 새로 추가된 종목일 수 있음
+	refreshIndex();
+	return m_index.value(symbol, -1);
+}
+
+bool QuoteBoardReader::read(const QString& symbol, QuoteBoardQuote& quote)
+{
+	const int slot = indexOf(symbol);
+	return slot >= 0 && read(slot, quote);
+}
+
+bool QuoteBoardReader::read(int index, QuoteBoardQuote& quote) const
+{
+	if (!isOpen() || index < 0 || index >= m_slotCount) return false;
+
+	// 슬롯 번호는 m_generation 때의 배정이라 다시 초기화됐으면 다른 종목일 수 있음
+	if (m_header->generation.load(std::memory_order_acquire) != m_generation) return false;
+
+	const Slot& slot = m_base[index];
+	for (int attempt = 0; attempt < MaxReadAttempts; ++attempt)
+	{
+		const quint32 before = slot.seq.load(std::memory_order_acquire);
+		if (before & 1)
+		{
+			++m_retries;
+			QThread::yieldCurrentThread();
+			continue;
+		}
+
+		quote.timestamp = slot.timestamp.load(std::memory_order_relaxed);
+		quote.price = slot.price.load(std::memory_order_relaxed);
+		quote.open = slot.open.load(std::memory_order_relaxed);
+		quote.high = slot.high.load(std::memory_order_relaxed);
+		quote.low = slot.low.load(std::memory_order_relaxed);
+		quote.prevClose = slot.prevClose.load(std::memory_order_relaxed);
+		quote.volume = slot.volume.load(std::memory_order_relaxed);
+		quote.updateCount = slot.updateCount.load(std::memory_order_relaxed);
+
+		// 값 읽기가 두 번째 seq 읽기 뒤로 밀리지 않도록
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (slot.seq.load(std::memory_order_relaxed) == before)
+		{
+			// 읽는 도중 초기화된 경우
+			if (m_header->generation.load(std::memory_order_relaxed) != m_generation) return false;
+			return quote.updateCount > 0;
+		}
+
+		++m_retries;
+	}
+	return false;
+}
+
+quint64 QuoteBoardReader::publishCount() const
+{
+	return isOpen() ? m_header->publishCount.load(std::memory_order_relaxed) : 0;
+}
+
+qint64 QuoteBoardReader::heartbeat() const
+{
+	return isOpen() ? m_header->heartbeat.load(std::memory_order_relaxed) : 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include <QSharedMemory>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include "QuoteBoardLayout.h"
+
+// 시세판을 읽는 쪽 (다른 프로세스용 라이브러리)
+//
+//   QuoteBoardReader reader;
+//   if (reader.open()) {
+//       QuoteBoardQuote quote;
+//       if (reader.read("AAPL", quote)) ...
+//   }
+//
+// 읽기는 락 없이 seqlock 재시도만 하므로 아무리 자주 읽어도 StockFlow를 막지 않음
+class QuoteBoardReader
+{
+public:
+	explicit QuoteBoardReader(const QString& key = QuoteBoardLayout::DefaultKey);
+	~QuoteBoardReader();
+
+	bool open();
+	void close();
+	bool isOpen() const { return m_header != nullptr; }
+
+	// 지금 공개된 종목들
+	QStringList symbols();
+	int indexOf(const QString& symbol);
+
+	// 아직 시세가 없는 종목이면 false
+	bool read(const QString& symbol, QuoteBoardQuote& quote);
+	// slot은 indexOf()/symbols() 결과. 그 뒤 쓰는 쪽이 다시 초기화했으면(슬롯 배정이 바뀜) false -> indexOf부터 다시
+	bool read(int slot, QuoteBoardQuote& quote) const;
+
+	quint64 publishCount() const;
+	qint64 heartbeat() const;			// 마지막 갱신 시각 (쓰는 쪽이 살아있는지 판단용)
+	quint64 retryCount() const { return m_retries; }	// seqlock 충돌로 다시 읽은 횟수
+
+private:
+	QSharedMemory m_memory;
+	const QuoteBoardLayout::Header* m_header = nullptr;
+	const QuoteBoardLayout::Slot* m_base = nullptr;
+	int m_slotCount = 0;
+
+	// 심볼 -> 슬롯 캐시 (generation이 바뀌면 비움)
+	QHash<QString, int> m_index;
+	int m_indexed = 0;
+	quint32 m_generation = 0;
+	mutable quint64 m_retries = 0;
+
+	void refreshIndex();
+};
@@ -0,0 +1,155 @@
+#include "QuoteBoardWriter.h"
+#include <QDateTime>
+#include <QDebug>
+#include <cstring>
+#include <new>
+
+using namespace QuoteBoardLayout;
+
+QuoteBoardWriter::QuoteBoardWriter(const QString& key, int slotCount)
+	: m_slotCount(qMax(1, slotCount))
+{
+	m_memory.setKey(key);
+}
+
+QuoteBoardWriter::~QuoteBoardWriter()
+{
+	close();
+}
+
+bool QuoteBoardWriter::open()
+{
+	if (isOpen()) return true;
+
+	const qsizetype size = segmentSize(m_slotCount);
+	bool fresh = m_memory.create(size);
+	if (!fresh)
+	{
+		if (m_memory.error() != QSharedMemory::AlreadyExists || !m_memory.attach())
+		{
+			qDebug() << "[QuoteBoard] 공유 메모리 생성 실패:" << m_memory.errorString();
+			return false;
+		}
+		if (m_memory.size() < size)
+		{
+			qDebug() << "[QuoteBoard] 기존 세그먼트가 작음:" << m_memory.size() << "<" << size;
+			m_memory.detach();
+			return false;
+		}
+	}
+
+	m_header = static_cast<Header*>(m_memory.data());
+	m_base = reinterpret_cast<Slot*>(static_cast<char*>(m_memory.data()) + sizeof(Header));
+
+	quint32 generation = 1;
+	if (fresh)
+	{
+		new (m_header) Header{};
+		for (int i = 0; i < m_slotCount; ++i)
+			new (&m_base[i]) Slot{};
+	}
+	else if (m_header->magic == Magic)
+	{
+		generation = m_header->generation.load(std::memory_order_relaxed) + 1;
+	}
+	initialize(generation);
+
+	qDebug() << "[QuoteBoard] 공개:" << m_memory.key() << m_slotCount << "슬롯," << size << "bytes";
+	return true;
+}
+
+void QuoteBoardWriter::initialize(quint32 generation)
+{
+	m_slots.clear();
+	m_fullReported = false;
+
+	// 읽는 쪽이 보는 종목 수부터 0으로 -> 이후 슬롯 재배정
+	m_header->symbolCount.store(0, std::memory_order_release);
+
+	// 이전 쓰는 쪽이 쓰는 도중 죽었으면 seq가 홀수로 남아 읽는 쪽이 영원히 재시도함 -> 짝수로 올림
+	// (0으로 되돌리지 않는 건 붙어 있던 읽는 쪽이 이전 값과 같은 seq를 보지 않게)
+	for (int i = 0; i < m_slotCount; ++i)
+	{
+		const quint32 seq = m_base[i].seq.load(std::memory_order_relaxed);
+		if (seq & 1)
+			m_base[i].seq.store(seq + 1, std::memory_order_release);
+	}
+
+	m_header->magic = Magic;
+	m_header->version = Version;
+	m_header->slotCount = static_cast<quint32>(m_slotCount);
+	m_header->slotSize = sizeof(Slot);
+	m_header->publishCount.store(0, std::memory_order_relaxed);
+	m_header->heartbeat.store(QDateTime::currentMSecsSinceEpoch(), std::memory_order_relaxed);
+	m_header->generation.store(generation, std::memory_order_release);
+}
+
+void QuoteBoardWriter::close()
+{
+	if (!isOpen()) return;
+
+	// 쓰는 쪽이 없어졌음을 알림 (세그먼트는 마지막 프로세스가 떨어질 때 사라짐)
+	m_header->heartbeat.store(0, std::memory_order_release);
+	m_header = nullptr;
+	m_base = nullptr;
+	m_slots.clear();
+	m_memory.detach();
+}
+
+int QuoteBoardWriter::slotFor(const QString& symbol)
+{
+	auto it = m_slots.constFind(symbol);
+	if (it != m_slots.cend())
+		return it.value();
+
+	const int index = m_slots.size();
+	if (index >= m_slotCount)
+	{
+		if (!m_fullReported)
+			qDebug() << "[QuoteBoard] 슬롯 부족, 더 이상 종목을 추가하지 않음:" << m_slotCount;
+		m_fullReported = true;
+		return -1;
+	}
+
+	// 아직 공개 전 슬롯이라 읽는 쪽과 겹치지 않음
+	Slot& slot = m_base[index];
+	const QByteArray utf8 = symbol.toUtf8().left(SymbolBytes - 1);
+	std::memset(slot.symbol, 0, SymbolBytes);
+	std::memcpy(slot.symbol, utf8.constData(), static_cast<size_t>(utf8.size()));
+	slot.updateCount.store(0, std::memory_order_relaxed);
+
+	m_slots.insert(symbol, index);
+	m_header->symbolCount.store(static_cast<quint32>(index + 1), std::memory_order_release);
+	return index;
+}
+
+bool QuoteBoardWriter::publish(const QString& symbol, const QuoteBoardQuote& quote)
+{
+	if (!isOpen()) return false;
+
+	const int index = slotFor(symbol);
+	if (index < 0) return false;
+
+	Slot& slot = m_base[index];
+	const quint32 seq = slot.seq.load(std::memory_order_relaxed);
+
+	// 홀수로 만든 뒤에 값을 씀 (fence로 값 쓰기가 seq 앞으로 당겨지지 않게)
+	slot.seq.store(seq + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	slot.timestamp.store(quote.timestamp, std::memory_order_relaxed);
+	slot.price.store(quote.price, std::memory_order_relaxed);
+	slot.open.store(quote.open, std::memory_order_relaxed);
+	slot.high.store(quote.high, std::memory_order_relaxed);
+	slot.low.store(quote.low, std::memory_order_relaxed);
+	slot.prevClose.store(quote.prevClose, std::memory_order_relaxed);
+	slot.volume.store(quote.volume, std::memory_order_relaxed);
+	slot.updateCount.store(slot.updateCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+	slot.seq.store(seq + 2, std::memory_order_release);
+
+	// 쓰는 쪽은 하나뿐이라 fetch_add 없이 갱신
+	m_header->publishCount.store(m_header->publishCount.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+	m_header->heartbeat.store(QDateTime::currentMSecsSinceEpoch(), std::memory_order_relaxed);
+	return true;
+}
@@ -0,0 +1,36 @@
+#pragma once
+#include <QSharedMemory>
+#include <QHash>
+#include <QString>
+#include "QuoteBoardLayout.h"
+
+// 시세판에 쓰는 쪽 (StockFlow 한 프로세스, 한 스레드에서만 호출)
+class QuoteBoardWriter
+{
+public:
+	explicit QuoteBoardWriter(const QString& key = QuoteBoardLayout::DefaultKey,
+		int slotCount = QuoteBoardLayout::DefaultSlotCount);
+	~QuoteBoardWriter();
+
+	// 이미 있는 세그먼트(이전 실행이 비정상 종료)면 붙어서 새로 초기화
+	bool open();
+	void close();
+	bool isOpen() const { return m_header != nullptr; }
+
+	// 슬롯이 다 찼으면 false
+	bool publish(const QString& symbol, const QuoteBoardQuote& quote);
+
+	int symbolCount() const { return m_slots.size(); }
+	int slotCount() const { return m_slotCount; }
+
+private:
+	QSharedMemory m_memory;
+	int m_slotCount;
+	QuoteBoardLayout::Header* m_header = nullptr;
+	QuoteBoardLayout::Slot* m_base = nullptr;
+	QHash<QString, int> m_slots;		// 심볼 -> 슬롯 번호
+	bool m_fullReported = false;
+
+	void initialize(quint32 generation);
+	int slotFor(const QString& symbol);
+};
@@ -0,0 +1,51 @@
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDateTime>
+#include <QTextStream>
+#include <QThread>
+#include "QuoteBoardReader.h"
+
+// stockflow_quoteboard_dump [--watch ms] [symbol...]
+int main(int argc, char* argv[])
+{
+	QCoreApplication app(argc, argv);
+
+	QCommandLineParser parser;
+	parser.setApplicationDescription("StockFlow 공유 메모리 시세판 출력");
+	parser.addHelpOption();
+	QCommandLineOption keyOption("key", "공유 메모리 키", "key", QuoteBoardLayout::DefaultKey);
+	QCommandLineOption watchOption("watch", "이 간격(ms)으로 계속 출력 (0 = 한 번)", "ms", "0");
+	parser.addOptions({ keyOption, watchOption });
+	parser.addPositionalArgument("symbols", "출력할 종목 (없으면 전체)");
+	parser.process(app);
+
+	QuoteBoardReader reader(parser.value(keyOption));
+	if (!reader.open())
+		return 1;
+
+	QTextStream out(stdout);
+	const int watchMs = parser.value(watchOption).toInt();
+	do
+	{
+		QStringList symbols = parser.positionalArguments();
+		if (symbols.isEmpty())
+			symbols = reader.symbols();
+
+		out << "-- " << QDateTime::currentDateTime().toString("hh:mm:ss.zzz")
+		    << "  갱신 " << reader.publishCount() << "  재시도 " << reader.retryCount() << "\n";
+		for (const QString& symbol : symbols)
+		{
+			QuoteBoardQuote quote;
+			if (!reader.read(symbol.toUpper(), quote)) continue;
+			out << qSetFieldWidth(10) << Qt::left << symbol << qSetFieldWidth(0)
+			    << quote.price << "  (전일 " << quote.prevClose << ", 거래량 " << quote.volume
+			    << ", " << QDateTime::fromMSecsSinceEpoch(quote.timestamp).toString("hh:mm:ss") << ")\n";
+		}
+		out.flush();
+
+		if (watchMs > 0)
+			QThread::msleep(static_cast<unsigned long>(watchMs));
+	} while (watchMs > 0);
+
+	return 0;
+}
@@ -0,0 +1,166 @@
+#include "DepthLadderWidget.h"
+#include <QPainter>
+#include <QPaintEvent>
+#include <QLocale>
+
+namespace
+{
+	constexpr int FrameIntervalMs = 16;	// 약 60fps
+	constexpr int TotalsHeight = 24;	// 맨 아래 총 잔량 줄
+	constexpr int Padding = 6;
+
+	// 국내 관례: 매도 파랑, 매수 빨강
+	const QColor AskBackground(235, 242, 255);
+	const QColor BidBackground(255, 238, 238);
+	const QColor AskBar(120, 160, 235);
+	const QColor BidBar(235, 130, 130);
+	const QColor PriceBackground(250, 250, 250);
+	const QColor GridColor(220, 220, 220);
+}
+
+DepthLadderWidget::DepthLadderWidget(const QString& symbol, const QString& name, QWidget* parent)
+	: QWidget(parent), m_symbol(symbol)
+{
+	setWindowTitle(QString("호가 - %1").arg(name.isEmpty() || name == symbol ? symbol : QString("%1 (%2)").arg(name, symbol)));
+	setMinimumSize(280, 20 * OrderBook::RowCount + TotalsHeight);
+	setAttribute(Qt::WA_OpaquePaintEvent);
+
+	m_repaintTimer = new QTimer(this);
+	m_repaintTimer->setSingleShot(true);
+	m_repaintTimer->setInterval(FrameIntervalMs);
+	connect(m_repaintTimer, &QTimer::timeout, this, &DepthLadderWidget::flushDirtyRows);
+}
+
+void DepthLadderWidget::applyOrderBook(const OrderBook& update)
+{
+	const quint32 changed = m_book.apply(update);
+	if (changed == 0) return;
+
+	// 막대 기준을 넘는 잔량이 오면 기준을 넉넉히 늘리고 모든 행을 다시 그림 (줄이지는 않음 -> 평소엔 바뀐 행만)
+	qint64 largest = 0;
+	for (int level = 0; level < OrderBook::Depth; ++level)
+		largest = qMax(largest, qMax(m_book.asks[level].quantity, m_book.bids[level].quantity));
+	if (largest > m_barScale)
+	{
+		m_barScale = largest + largest / 2;
+		m_dirtyRows = ~quint32(0);
+	}
+
+	m_dirtyRows |= changed;
+	if (!m_repaintTimer->isActive())
+		m_repaintTimer->start();
+}
+
+void DepthLadderWidget::flushDirtyRows()
+{
+	if (m_dirtyRows == ~quint32(0))
+	{
+		update();
+	}
+	else
+	{
+		for (int row = 0; row < OrderBook::RowCount; ++row)
+		{
+			if (m_dirtyRows & (quint32(1) << row))
+				update(rowRect(row));
+		}
+		if (m_dirtyRows & OrderBook::TotalsChanged)
+			update(totalsRect());
+	}
+	m_dirtyRows = 0;
+}
+
+int DepthLadderWidget::rowHeight() const
+{
+	return qMax(1, (height() - TotalsHeight) / OrderBook::RowCount);
+}
+
+QRect DepthLadderWidget::rowRect(int row) const
+{
+	return QRect(0, row * rowHeight(), width(), rowHeight());
+}
+
+QRect DepthLadderWidget::totalsRect() const
+{
+	const int top = OrderBook::RowCount * rowHeight();
+	return QRect(0, top, width(), height() - top);
+}
+
+void DepthLadderWidget::resizeEvent(QResizeEvent* event)
+{
+	QWidget::resizeEvent(event);
+	m_dirtyRows = 0;
+	update();
+}
+
+void DepthLadderWidget::paintEvent(QPaintEvent* event)
+{
+	QPainter painter(this);
+
+	// 다시 그릴 영역에 걸친 행만
+	const QRect dirty = event->rect();
+	const int rowH = rowHeight();
+	const int first = qBound(0, dirty.top() / rowH, OrderBook::RowCount);
+	const int last = qBound(0, dirty.bottom() / rowH, OrderBook::RowCount - 1);
+	for (int row = first; row <= last; ++row)
+		drawRow(painter, row);
+
+	if (dirty.intersects(totalsRect()))
+		drawTotals(painter);
+}
+
+void DepthLadderWidget::drawRow(QPainter& painter, int row) const
+{
+	const QRect rect = rowRect(row);
+	const bool ask = row < OrderBook::Depth;
+	const OrderBookLevel& level = m_book.row(row);
+
+	// 가운데 호가 열, 왼쪽 매도잔량, 오른쪽 매수잔량
+	const int columnWidth = rect.width() / 3;
+	const QRect askCell(rect.left(), rect.top(), columnWidth, rect.height());
+	const QRect priceCell(askCell.right() + 1, rect.top(), columnWidth, rect.height());
+	const QRect bidCell(priceCell.right() + 1, rect.top(), rect.width() - 2 * columnWidth, rect.height());
+
+	painter.fillRect(askCell, ask ? AskBackground : palette().base().color());
+	painter.fillRect(priceCell, PriceBackground);
+	painter.fillRect(bidCell, ask ? palette().base().color() : BidBackground);
+
+	const QLocale locale;
+	if (level.price > 0)
+	{
+		const QRect cell = ask ? askCell : bidCell;
+		if (m_barScale > 0 && level.quantity > 0)
+		{
+			// 잔량 막대: 매도는 가운데 쪽(오른쪽)에서, 매수는 가운데 쪽(왼쪽)에서 뻗어 나감
+			const int barWidth = static_cast<int>(cell.width() * qMin(1.0, double(level.quantity) / m_barScale));
+			const QRect bar(ask ? cell.right() - barWidth + 1 : cell.left(), cell.top() + 2, barWidth, cell.height() - 4);
+			painter.fillRect(bar, ask ? AskBar : BidBar);
+		}
+
+		painter.setPen(palette().text().color());
+		painter.drawText(cell.adjusted(Padding, 0, -Padding, 0), (ask ? Qt::AlignRight : Qt::AlignLeft) | Qt::AlignVCenter,
+			locale.toString(level.quantity));
+
+		painter.setPen(ask ? QColor(Qt::blue) : QColor(Qt::red));
+		painter.drawText(priceCell, Qt::AlignCenter, locale.toString(level.price, 'f', 0));
+	}
+
+	painter.setPen(GridColor);
+	painter.drawLine(rect.bottomLeft(), rect.bottomRight());
+}
+
+void DepthLadderWidget::drawTotals(QPainter& painter) const
+{
+	const QRect rect = totalsRect();
+	painter.fillRect(rect, palette().window().color());
+
+	const QLocale locale;
+	const int columnWidth = rect.width() / 3;
+	painter.setPen(palette().text().color());
+	painter.drawText(QRect(rect.left() + Padding, rect.top(), columnWidth - 2 * Padding, rect.height()),
+		Qt::AlignRight | Qt::AlignVCenter, locale.toString(m_book.totalAskQuantity));
+	painter.drawText(QRect(rect.left() + columnWidth, rect.top(), columnWidth, rect.height()),
+		Qt::AlignCenter, "총 잔량");
+	painter.drawText(QRect(rect.left() + 2 * columnWidth + Padding, rect.top(), rect.width() - 2 * columnWidth - 2 * Padding, rect.height()),
+		Qt::AlignLeft | Qt::AlignVCenter, locale.toString(m_book.totalBidQuantity));
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <QWidget>
+#include <QTimer>
+#include "core/OrderBook.h"
+
+// 10단계 호가 사다리 (매도잔량 | 호가 | 매수잔량)
+// 호가가 오면 OrderBook::apply로 바뀐 단계만 덮어쓰고 그 행만 다시 그림
+// 같은 프레임 안에 여러 번 와도 바뀐 행을 모아 프레임당 한 번만 그리므로 여러 종목이 동시에 움직여도 가벼움
+class DepthLadderWidget : public QWidget
+{
+	Q_OBJECT
+
+public:
+	explicit DepthLadderWidget(const QString& symbol, const QString& name, QWidget* parent = nullptr);
+
+	QString symbol() const { return m_symbol; }
+	const OrderBook& book() const { return m_book; }
+	QRect rowRect(int row) const;	// 사다리 행 영역 (OrderBook 행 번호)
+	QRect totalsRect() const;
+
+public slots:
+	void applyOrderBook(const OrderBook& update);
+
+protected:
+	void paintEvent(QPaintEvent* event) override;
+	void resizeEvent(QResizeEvent* event) override;
+
+private:
+	QString m_symbol;
+	OrderBook m_book;
+	quint32 m_dirtyRows = 0;	// 다음 프레임에 다시 그릴 행 (OrderBook::apply 비트)
+	qint64 m_barScale = 0;		// 잔량 막대 100% 기준 (넘으면 늘리고 전체를 다시 그림)
+	QTimer* m_repaintTimer;
+
+	int rowHeight() const;
+	void flushDirtyRows();
+	void drawRow(QPainter& painter, int row) const;
+	void drawTotals(QPainter& painter) const;
+};
@@ -0,0 +1,194 @@
+#include "MetricsPanel.h"
+#include "core/LatencyTracer.h"
+#include <QLabel>
+#include <QTreeWidget>
+#include <QHeaderView>
+#include <QPushButton>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QGridLayout>
+#include <QFileDialog>
+#include <QSaveFile>
+#include <QJsonDocument>
+#include <QSet>
+#include <QDebug>
+
+namespace
+{
+	enum TreeColumn { ColName = 0, ColCount, ColP50, ColP90, ColP99, ColMax, TreeColumnCount };
+
+	QString formatMs(qint64 micros)
+	{
+		return QString::number(micros / 1000.0, 'f', micros < 10000 ? 2 : 1);
+	}
+
+	void fillRow(QTreeWidgetItem* item, const QString& name, const LatencyHistogram& histogram)
+	{
+		item->setText(ColName, name);
+		item->setText(ColCount, QString::number(histogram.count()));
+		item->setText(ColP50, formatMs(histogram.percentile(50)));
+		item->setText(ColP90, formatMs(histogram.percentile(90)));
+		item->setText(ColP99, formatMs(histogram.percentile(99)));
+		item->setText(ColMax, formatMs(histogram.max()));
+		for (int c = ColCount; c < TreeColumnCount; ++c)
+			item->setTextAlignment(c, Qt::AlignRight | Qt::AlignVCenter);
+	}
+}
+
+MetricsPanel::MetricsPanel(QWidget* parent) : QDockWidget("지연 시간 (Latency)", parent)
+{
+	setObjectName("MetricsPanel");
+
+	QWidget* content = new QWidget(this);
+	QVBoxLayout* layout = new QVBoxLayout(content);
+
+	// 카운터
+	QGridLayout* counters = new QGridLayout();
+	m_inFlightLabel = new QLabel(content);
+	m_timeoutLabel = new QLabel(content);
+	m_errorLabel = new QLabel(content);
+	m_tickRateLabel = new QLabel(content);
+	m_unpaintedLabel = new QLabel(content);
+	m_conflatedLabel = new QLabel(content);
+	counters->addWidget(new QLabel("대기 중 요청", content), 0, 0);
+	counters->addWidget(m_inFlightLabel, 0, 1);
+	counters->addWidget(new QLabel("초당 틱", content), 0, 2);
+	counters->addWidget(m_tickRateLabel, 0, 3);
+	counters->addWidget(new QLabel("타임아웃", content), 1, 0);
+	counters->addWidget(m_timeoutLabel, 1, 1);
+	counters->addWidget(new QLabel("오류", content), 1, 2);
+	counters->addWidget(m_errorLabel, 1, 3);
+	counters->addWidget(new QLabel("미표시 만료", content), 2, 0);
+	counters->addWidget(m_unpaintedLabel, 2, 1);
+	counters->addWidget(new QLabel("병합된 틱", content), 2, 2);
+	counters->addWidget(m_conflatedLabel, 2, 3);
+	layout->addLayout(counters);
+
+	// 제공자/엔드포인트별 구간 지연 (ms)
+	m_tree = new QTreeWidget(content);
+	m_tree->setColumnCount(TreeColumnCount);
+	m_tree->setHeaderLabels({ "엔드포인트 / 구간", "건수", "p50", "p90", "p99", "max" });
+	m_tree->setRootIsDecorated(true);
+	m_tree->setUniformRowHeights(true);
+	m_tree->header()->setSectionResizeMode(ColName, QHeaderView::Stretch);
+	layout->addWidget(m_tree);
+
+	QHBoxLayout* buttons = new QHBoxLayout();
+	QPushButton* jsonButton = new QPushButton("JSON 내보내기", content);
+	QPushButton* traceButton = new QPushButton("Chrome Trace 내보내기", content);
+	QPushButton* resetButton = new QPushButton("초기화", content);
+	buttons->addWidget(jsonButton);
+	buttons->addWidget(traceButton);
+	buttons->addStretch();
+	buttons->addWidget(resetButton);
+	layout->addLayout(buttons);
+
+	setWidget(content);
+
+	connect(jsonButton, &QPushButton::clicked, this, &MetricsPanel::onExportJson);
+	connect(traceButton, &QPushButton::clicked, this, &MetricsPanel::onExportChromeTrace);
+	connect(resetButton, &QPushButton::clicked, this, &MetricsPanel::onReset);
+
+	// 숨겨져 있을 땐 갱신 안 함
+	m_refreshTimer = new QTimer(this);
+	m_refreshTimer->setInterval(1000);
+	connect(m_refreshTimer, &QTimer::timeout, this, &MetricsPanel::refresh);
+	connect(this, &QDockWidget::visibilityChanged, this, [this](bool visible)
+	{
+		if (visible)
+		{
+			refresh();
+			m_refreshTimer->start();
+		}
+		else
+		{
+			m_refreshTimer->stop();
+		}
+	});
+
+	m_rateTimer.start();
+	m_lastTicks = LatencyTracer::counters().ticks;
+}
+
+void MetricsPanel::refresh()
+{
+	const LatencyTracer::Counters& counters = LatencyTracer::counters();
+
+	// 직전 갱신 이후 반영된 틱 수 / 경과 시간
+	const qint64 elapsed = m_rateTimer.restart();
+	const quint64 ticks = counters.ticks >= m_lastTicks ? counters.ticks - m_lastTicks : counters.ticks;
+	const double tickRate = elapsed > 0 ? ticks * 1000.0 / elapsed : 0.0;
+	m_lastTicks = counters.ticks;
+
+	m_inFlightLabel->setText(QString::number(counters.inFlight));
+	m_timeoutLabel->setText(QString::number(counters.timeouts));
+	m_errorLabel->setText(QString::number(counters.errors));
+	m_unpaintedLabel->setText(QString::number(counters.unpainted));
+	m_conflatedLabel->setText(QString::number(counters.conflated));
+	m_tickRateLabel->setText(QString::number(tickRate, 'f', 1));
+
+	// 펼침 상태 유지
+	QSet<QString> expanded;
+	for (int i = 0; i < m_tree->topLevelItemCount(); ++i)
+	{
+		if (m_tree->topLevelItem(i)->isExpanded())
+			expanded.insert(m_tree->topLevelItem(i)->data(ColName, Qt::UserRole).toString());
+	}
+
+	m_tree->clear();
+	const QMap<QString, LatencyTracer::EndpointStats>& stats = LatencyTracer::endpointStats();
+	for (auto it = stats.cbegin(); it != stats.cend(); ++it)
+	{
+		const LatencyTracer::EndpointStats& endpoint = it.value();
+
+		// 상위 행 = 전체 구간, 하위 행 = 단계별
+		QTreeWidgetItem* top = new QTreeWidgetItem(m_tree);
+		QString title = QString("%1 %2").arg(endpoint.provider, endpoint.endpoint);
+		if (endpoint.errors > 0)
+			title += QString("  (오류 %1)").arg(endpoint.errors);
+		fillRow(top, title, endpoint.intervals[LatencyTracer::Total]);
+		top->setData(ColName, Qt::UserRole, it.key());
+
+		for (int i = 0; i < LatencyTracer::Total; ++i)
+		{
+			if (endpoint.intervals[i].count() == 0) continue;
+			fillRow(new QTreeWidgetItem(top), LatencyTracer::intervalName(i), endpoint.intervals[i]);
+		}
+		top->setExpanded(expanded.contains(it.key()));
+	}
+}
+
+void MetricsPanel::onExportJson()
+{
+	saveJson(LatencyTracer::toJson(), "지연 통계 저장", "latency.json");
+}
+
+void MetricsPanel::onExportChromeTrace()
+{
+	// chrome://tracing 또는 ui.perfetto.dev 에서 열기
+	saveJson(LatencyTracer::toChromeTrace(), "Chrome Trace 저장", "latency-trace.json");
+}
+
+void MetricsPanel::onReset()
+{
+	LatencyTracer::reset();
+	m_lastTicks = 0;
+	m_rateTimer.restart();
+	refresh();
+}
+
+void MetricsPanel::saveJson(const QJsonObject& json, const QString& title, const QString& defaultName)
+{
+	QString path = QFileDialog::getSaveFileName(this, title, defaultName, "JSON (*.json)");
+	if (path.isEmpty()) return;
+
+	QSaveFile file(path);
+	if (!file.open(QIODevice::WriteOnly))
+	{
+		qDebug() << "[MetricsPanel] 파일 열기 실패:" << path;
+		return;
+	}
+	file.write(QJsonDocument(json).toJson(QJsonDocument::Compact));
+	if (!file.commit())
+		qDebug() << "[MetricsPanel] 저장 실패:" << path;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <QDockWidget>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QJsonObject>
+
+class QLabel;
+class QTreeWidget;
+
+// 지연 추적 결과 패널 (LatencyTracer)
+// 보이는 동안만 1초마다 갱신
+class MetricsPanel : public QDockWidget
+{
+	Q_OBJECT
+
+public:
+	explicit MetricsPanel(QWidget* parent = nullptr);
+
+public slots:
+	void refresh();
+
+private slots:
+	void onExportJson();
+	void onExportChromeTrace();
+	void onReset();
+
+private:
+	QLabel* m_inFlightLabel;
+	QLabel* m_timeoutLabel;
+	QLabel* m_errorLabel;
+	QLabel* m_tickRateLabel;
+	QLabel* m_unpaintedLabel;
+	QLabel* m_conflatedLabel;
+	QTreeWidget* m_tree;
+	QTimer* m_refreshTimer;
+
+	// 초당 틱 계산용 (직전 갱신 시점의 누적값)
+	QElapsedTimer m_rateTimer;
+	quint64 m_lastTicks = 0;
+
+	void saveJson(const QJsonObject& json, const QString& title, const QString& defaultName);
+};
@@ -0,0 +1,180 @@
+#include "PortfolioPanel.h"
+#include "PortfolioTableModel.h"
+#include <QLabel>
+#include <QTableView>
+#include <QHeaderView>
+#include <QDoubleSpinBox>
+#include <QPushButton>
+#include <QVBoxLayout>
+#include <QHBoxLayout>
+#include <QFormLayout>
+#include <QDialog>
+#include <QDialogButtonBox>
+#include <QLineEdit>
+#include <QComboBox>
+#include <QMessageBox>
+#include <QMenu>
+
+namespace
+{
+	QString totalsText(const QString& title, const PortfolioTotals& totals, const QString& currency)
+	{
+		const double unrealized = totals.unrealizedPnl();
+		const double rate = totals.costBasis > 0 ? unrealized / totals.costBasis * 100.0 : 0.0;
+		return QString("%1  평가 %2  손익 %3 (%4%5%)  실현 %6")
+			.arg(title,
+				PortfolioTableModel::formatMoney(totals.marketValue, currency),
+				PortfolioTableModel::formatMoney(unrealized, currency),
+				rate > 0 ? "+" : "")
+			.arg(rate, 0, 'f', 2)
+			.arg(PortfolioTableModel::formatMoney(totals.realizedPnl, currency));
+	}
+}
+
+PortfolioPanel::PortfolioPanel(Portfolio* portfolio, QWidget* parent)
+	: QDockWidget("포트폴리오", parent), m_portfolio(portfolio)
+{
+	setObjectName("PortfolioPanel");
+
+	QWidget* content = new QWidget(this);
+	QVBoxLayout* layout = new QVBoxLayout(content);
+
+	m_model = new PortfolioTableModel(m_portfolio, this);
+	m_table = new QTableView(content);
+	m_table->setModel(m_model);
+	m_table->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+	m_table->verticalHeader()->hide();
+	m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
+	m_table->setContextMenuPolicy(Qt::CustomContextMenu);
+	layout->addWidget(m_table);
+
+	m_usdLabel = new QLabel(content);
+	m_krwLabel = new QLabel(content);
+	m_totalLabel = new QLabel(content);
+	QFont bold = m_totalLabel->font();
+	bold.setBold(true);
+	m_totalLabel->setFont(bold);
+	layout->addWidget(m_usdLabel);
+	layout->addWidget(m_krwLabel);
+	layout->addWidget(m_totalLabel);
+
+	// 환율 (서버에서 받으면 자동 갱신, 직접 고칠 수도 있음)
+	QHBoxLayout* bottom = new QHBoxLayout();
+	m_fxSpin = new QDoubleSpinBox(content);
+	m_fxSpin->setRange(1.0, 100000.0);
+	m_fxSpin->setDecimals(2);
+	m_fxSpin->setSuffix(" 원/$");
+	m_fxSpin->setValue(m_portfolio->usdKrw());
+	QPushButton* tradeButton = new QPushButton("매매 기록...", content);
+	bottom->addWidget(new QLabel("USD/KRW", content));
+	bottom->addWidget(m_fxSpin);
+	bottom->addStretch();
+	bottom->addWidget(tradeButton);
+	layout->addLayout(bottom);
+
+	setWidget(content);
+
+	m_totalsTimer = new QTimer(this);
+	m_totalsTimer->setSingleShot(true);
+	m_totalsTimer->setInterval(200);
+	connect(m_totalsTimer, &QTimer::timeout, this, &PortfolioPanel::refreshTotals);
+	connect(m_portfolio, &Portfolio::totalsChanged, this, [this]()
+	{
+		if (!m_totalsTimer->isActive())
+			m_totalsTimer->start();
+	});
+
+	connect(m_fxSpin, &QDoubleSpinBox::valueChanged, m_portfolio, &Portfolio::setUsdKrw);
+	connect(tradeButton, &QPushButton::clicked, this, [this]() { recordTrade(); });
+	connect(m_table, &QTableView::customContextMenuRequested, this, &PortfolioPanel::onContextMenu);
+
+	refreshTotals();
+}
+
+void PortfolioPanel::refreshTotals()
+{
+	// 외부(서버)에서 바뀐 환율을 스핀박스에 반영 (다시 setUsdKrw가 불려도 같은 값이라 무시됨)
+	if (!m_fxSpin->hasFocus() && !qFuzzyCompare(m_fxSpin->value(), m_portfolio->usdKrw()))
+		m_fxSpin->setValue(m_portfolio->usdKrw());
+
+	m_usdLabel->setText(totalsText("미국 (USD)", m_portfolio->totals("USD"), "USD"));
+	m_krwLabel->setText(totalsText("국내 (KRW)", m_portfolio->totals("KRW"), "KRW"));
+	m_totalLabel->setText(totalsText("합계 (원화 환산)", m_portfolio->totalsInKrw(), "KRW"));
+}
+
+void PortfolioPanel::onContextMenu(const QPoint& pos)
+{
+	QModelIndex index = m_table->indexAt(pos);
+
+	QMenu menu(this);
+	QAction* tradeAction = menu.addAction("매매 기록...");
+	QAction* removeAction = nullptr;
+	QString symbol;
+	double price = 0.0;
+	if (index.isValid())
+	{
+		const Position& position = m_portfolio->at(index.row());
+		symbol = position.symbol;
+		price = position.markPrice();
+		removeAction = menu.addAction(QString("%1 삭제").arg(symbol));
+	}
+
+	QAction* selected = menu.exec(m_table->viewport()->mapToGlobal(pos));
+	if (selected == nullptr) return;
+
+	if (selected == tradeAction)
+	{
+		recordTrade(symbol, price);
+	}
+	else if (selected == removeAction)
+	{
+		if (QMessageBox::question(this, "포트폴리오", symbol + " 보유 기록을 삭제할까요?") != QMessageBox::Yes)
+			return;
+		m_portfolio->removePosition(symbol);
+		emit portfolioEdited();
+	}
+}
+
+void PortfolioPanel::recordTrade(const QString& symbol, double price)
+{
+	QDialog dialog(this);
+	dialog.setWindowTitle("매매 기록");
+
+	QLineEdit* symbolEdit = new QLineEdit(symbol, &dialog);
+	QComboBox* sideCombo = new QComboBox(&dialog);
+	sideCombo->addItems({ "매수", "매도" });
+	QDoubleSpinBox* quantitySpin = new QDoubleSpinBox(&dialog);
+	quantitySpin->setRange(0.0001, 1e9);
+	quantitySpin->setDecimals(4);
+	quantitySpin->setValue(1);
+	QDoubleSpinBox* priceSpin = new QDoubleSpinBox(&dialog);
+	priceSpin->setRange(0.0, 1e12);
+	priceSpin->setDecimals(2);
+	priceSpin->setValue(price);
+	QDoubleSpinBox* feeSpin = new QDoubleSpinBox(&dialog);
+	feeSpin->setRange(0.0, 1e9);
+	feeSpin->setDecimals(2);
+
+	QFormLayout* form = new QFormLayout(&dialog);
+	form->addRow("종목코드", symbolEdit);
+	form->addRow("구분", sideCombo);
+	form->addRow("수량", quantitySpin);
+	form->addRow("체결가", priceSpin);
+	form->addRow("수수료", feeSpin);
+
+	QDialogButtonBox* buttons = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel, &dialog);
+	form->addRow(buttons);
+	connect(buttons, &QDialogButtonBox::accepted, &dialog, &QDialog::accept);
+	connect(buttons, &QDialogButtonBox::rejected, &dialog, &QDialog::reject);
+
+	if (dialog.exec() != QDialog::Accepted) return;
+
+	const QString code = symbolEdit->text().trimmed().toUpper();
+	const double quantity = sideCombo->currentIndex() == 0 ? quantitySpin->value() : -quantitySpin->value();
+	if (!m_portfolio->addTrade(code, quantity, priceSpin->value(), feeSpin->value()))
+	{
+		QMessageBox::warning(this, "매매 기록", "기록할 수 없습니다. (종목코드/가격 확인, 보유 수량보다 많이 매도)");
+		return;
+	}
+	emit portfolioEdited();
+}
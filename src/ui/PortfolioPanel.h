@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QDockWidget>
+#include <QTimer>
+#include "core/Portfolio.h"
+
+class QLabel;
+class QTableView;
+class QDoubleSpinBox;
+class PortfolioTableModel;
+
+// 포트폴리오 패널 (보유 종목 + 통화별/원화 환산 합계)
+class PortfolioPanel : public QDockWidget
+{
+	Q_OBJECT
+
+public:
+	explicit PortfolioPanel(Portfolio* portfolio, QWidget* parent = nullptr);
+
+	// 매매 기록 창 (심볼/가격 미리 채움)
+	void recordTrade(const QString& symbol = QString(), double price = 0.0);
+
+signals:
+	void portfolioEdited();		// 매매 기록/삭제 (저장 시점)
+
+private slots:
+	void refreshTotals();
+	void onContextMenu(const QPoint& pos);
+
+private:
+	Portfolio* m_portfolio;
+	PortfolioTableModel* m_model;
+	QTableView* m_table;
+	QLabel* m_usdLabel;
+	QLabel* m_krwLabel;
+	QLabel* m_totalLabel;
+	QDoubleSpinBox* m_fxSpin;
+	QTimer* m_totalsTimer;		// 틱마다 합계 글자를 다시 쓰지 않도록 묶음
+};
@@ -0,0 +1,106 @@
+#include "PortfolioTableModel.h"
+#include "core/StockCodeMap.h"
+#include <QColor>
+#include <QLocale>
+
+PortfolioTableModel::PortfolioTableModel(Portfolio* portfolio, QObject* parent)
+	: QAbstractTableModel(parent), m_portfolio(portfolio)
+{
+	connect(m_portfolio, &Portfolio::positionsReset, this, [this]()
+	{
+		beginResetModel();
+		endResetModel();
+	});
+	connect(m_portfolio, &Portfolio::positionChanged, this, [this](int row)
+	{
+		emit dataChanged(index(row, Quantity), index(row, ColumnCount - 1));
+	});
+}
+
+int PortfolioTableModel::rowCount(const QModelIndex& parent) const
+{
+	if (parent.isValid()) return 0;
+	return m_portfolio->count();
+}
+
+int PortfolioTableModel::columnCount(const QModelIndex& parent) const
+{
+	if (parent.isValid()) return 0;
+	return ColumnCount;
+}
+
+QVariant PortfolioTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+	if (orientation != Qt::Horizontal || role != Qt::DisplayRole) return QVariant();
+
+	switch (section)
+	{
+	case Name:        return "종목";
+	case Quantity:    return "수량";
+	case AvgCost:     return "평균단가";
+	case Price:       return "현재가";
+	case MarketValue: return "평가금액";
+	case Unrealized:  return "평가손익";
+	case ReturnRate:  return "수익률";
+	case Realized:    return "실현손익";
+	default:          return QVariant();
+	}
+}
+
+QVariant PortfolioTableModel::data(const QModelIndex& index, int role) const
+{
+	if (!index.isValid() || index.row() >= m_portfolio->count())
+		return QVariant();
+
+	const Position& position = m_portfolio->at(index.row());
+	const double unrealized = position.unrealizedPnl();
+
+	if (role == Qt::DisplayRole)
+	{
+		switch (index.column())
+		{
+		case Name:
+		{
+			QString name = StockCodeMap::getName(position.symbol);
+			return (name.isEmpty() || name == position.symbol) ? position.symbol : name;
+		}
+		case Quantity:    return QLocale::system().toString(position.quantity, 'f', position.quantity == (long long)position.quantity ? 0 : 4);
+		case AvgCost:     return formatMoney(position.avgCost, position.currency);
+		case Price:       return formatMoney(position.markPrice(), position.currency);
+		case MarketValue: return formatMoney(position.marketValue(), position.currency);
+		case Unrealized:  return formatMoney(unrealized, position.currency);
+		case ReturnRate:
+		{
+			const double cost = position.costBasis();
+			if (cost <= 0) return "-";
+			const double rate = unrealized / cost * 100.0;
+			return QString("%1%2%").arg(rate > 0 ? "+" : "").arg(rate, 0, 'f', 2);
+		}
+		case Realized:    return formatMoney(position.realizedPnl, position.currency);
+		}
+	}
+	else if (role == Qt::ForegroundRole)
+	{
+		// 손익 색 (상승 빨강 / 하락 파랑)
+		double value = 0.0;
+		if (index.column() == Unrealized || index.column() == ReturnRate) value = unrealized;
+		else if (index.column() == Realized) value = position.realizedPnl;
+		if (value > 0) return QColor(Qt::red);
+		if (value < 0) return QColor(Qt::blue);
+	}
+	else if (role == Qt::TextAlignmentRole)
+	{
+		if (index.column() == Name) return Qt::AlignCenter;
+		return int(Qt::AlignRight | Qt::AlignVCenter);
+	}
+
+	return QVariant();
+}
+
+QString PortfolioTableModel::formatMoney(double value, const QString& currency)
+{
+	// 원화는 소수점 없이, 달러는 센트까지
+	if (currency == "KRW")
+		return QLocale::system().toString(value, 'f', 0) + "원";
+	return "$" + QLocale::system().toString(value, 'f', 2);
+}
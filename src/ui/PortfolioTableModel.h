@@ -0,0 +1,37 @@
+#pragma once
+
+#include <QAbstractTableModel>
+#include "core/Portfolio.h"
+
+// Portfolio 보유 종목 표
+// 시세가 오면 바뀐 행 하나만 갱신 알림
+class PortfolioTableModel : public QAbstractTableModel
+{
+	Q_OBJECT
+
+public:
+	explicit PortfolioTableModel(Portfolio* portfolio, QObject* parent = nullptr);
+
+	int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+	int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+	QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+	QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+	enum Column
+	{
+		Name = 0,
+		Quantity,
+		AvgCost,
+		Price,
+		MarketValue,
+		Unrealized,
+		ReturnRate,
+		Realized,
+		ColumnCount
+	};
+
+	static QString formatMoney(double value, const QString& currency);
+
+private:
+	Portfolio* m_portfolio;
+};
@@ -0,0 +1,424 @@
+#include "PriceChartWidget.h"
+#include "core/TickHistory.h"
+#include <QPainter>
+#include <QPainterPath>
+#include <QWheelEvent>
+#include <QMouseEvent>
+#include <QDateTime>
+#include <QLocale>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+	constexpr int FrameIntervalMs = 16;	// 약 60fps
+	constexpr qint64 MinViewSpanMs = 1000;
+	constexpr int MarginLeft = 10;
+	constexpr int MarginRight = 70;		// 가격 축
+	constexpr int MarginTop = 10;
+	constexpr int MarginBottom = 24;	// 시간 축
+
+	// 오버레이 색 (순서대로 돌려 씀)
+	const QColor OverlayColors[] = {
+		QColor(255, 140, 0), QColor(0, 150, 136), QColor(156, 39, 176), QColor(121, 85, 72), QColor(96, 125, 139)
+	};
+
+	// 보이는 시간 구간 앞뒤로 한 점씩 더 (선이 화면 끝까지 이어지게)
+	std::pair<size_t, size_t> visibleRange(const std::vector<SeriesPoint>& points, qint64 from, qint64 to)
+	{
+		auto byTime = [](const SeriesPoint& p, qint64 t) { return p.time < t; };
+		size_t begin = std::lower_bound(points.begin(), points.end(), from, byTime) - points.begin();
+		size_t end = std::lower_bound(points.begin(), points.end(), to, byTime) - points.begin();
+		if (begin > 0) --begin;
+		if (end < points.size()) ++end;
+		return { begin, end };
+	}
+}
+
+PriceChartWidget::PriceChartWidget(const QString& symbol, const QString& name, QWidget* parent)
+	: QWidget(parent), m_symbol(symbol)
+{
+	setWindowTitle(name.isEmpty() || name == symbol ? symbol : QString("%1 (%2)").arg(name, symbol));
+	setMinimumSize(480, 280);
+	setMouseTracking(false);
+	setAttribute(Qt::WA_OpaquePaintEvent);
+
+	m_repaintTimer = new QTimer(this);
+	m_repaintTimer->setSingleShot(true);
+	m_repaintTimer->setInterval(FrameIntervalMs);
+	connect(m_repaintTimer, &QTimer::timeout, this, qOverload<>(&QWidget::update));
+}
+
+void PriceChartWidget::loadHistory(const TickHistory& history)
+{
+	for (int i = 0; i < history.size(); ++i)
+	{
+		const Tick& tick = history.at(i);
+		m_series.append(tick.timestamp, tick.price);
+	}
+	fitAll();
+	update();
+}
+
+void PriceChartWidget::loadCandles(const QVector<Candle>& candles, CandleResolution resolution)
+{
+	if (candles.isEmpty()) return;
+
+	m_bars = candles;
+	m_barMs = CandleUtils::durationMs(resolution);
+	m_lastBarOpen = QDateTime::currentMSecsSinceEpoch() < candles.last().time + m_barMs;
+	rebuildOverlays();
+
+	// 봉은 이미 쌓인 틱보다 과거이므로 앞에 끼워넣고 다시 구성
+	PriceSeries ticks = m_series;
+	const qint64 firstTick = ticks.isEmpty() ? std::numeric_limits<qint64>::max() : ticks.firstTime();
+
+	m_series.clear();
+	for (const Candle& candle : candles)
+	{
+		if (candle.time >= firstTick) break;
+		m_series.append(candle.time, candle.close);
+	}
+	for (int i = 0; i < ticks.size(); ++i)
+		m_series.append(ticks.timeAt(i), ticks.valueAt(i));
+
+	fitAll();
+	update();
+}
+
+void PriceChartWidget::appendTick(const StockData& data)
+{
+	if (data.symbol != m_symbol || data.currentPrice <= 0) return;
+
+	m_series.append(data.timestamp, data.currentPrice);
+	updateLiveOverlays(data);
+
+	if (m_followLatest)
+	{
+		// 보이는 폭은 유지한 채 오른쪽 끝만 이동
+		qint64 span = qMax(m_viewTo - m_viewFrom, MinViewSpanMs);
+		m_viewTo = m_series.lastTime();
+		m_viewFrom = (m_series.size() > 1) ? qMax(m_viewTo - span, m_series.firstTime()) : m_viewTo - span;
+	}
+
+	scheduleRepaint();
+}
+
+void PriceChartWidget::setOverlays(const QVector<IndicatorSpec>& specs)
+{
+	m_overlays.clear();
+	for (const IndicatorSpec& spec : specs)
+	{
+		if (!spec.isPriceScale()) continue;
+
+		Overlay overlay;
+		overlay.spec = spec;
+		overlay.color = OverlayColors[m_overlays.size() % std::size(OverlayColors)];
+		overlay.state = IndicatorState(spec);
+		m_overlays.push_back(overlay);
+	}
+	rebuildOverlays();
+	update();
+}
+
+void PriceChartWidget::rebuildOverlays()
+{
+	// 확정 봉 (마지막 봉이 진행 중이면 제외)
+	QVector<Candle> closed = m_bars;
+	if (m_lastBarOpen && !closed.isEmpty())
+		closed.removeLast();
+
+	for (Overlay& overlay : m_overlays)
+	{
+		// 과거 구간 전체는 배열 커널로
+		const std::vector<double> values = IndicatorKernels::compute(overlay.spec, m_bars);
+		overlay.points.clear();
+		overlay.points.reserve(values.size());
+		for (qsizetype i = 0; i < m_bars.size(); ++i)
+		{
+			if (!std::isnan(values[i]))
+				overlay.points.push_back({ m_bars[i].time, values[i] });
+		}
+		overlay.hasLive = m_lastBarOpen && !values.empty() && !std::isnan(values.back());
+
+		// 이후 틱은 누적 상태로 이어서 계산
+		overlay.state.seed(closed);
+	}
+}
+
+void PriceChartWidget::updateLiveOverlays(const StockData& data)
+{
+	if (m_overlays.empty() || m_bars.isEmpty() || m_barMs <= 0) return;
+
+	Candle& last = m_bars.last();
+	if (data.timestamp >= last.time + m_barMs)
+	{
+		// 봉이 넘어감: 진행 중이던 봉 확정 후 새 봉 시작
+		if (m_lastBarOpen)
+		{
+			for (Overlay& overlay : m_overlays)
+				overlay.state.push(last);
+		}
+
+		Candle bar;
+		bar.time = last.time + (data.timestamp - last.time) / m_barMs * m_barMs;
+		bar.open = data.openPrice > 0 ? data.openPrice : data.currentPrice;
+		m_bars.append(bar);
+		m_lastBarOpen = true;
+		for (Overlay& overlay : m_overlays)
+			overlay.hasLive = false;
+	}
+	else if (!m_lastBarOpen)
+	{
+		return;	// 이미 끝난 봉 구간의 늦은 틱
+	}
+
+	// 시세의 고/저/누적거래량 = 오늘 봉
+	Candle& bar = m_bars.last();
+	bar.close = data.currentPrice;
+	bar.high = data.highPrice > 0 ? data.highPrice : qMax(bar.high, data.currentPrice);
+	bar.low = data.lowPrice > 0 ? data.lowPrice : (bar.low > 0 ? qMin(bar.low, data.currentPrice) : data.currentPrice);
+	bar.volume = data.volume;
+
+	for (Overlay& overlay : m_overlays)
+	{
+		const double value = overlay.state.valueWith(bar);
+		if (std::isnan(value)) continue;
+
+		// 오늘 봉 값은 마지막 틱 시각에 찍어서 가격선 끝과 맞춤
+		const SeriesPoint point{ data.timestamp, value };
+		if (overlay.hasLive && !overlay.points.empty())
+			overlay.points.back() = point;
+		else
+			overlay.points.push_back(point);
+		overlay.hasLive = true;
+	}
+}
+
+void PriceChartWidget::overlayRange(double& minValue, double& maxValue) const
+{
+	for (const Overlay& overlay : m_overlays)
+	{
+		auto [begin, end] = visibleRange(overlay.points, m_viewFrom, m_viewTo);
+		for (size_t i = begin; i < end; ++i)
+		{
+			const SeriesPoint& p = overlay.points[i];
+			if (p.time < m_viewFrom || p.time > m_viewTo) continue;
+			minValue = qMin(minValue, p.value);
+			maxValue = qMax(maxValue, p.value);
+		}
+	}
+}
+
+void PriceChartWidget::drawOverlays(QPainter& painter, const QRect& plot, const std::function<QPointF(const SeriesPoint&)>& toPoint) const
+{
+	if (m_overlays.empty()) return;
+
+	painter.save();
+	painter.setClipRect(plot);
+	painter.setRenderHint(QPainter::Antialiasing);
+	for (const Overlay& overlay : m_overlays)
+	{
+		auto [begin, end] = visibleRange(overlay.points, m_viewFrom, m_viewTo);
+		if (end - begin < 2) continue;
+
+		QPolygonF line;
+		line.reserve(static_cast<int>(end - begin));
+		for (size_t i = begin; i < end; ++i)
+			line << toPoint(overlay.points[i]);
+
+		painter.setPen(QPen(overlay.color, 1.0));
+		painter.drawPolyline(line);
+	}
+	painter.restore();
+
+	// 범례
+	int x = plot.left() + 6;
+	for (const Overlay& overlay : m_overlays)
+	{
+		const QString label = overlay.spec.toString();
+		painter.setPen(overlay.color);
+		painter.drawText(QPoint(x, plot.top() + 14), label);
+		x += fontMetrics().horizontalAdvance(label) + 10;
+	}
+}
+
+void PriceChartWidget::scheduleRepaint()
+{
+	if (!m_repaintTimer->isActive())
+		m_repaintTimer->start();
+}
+
+void PriceChartWidget::fitAll()
+{
+	m_followLatest = true;
+	if (m_series.isEmpty())
+	{
+		m_viewFrom = m_viewTo = 0;
+		return;
+	}
+
+	m_viewFrom = m_series.firstTime();
+	m_viewTo = qMax(m_series.lastTime(), m_viewFrom + MinViewSpanMs);
+}
+
+QRect PriceChartWidget::plotRect() const
+{
+	return rect().adjusted(MarginLeft, MarginTop, -MarginRight, -MarginBottom);
+}
+
+void PriceChartWidget::paintEvent(QPaintEvent*)
+{
+	QPainter painter(this);
+	painter.fillRect(rect(), palette().base());
+
+	const QRect plot = plotRect();
+	painter.setPen(palette().mid().color());
+	painter.drawRect(plot);
+
+	std::vector<SeriesPoint> points = m_series.visiblePoints(m_viewFrom, m_viewTo, plot.width());
+	if (points.size() < 2)
+	{
+		painter.setPen(palette().text().color());
+		painter.drawText(plot, Qt::AlignCenter, "데이터 수신 대기 중...");
+		return;
+	}
+
+	// 보이는 점들로 세로 범위 결정
+	double minValue = points.front().value;
+	double maxValue = minValue;
+	for (const SeriesPoint& p : points)
+	{
+		minValue = qMin(minValue, p.value);
+		maxValue = qMax(maxValue, p.value);
+	}
+	overlayRange(minValue, maxValue);
+	if (maxValue - minValue < 1e-9)
+	{
+		minValue -= 1.0;
+		maxValue += 1.0;
+	}
+	const double pad = (maxValue - minValue) * 0.05;
+	minValue -= pad;
+	maxValue += pad;
+
+	const double span = static_cast<double>(qMax(m_viewTo - m_viewFrom, qint64(1)));
+	auto toPoint = [&](const SeriesPoint& p)
+	{
+		double x = plot.left() + (p.time - m_viewFrom) / span * plot.width();
+		double y = plot.bottom() - (p.value - minValue) / (maxValue - minValue) * plot.height();
+		return QPointF(x, y);
+	};
+
+	QPolygonF line;
+	line.reserve(static_cast<int>(points.size()));
+	for (const SeriesPoint& p : points)
+		line << toPoint(p);
+
+	const bool up = points.back().value >= points.front().value;
+	const QColor lineColor = up ? QColor(Qt::red) : QColor(Qt::blue);
+
+	painter.save();
+	painter.setClipRect(plot);
+	painter.setRenderHint(QPainter::Antialiasing);
+	painter.setPen(QPen(lineColor, 1.5));
+	painter.drawPolyline(line);
+	painter.restore();
+
+	drawOverlays(painter, plot, toPoint);
+
+	// 가격 축 (최고/최저/마지막)
+	QLocale locale = QLocale::system();
+	auto priceText = [&](double value)
+	{
+		return locale.toString(value, 'f', (value >= 1000) ? 0 : 2);
+	};
+
+	painter.setPen(palette().text().color());
+	const int axisX = plot.right() + 6;
+	painter.drawText(QPoint(axisX, plot.top() + 10), priceText(maxValue - pad));
+	painter.drawText(QPoint(axisX, plot.bottom()), priceText(minValue + pad));
+
+	QPointF lastPoint = toPoint({ m_series.lastTime(), m_series.lastValue() });
+	if (plot.contains(lastPoint.toPoint()))
+	{
+		painter.setPen(QPen(lineColor, 1, Qt::DashLine));
+		painter.drawLine(QPointF(plot.left(), lastPoint.y()), QPointF(plot.right(), lastPoint.y()));
+		painter.setPen(lineColor);
+		painter.drawText(QPointF(axisX, lastPoint.y() + 4), priceText(m_series.lastValue()));
+	}
+
+	// 시간 축 (하루 넘게 보이면 날짜로)
+	const QString timeFormat = (m_viewTo - m_viewFrom > 24LL * 60 * 60 * 1000) ? "yyyy-MM-dd" : "HH:mm:ss";
+	painter.setPen(palette().text().color());
+	const int axisY = plot.bottom() + 16;
+	painter.drawText(QPoint(plot.left(), axisY),
+		QDateTime::fromMSecsSinceEpoch(m_viewFrom).toString(timeFormat));
+	const QString rightLabel = QDateTime::fromMSecsSinceEpoch(m_viewTo).toString(timeFormat);
+	painter.drawText(QPoint(plot.right() - fontMetrics().horizontalAdvance(rightLabel), axisY), rightLabel);
+}
+
+void PriceChartWidget::wheelEvent(QWheelEvent* event)
+{
+	if (m_series.isEmpty()) return;
+
+	const QRect plot = plotRect();
+	const double ratio = qBound(0.0, (event->position().x() - plot.left()) / qMax(plot.width(), 1), 1.0);
+	const qint64 span = m_viewTo - m_viewFrom;
+	const qint64 anchor = m_viewFrom + static_cast<qint64>(span * ratio);
+
+	// 휠 한 칸(120)마다 20%씩 확대/축소
+	const double factor = std::pow(0.8, event->angleDelta().y() / 120.0);
+	const qint64 fullSpan = qMax(m_series.lastTime() - m_series.firstTime(), MinViewSpanMs);
+	const qint64 newSpan = qBound(MinViewSpanMs, static_cast<qint64>(span * factor), fullSpan * 2);
+
+	m_viewFrom = anchor - static_cast<qint64>(newSpan * ratio);
+	m_viewTo = m_viewFrom + newSpan;
+	m_followLatest = (m_viewTo >= m_series.lastTime());
+
+	update();
+	event->accept();
+}
+
+void PriceChartWidget::mousePressEvent(QMouseEvent* event)
+{
+	if (event->button() != Qt::LeftButton) return;
+
+	m_dragging = true;
+	m_dragStart = event->position().toPoint();
+	m_dragFrom = m_viewFrom;
+	m_dragTo = m_viewTo;
+	setCursor(Qt::ClosedHandCursor);
+}
+
+void PriceChartWidget::mouseMoveEvent(QMouseEvent* event)
+{
+	if (!m_dragging) return;
+
+	const QRect plot = plotRect();
+	const double msPerPixel = static_cast<double>(m_dragTo - m_dragFrom) / qMax(plot.width(), 1);
+	const qint64 shift = static_cast<qint64>((m_dragStart.x() - event->position().x()) * msPerPixel);
+
+	m_viewFrom = m_dragFrom + shift;
+	m_viewTo = m_dragTo + shift;
+	m_followLatest = (m_viewTo >= m_series.lastTime());
+
+	update();
+}
+
+void PriceChartWidget::mouseReleaseEvent(QMouseEvent* event)
+{
+	if (event->button() != Qt::LeftButton) return;
+
+	m_dragging = false;
+	unsetCursor();
+}
+
+void PriceChartWidget::mouseDoubleClickEvent(QMouseEvent*)
+{
+	// 더블클릭하면 전체 보기로 복귀
+	fitAll();
+	update();
+}
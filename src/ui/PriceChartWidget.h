@@ -0,0 +1,79 @@
+#pragma once
+
+#include <QWidget>
+#include <QTimer>
+#include <QColor>
+#include "core/PriceSeries.h"
+#include "core/StockData.h"
+#include "core/Candle.h"
+#include "core/Indicators.h"
+#include <vector>
+#include <functional>
+
+class TickHistory;
+
+// 종목 가격 차트
+// 화면 폭만큼만 점을 뽑아서 그리므로 틱이 많아도 팬/줌이 가벼움
+class PriceChartWidget : public QWidget
+{
+	Q_OBJECT
+
+public:
+	explicit PriceChartWidget(const QString& symbol, const QString& name, QWidget* parent = nullptr);
+
+	QString symbol() const { return m_symbol; }
+
+	void loadHistory(const TickHistory& history);
+	void loadCandles(const QVector<Candle>& candles, CandleResolution resolution = CandleResolution::Day);
+	void appendTick(const StockData& data);
+
+	// 가격 축 지표 겹쳐 그리기 (RSI 같은 별도 축 지표는 무시)
+	void setOverlays(const QVector<IndicatorSpec>& specs);
+
+protected:
+	void paintEvent(QPaintEvent* event) override;
+	void wheelEvent(QWheelEvent* event) override;
+	void mousePressEvent(QMouseEvent* event) override;
+	void mouseMoveEvent(QMouseEvent* event) override;
+	void mouseReleaseEvent(QMouseEvent* event) override;
+	void mouseDoubleClickEvent(QMouseEvent* event) override;
+
+private:
+	QString m_symbol;
+	PriceSeries m_series;
+
+	// 보이는 시간 구간 (epoch ms)
+	qint64 m_viewFrom = 0;
+	qint64 m_viewTo = 0;
+	bool m_followLatest = true;	// 새 틱이 오면 오른쪽 끝을 따라감
+
+	bool m_dragging = false;
+	QPoint m_dragStart;
+	qint64 m_dragFrom = 0;
+	qint64 m_dragTo = 0;
+
+	QTimer* m_repaintTimer;		// 틱 폭주 시 다시 그리기를 프레임 단위로 묶음
+
+	// 지표 오버레이 (일봉 기준). 과거 구간은 배열 커널로 한 번에, 오늘 봉은 틱마다 O(1)로 갱신
+	struct Overlay
+	{
+		IndicatorSpec spec;
+		QColor color;
+		IndicatorState state;				// 확정 봉까지 누적
+		std::vector<SeriesPoint> points;	// 시간순
+		bool hasLive = false;				// 마지막 점이 오늘 봉 값인지
+	};
+	std::vector<Overlay> m_overlays;
+	QVector<Candle> m_bars;		// 마지막 봉은 아직 안 끝났을 수 있음
+	qint64 m_barMs = 0;
+	bool m_lastBarOpen = false;
+
+	void rebuildOverlays();
+	void updateLiveOverlays(const StockData& data);
+	void overlayRange(double& minValue, double& maxValue) const;
+	void drawOverlays(QPainter& painter, const QRect& plot, const std::function<QPointF(const SeriesPoint&)>& toPoint) const;
+
+	QRect plotRect() const;
+	void fitAll();
+	void scheduleRepaint();
+};
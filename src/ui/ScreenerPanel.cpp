@@ -0,0 +1,159 @@
+#include "ScreenerPanel.h"
+#include "ScreenerTableModel.h"
+#include <QLabel>
+#include <QTableView>
+#include <QHeaderView>
+#include <QComboBox>
+#include <QDoubleSpinBox>
+#include <QCheckBox>
+#include <QVBoxLayout>
+#include <QFormLayout>
+#include <QElapsedTimer>
+
+ScreenerPanel::ScreenerPanel(Screener* screener, QWidget* parent)
+	: QDockWidget("스크리너", parent), m_screener(screener)
+{
+	setObjectName("ScreenerPanel");
+
+	QWidget* content = new QWidget(this);
+	QVBoxLayout* layout = new QVBoxLayout(content);
+	QFormLayout* form = new QFormLayout();
+
+	m_marketCombo = new QComboBox(content);
+	m_marketCombo->addItems({ "전체", "KOSPI", "KOSDAQ" });
+	form->addRow("시장", m_marketCombo);
+
+	// 최솟값 = 조건 끔 ("제한 없음")
+	m_changeSpin = new QDoubleSpinBox(content);
+	m_changeSpin->setRange(-30.5, 30.0);
+	m_changeSpin->setSingleStep(0.5);
+	m_changeSpin->setSuffix(" % 이상");
+	m_changeSpin->setSpecialValueText("제한 없음");
+	m_changeSpin->setValue(m_changeSpin->minimum());
+	form->addRow("등락률", m_changeSpin);
+
+	m_volumeSpin = new QDoubleSpinBox(content);
+	m_volumeSpin->setRange(0, 1e12);
+	m_volumeSpin->setDecimals(0);
+	m_volumeSpin->setSingleStep(10000);
+	m_volumeSpin->setSuffix(" 주 이상");
+	m_volumeSpin->setSpecialValueText("제한 없음");
+	form->addRow("거래량", m_volumeSpin);
+
+	m_capSpin = new QDoubleSpinBox(content);
+	m_capSpin->setRange(0, 1e8);
+	m_capSpin->setDecimals(0);
+	m_capSpin->setSingleStep(1000);
+	m_capSpin->setSuffix(" 억 이상");
+	m_capSpin->setSpecialValueText("제한 없음");
+	form->addRow("시가총액", m_capSpin);
+
+	m_sortCombo = new QComboBox(content);
+	m_sortCombo->addItem("등락률", static_cast<int>(ScreenerField::ChangePercent));
+	m_sortCombo->addItem("거래량", static_cast<int>(ScreenerField::Volume));
+	m_sortCombo->addItem("시가총액", static_cast<int>(ScreenerField::MarketCap));
+	m_sortCombo->addItem("현재가", static_cast<int>(ScreenerField::Price));
+	m_sortCombo->addItem("전일 거래량", static_cast<int>(ScreenerField::PrevVolume));
+	form->addRow("정렬", m_sortCombo);
+
+	m_quotedCheck = new QCheckBox("시세를 받은 종목만", content);
+	form->addRow(m_quotedCheck);
+	layout->addLayout(form);
+
+	m_model = new ScreenerTableModel(m_screener, this);
+	m_table = new QTableView(content);
+	m_table->setModel(m_model);
+	m_table->horizontalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+	m_table->horizontalHeader()->setStretchLastSection(true);
+	m_table->verticalHeader()->hide();
+	m_table->setSelectionBehavior(QAbstractItemView::SelectRows);
+	layout->addWidget(m_table);
+
+	m_statusLabel = new QLabel(content);
+	layout->addWidget(m_statusLabel);
+	setWidget(content);
+
+	connect(m_marketCombo, &QComboBox::currentIndexChanged, this, &ScreenerPanel::onQueryEdited);
+	connect(m_sortCombo, &QComboBox::currentIndexChanged, this, &ScreenerPanel::onQueryEdited);
+	connect(m_changeSpin, &QDoubleSpinBox::valueChanged, this, &ScreenerPanel::onQueryEdited);
+	connect(m_volumeSpin, &QDoubleSpinBox::valueChanged, this, &ScreenerPanel::onQueryEdited);
+	connect(m_capSpin, &QDoubleSpinBox::valueChanged, this, &ScreenerPanel::onQueryEdited);
+	connect(m_quotedCheck, &QCheckBox::toggled, this, &ScreenerPanel::onQueryEdited);
+	connect(m_table, &QTableView::doubleClicked, this, [this](const QModelIndex& index)
+	{
+		QString code = m_model->codeAt(index.row());
+		if (!code.isEmpty())
+			emit symbolActivated(code);
+	});
+
+	// 종목이 빠지면 행 번호가 바뀌므로 바로 다시 조회 (숨겨져 있으면 결과만 비움)
+	connect(m_screener, &Screener::universeChanged, this, [this]()
+	{
+		m_queryDirty = true;
+		if (isVisible())
+			refresh();
+		else
+			m_model->setRows({});
+	});
+
+	// 시세는 수시로 들어오므로 0.5초마다 바뀐 게 있을 때만 다시 조회
+	m_refreshTimer = new QTimer(this);
+	m_refreshTimer->setInterval(500);
+	connect(m_refreshTimer, &QTimer::timeout, this, &ScreenerPanel::refresh);
+	m_refreshTimer->start();
+}
+
+void ScreenerPanel::onQueryEdited()
+{
+	m_queryDirty = true;
+	refresh();
+}
+
+ScreenerQuery ScreenerPanel::currentQuery() const
+{
+	ScreenerQuery query;
+	if (m_marketCombo->currentIndex() == 1)
+		query.markets = 1 << static_cast<int>(Market::Kospi);
+	else if (m_marketCombo->currentIndex() == 2)
+		query.markets = 1 << static_cast<int>(Market::Kosdaq);
+
+	if (m_changeSpin->value() > m_changeSpin->minimum())
+	{
+		query.range(ScreenerField::ChangePercent).enabled = true;
+		query.range(ScreenerField::ChangePercent).min = m_changeSpin->value();
+	}
+	if (m_volumeSpin->value() > 0)
+	{
+		query.range(ScreenerField::Volume).enabled = true;
+		query.range(ScreenerField::Volume).min = m_volumeSpin->value();
+	}
+	if (m_capSpin->value() > 0)
+	{
+		query.range(ScreenerField::MarketCap).enabled = true;
+		query.range(ScreenerField::MarketCap).min = m_capSpin->value();
+	}
+
+	query.quotedOnly = m_quotedCheck->isChecked();
+	query.sortBy = static_cast<ScreenerField>(m_sortCombo->currentData().toInt());
+	query.descending = true;
+	query.limit = 200;
+	return query;
+}
+
+void ScreenerPanel::refresh()
+{
+	// 숨겨져 있으면 계산하지 않음 (다시 보일 때 버전 차이로 갱신)
+	if (!isVisible()) return;
+	if (!m_queryDirty && m_shownVersion == m_screener->version()) return;
+
+	QElapsedTimer timer;
+	timer.start();
+	std::vector<int> rows = m_screener->query(currentQuery());
+	const double elapsedMs = timer.nsecsElapsed() / 1e6;
+
+	m_shownVersion = m_screener->version();
+	m_queryDirty = false;
+	m_statusLabel->setText(QString("%1 / %2 종목  (%3 ms)")
+		.arg(rows.size()).arg(m_screener->count()).arg(elapsedMs, 0, 'f', 3));
+	m_model->setRows(std::move(rows));
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <QDockWidget>
+#include <QTimer>
+#include "core/Screener.h"
+
+class QLabel;
+class QTableView;
+class QComboBox;
+class QDoubleSpinBox;
+class QCheckBox;
+class ScreenerTableModel;
+
+// 국내 전 종목 스크리너 패널 (조건 + 결과 표)
+// 시세가 바뀌었을 때만 일정 간격으로 다시 조회
+class ScreenerPanel : public QDockWidget
+{
+	Q_OBJECT
+
+public:
+	explicit ScreenerPanel(Screener* screener, QWidget* parent = nullptr);
+
+signals:
+	void symbolActivated(const QString& code);	// 결과 더블클릭 -> 관심종목 추가
+
+private slots:
+	void refresh();
+	void onQueryEdited();
+
+private:
+	Screener* m_screener;
+	ScreenerTableModel* m_model;
+	QTableView* m_table;
+	QComboBox* m_marketCombo;
+	QComboBox* m_sortCombo;
+	QDoubleSpinBox* m_changeSpin;
+	QDoubleSpinBox* m_volumeSpin;
+	QDoubleSpinBox* m_capSpin;
+	QCheckBox* m_quotedCheck;
+	QLabel* m_statusLabel;
+	QTimer* m_refreshTimer;
+	quint64 m_shownVersion = 0;
+	bool m_queryDirty = true;
+
+	ScreenerQuery currentQuery() const;
+};
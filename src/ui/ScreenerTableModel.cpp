@@ -0,0 +1,107 @@
+#include "ScreenerTableModel.h"
+#include <QColor>
+#include <QLocale>
+#include <cmath>
+
+ScreenerTableModel::ScreenerTableModel(Screener* screener, QObject* parent)
+	: QAbstractTableModel(parent), m_screener(screener)
+{
+}
+
+int ScreenerTableModel::rowCount(const QModelIndex& parent) const
+{
+	if (parent.isValid()) return 0;
+	return static_cast<int>(m_rows.size());
+}
+
+int ScreenerTableModel::columnCount(const QModelIndex& parent) const
+{
+	if (parent.isValid()) return 0;
+	return ColumnCount;
+}
+
+void ScreenerTableModel::setRows(std::vector<int> rows)
+{
+	// 결과가 같으면 값만 다시 그림 (선택/스크롤 유지)
+	if (rows == m_rows)
+	{
+		if (!m_rows.empty())
+			emit dataChanged(index(0, Price), index(rowCount() - 1, ColumnCount - 1));
+		return;
+	}
+
+	beginResetModel();
+	m_rows = std::move(rows);
+	endResetModel();
+}
+
+QString ScreenerTableModel::codeAt(int row) const
+{
+	if (row < 0 || row >= rowCount() || m_rows[row] >= m_screener->count()) return QString();
+	return m_screener->code(m_rows[row]);
+}
+
+QVariant ScreenerTableModel::headerData(int section, Qt::Orientation orientation, int role) const
+{
+	if (orientation != Qt::Horizontal || role != Qt::DisplayRole) return QVariant();
+
+	switch (section)
+	{
+	case Code:       return "코드";
+	case Name:       return "종목명";
+	case MarketName: return "시장";
+	case Price:      return "현재가";
+	case Change:     return "등락률";
+	case Volume:     return "거래량";
+	case MarketCap:  return "시가총액(억)";
+	default:         return QVariant();
+	}
+}
+
+QVariant ScreenerTableModel::data(const QModelIndex& index, int role) const
+{
+	if (!index.isValid() || index.row() >= rowCount())
+		return QVariant();
+
+	const int row = m_rows[index.row()];
+	if (row >= m_screener->count()) return QVariant();
+	const double change = m_screener->value(row, ScreenerField::ChangePercent);
+
+	if (role == Qt::DisplayRole)
+	{
+		switch (index.column())
+		{
+		case Code:       return m_screener->code(row);
+		case Name:       return m_screener->name(row);
+		case MarketName: return m_screener->market(row) == Market::Kospi ? "KOSPI" : "KOSDAQ";
+		case Price:      return QLocale::system().toString(m_screener->value(row, ScreenerField::Price), 'f', 0);
+		case Change:
+			if (std::isnan(change)) return "-";
+			return QString("%1%2%").arg(change > 0 ? "+" : "").arg(change, 0, 'f', 2);
+		case Volume:
+		{
+			const double volume = m_screener->value(row, ScreenerField::Volume);
+			if (std::isnan(volume)) return "-";
+			return QLocale::system().toString(volume, 'f', 0);
+		}
+		case MarketCap:  return QLocale::system().toString(m_screener->value(row, ScreenerField::MarketCap), 'f', 0);
+		}
+	}
+	else if (role == Qt::ForegroundRole)
+	{
+		// 시세를 아직 못 받은 종목은 흐리게 (기준가 기준 값)
+		if (!m_screener->isQuoted(row)) return QColor(Qt::gray);
+		if (index.column() == Change || index.column() == Price)
+		{
+			if (change > 0) return QColor(Qt::red);
+			if (change < 0) return QColor(Qt::blue);
+		}
+	}
+	else if (role == Qt::TextAlignmentRole)
+	{
+		if (index.column() <= MarketName) return Qt::AlignCenter;
+		return int(Qt::AlignRight | Qt::AlignVCenter);
+	}
+
+	return QVariant();
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <QAbstractTableModel>
+#include <vector>
+#include "core/Screener.h"
+
+// 스크리너 결과 표 (Screener 열을 행 번호로 직접 읽음, 복사 없음)
+class ScreenerTableModel : public QAbstractTableModel
+{
+	Q_OBJECT
+
+public:
+	explicit ScreenerTableModel(Screener* screener, QObject* parent = nullptr);
+
+	int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+	int columnCount(const QModelIndex& parent = QModelIndex()) const override;
+	QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const override;
+	QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+	enum Column
+	{
+		Code = 0,
+		Name,
+		MarketName,
+		Price,
+		Change,
+		Volume,
+		MarketCap,
+		ColumnCount
+	};
+
+	void setRows(std::vector<int> rows);
+	QString codeAt(int row) const;
+
+private:
+	Screener* m_screener;
+	std::vector<int> m_rows;	// Screener 행 번호
+};
@@ -2,6 +2,7 @@
 #include "StockTableModel.h"
 #include <QPainter>
 #include <QPen>
+#include "core/LatencyTracer.h"
 
 StockItemDelegate::StockItemDelegate(QObject* parent) : QStyledItemDelegate(parent)
 {
@@ -16,6 +17,10 @@ void StockItemDelegate::paint(QPainter* painter, const QStyleOptionViewItem& opt
 	{
 	case StockTableModel::Price:
 		drawPriceBorder(painter, option, index);
+		markPainted(index);
+		break;
+	case StockTableModel::Trend:
+		drawSparkline(painter, option, index);
 		break;
 	default:
 		break;
@@ -48,3 +53,36 @@ void StockItemDelegate::drawPriceBorder(QPainter* painter, const QStyleOptionVie
 		painter->restore();
 	}
 }
+
+void StockItemDelegate::markPainted(const QModelIndex& index) const
+{
+	// 가격 칸이 그려지면 그 시세의 요청 추적 종료 (이미 끝난 추적이면 무시됨)
+	const StockTableModel* model = static_cast<const StockTableModel*>(index.model());
+	if (!model) return;
+
+	if (const StockData* stock = model->stockAt(index.row()))
+		LatencyTracer::mark(stock->traceId, TraceStage::Painted);
+}
+
+void StockItemDelegate::drawSparkline(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const
+{
+	const StockTableModel* model = static_cast<const StockTableModel*>(index.model());
+	if (!model) return;
+
+	// 위아래 여백
+	QRectF area = QRectF(option.rect).adjusted(4, 4, -4, -4);
+	QPolygonF points = model->sparkline(index.row(), area.size());
+	if (points.size() < 2) return;
+
+	// 구간 첫 틱 대비 상승이면 빨강, 하락이면 파랑
+	QColor lineColor = Qt::gray;
+	if (points.last().y() < points.first().y()) lineColor = Qt::red;
+	else if (points.last().y() > points.first().y()) lineColor = Qt::blue;
+
+	painter->save();
+	painter->setRenderHint(QPainter::Antialiasing);
+	painter->translate(area.topLeft());
+	painter->setPen(QPen(lineColor, 1.5));
+	painter->drawPolyline(points);
+	painter->restore();
+}
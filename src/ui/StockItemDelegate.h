@@ -13,4 +13,6 @@ public:
 
 private:
 	void drawPriceBorder(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const;
+	void drawSparkline(QPainter* painter, const QStyleOptionViewItem& option, const QModelIndex& index) const;
+	void markPainted(const QModelIndex& index) const;
 };
\ No newline at end of file
@@ -1,6 +1,10 @@
 #include "StockTableModel.h"
 #include <QColor>
 #include <QLocale>
+#include <QDateTime>
+#include "core/LatencyTracer.h"
+#include "core/IndicatorStore.h"
+#include <cmath>
 
 StockTableModel::StockTableModel(QObject* parent) : QAbstractTableModel(parent)
 {
@@ -15,7 +19,7 @@ int StockTableModel::rowCount(const QModelIndex& parent) const
 int StockTableModel::columnCount(const QModelIndex& parent) const
 {
 	if (parent.isValid()) return 0;
-	return Column::ColumnCount;
+	return Column::ColumnCount + (m_indicators ? static_cast<int>(m_indicators->specs().size()) : 0);
 }
 
 bool StockTableModel::removeRow(int row, const QModelIndex& parent)
@@ -24,6 +28,9 @@ bool StockTableModel::removeRow(int row, const QModelIndex& parent)
         return false;
 
     beginRemoveRows(parent, row, row);
+    m_history.remove(m_data[row].symbol);
+    m_sparklines.remove(m_data[row].symbol);
+    m_logos.remove(m_data[row].symbol);
     m_data.erase(m_data.begin() + row);
     endRemoveRows();
     return true;
@@ -39,7 +46,12 @@ QVariant StockTableModel::headerData(int section, Qt::Orientation orientation, i
         case Column::Symbol: return "Symbol";
         case Column::Price:  return "Price ($)";
         case Column::Change: return "Change (%)";
-        default: return QVariant();
+        case Column::Trend:  return "Trend";
+        default:
+        {
+            int spec = indicatorIndex(section);
+            return spec >= 0 ? m_indicators->specs()[spec].toString() : QVariant();
+        }
         }
     }
     return QVariant();
@@ -52,6 +64,35 @@ QVariant StockTableModel::data(const QModelIndex& index, int role) const
 
     const StockData& stock = m_data[index.row()];
 
+    // 지표 열
+    const int spec = indicatorIndex(index.column());
+    if (spec >= 0)
+    {
+        const double value = m_indicators->value(stock.symbol, spec);
+        if (role == Qt::DisplayRole)
+        {
+            if (std::isnan(value)) return "-";
+            if (m_indicators->specs()[spec].type == IndicatorType::RSI)
+                return QString::number(value, 'f', 1);
+            return formatNumber(std::round(value * 100.0) / 100.0);
+        }
+        if (role == Qt::ForegroundRole && !std::isnan(value))
+        {
+            // RSI 과매수/과매도, 나머지는 현재가가 지표 위/아래
+            if (m_indicators->specs()[spec].type == IndicatorType::RSI)
+            {
+                if (value >= 70) return QColor(Qt::red);
+                if (value <= 30) return QColor(Qt::blue);
+            }
+            else if (stock.currentPrice > value) return QColor(Qt::red);
+            else if (stock.currentPrice < value) return QColor(Qt::blue);
+            return QVariant();
+        }
+        if (role == Qt::TextAlignmentRole)
+            return int(Qt::AlignRight | Qt::AlignVCenter);
+        return QVariant();
+    }
+
     // 텍스트 보여주기 (DisplayRole)
     if (role == Qt::DisplayRole)
     {
@@ -72,14 +113,19 @@ QVariant StockTableModel::data(const QModelIndex& index, int role) const
     else if (role == Qt::DecorationRole)
     {
         // Symbol 컬럼(0번 열)에만 이미지를 띄웁니다.
-        if (index.column() == Symbol && !stock.logo.isNull())
+        if (index.column() == Symbol)
         {
-            return stock.logo;
+            auto it = m_logos.constFind(stock.symbol);
+            if (it != m_logos.cend())
+                return it.value();
         }
     }
     // 글자 색상 입히기 (ForegroundRole)
     else if (role == Qt::ForegroundRole)
     {
+        // 복원한 값은 실시간 시세가 올 때까지 회색
+        if (stock.stale) return QColor(Qt::gray);
+
         if (index.column() == Change || index.column() == Price)
         {
             double change = stock.getChangePercentage();
@@ -87,6 +133,12 @@ QVariant StockTableModel::data(const QModelIndex& index, int role) const
             else if (change < 0) return QColor(Qt::blue); // 하락: 파랑
         }
     }
+    else if (role == Qt::ToolTipRole)
+    {
+        if (stock.stale)
+            return QString("지난 실행의 마지막 시세 (%1), 실시간 대기 중")
+                .arg(QDateTime::fromMSecsSinceEpoch(stock.timestamp).toString("MM-dd HH:mm:ss"));
+    }
     // 텍스트 정렬 (TextAlignmentRole)
     else if (role == Qt::TextAlignmentRole)
     {
@@ -101,6 +153,8 @@ void StockTableModel::setStockData(const std::vector<StockData>&data)
 {
     beginResetModel();
     m_data = data;
+    m_history.clear();
+    m_sparklines.clear();
     endResetModel();
 }
 
@@ -117,49 +171,70 @@ void StockTableModel::clear()
 {
     beginResetModel();
     m_data.clear();
+    m_history.clear();
+    m_sparklines.clear();
+    m_logos.clear();
     endResetModel();
 }
 
+void StockTableModel::restoreStale(const QVector<StockData>& quotes)
+{
+    if (quotes.isEmpty()) return;
+
+    beginInsertRows(QModelIndex(), m_data.size(), m_data.size() + quotes.size() - 1);
+    m_data.reserve(m_data.size() + quotes.size());
+    for (const StockData& quote : quotes)
+    {
+        m_data.push_back(quote);
+        m_data.back().stale = true;
+        m_data.back().previousPrice = quote.currentPrice;   // 가격 변동 테두리 없이
+    }
+    endInsertRows();
+}
+
 void StockTableModel::updateOrInsert(const StockData& data)
 {
+    LatencyTracer::countTick();
+
+    // 틱 기록
+    if (data.currentPrice > 0)
+        m_history[data.symbol].append({ data.timestamp, data.currentPrice, data.volume });
+
     for (int i = 0; i < m_data.size(); ++i)
     {
         // 이미 있는 종목
         if (m_data[i].symbol == data.symbol)
         {
-            // 로고 유지
-            QPixmap existingLogo = m_data[i].logo;
             // 이전가격 저장
             double oldPrice = m_data[i].currentPrice;
 
-            // 데이터 갱신
+            // 데이터 갱신 (심볼/이름은 공유 문자열이라 참조 수만 바뀜)
             m_data[i] = data;
             // 이전가격 복구
             m_data[i].previousPrice = oldPrice;
 
-            if (data.logo.isNull() && !existingLogo.isNull())
-                m_data[i].logo = existingLogo;
-
             // 업데이트 알림
             QModelIndex topLeft = index(i, 0);
-            QModelIndex bottomRight = index(i, ColumnCount - 1);
+            QModelIndex bottomRight = index(i, columnCount() - 1);
             emit dataChanged(topLeft, bottomRight);
 
+            LatencyTracer::mark(data.traceId, TraceStage::Applied);
             return;
         }
     }
     addStockData(data);
+    LatencyTracer::mark(data.traceId, TraceStage::Applied);
 }
 
 void StockTableModel::updateLogo(const QString& symbol, const QPixmap& logo)
 {
+    // 크기 24x24로 조절. 아직 행이 없으면 보관만 해두고 시세가 오면 그때 보임
+    m_logos.insert(symbol, logo.scaled(24, 24, Qt::KeepAspectRatio, Qt::SmoothTransformation));
+
     for (int i = 0; i < m_data.size(); ++i)
     {
         if (m_data[i].symbol == symbol)
         {
-            // 크기 24x24로 조절
-            m_data[i].logo = logo.scaled(24, 24, Qt::KeepAspectRatio, Qt::SmoothTransformation);
-
             // 업데이트 알림
             QModelIndex idx = index(i, 0);
             emit dataChanged(idx, idx, { Qt::DecorationRole });
@@ -174,6 +249,72 @@ bool StockTableModel::isPriceChanged(int row) const
     return !qFuzzyCompare(m_data[row].currentPrice, m_data[row].previousPrice);
 }
 
+const TickHistory* StockTableModel::tickHistory(int row) const
+{
+    if (row < 0 || row >= m_data.size()) return nullptr;
+
+    auto it = m_history.constFind(m_data[row].symbol);
+    return it != m_history.cend() ? &it.value() : nullptr;
+}
+
+QPolygonF StockTableModel::sparkline(int row, const QSizeF& size) const
+{
+    const TickHistory* history = tickHistory(row);
+    if (!history || history->size() < 2 || size.width() < 2) return QPolygonF();
+
+    SparklineCache& cache = m_sparklines[m_data[row].symbol];
+    if (cache.revision == history->revision() && cache.size == size)
+        return cache.points;
+
+    const int count = history->size();
+    const int buckets = qMin(count, static_cast<int>(size.width()));
+
+    double minPrice = history->at(0).price;
+    double maxPrice = minPrice;
+    for (int i = 1; i < count; ++i)
+    {
+        minPrice = qMin(minPrice, history->at(i).price);
+        maxPrice = qMax(maxPrice, history->at(i).price);
+    }
+    double range = maxPrice - minPrice;
+
+    auto toY = [&](double price)
+    {
+        if (range <= 0) return size.height() / 2.0;
+        return size.height() - (price - minPrice) / range * size.height();
+    };
+
+    // 픽셀 한 칸에 여러 틱이 몰리면 최소/최대만 남김 (모양 유지하면서 점 개수 제한)
+    QPolygonF points;
+    points.reserve(buckets * 2);
+    for (int b = 0; b < buckets; ++b)
+    {
+        int begin = b * count / buckets;
+        int end = (b + 1) * count / buckets;
+        double x = (buckets > 1) ? b * (size.width() - 1) / (buckets - 1) : 0.0;
+
+        int minIdx = begin;
+        int maxIdx = begin;
+        for (int i = begin + 1; i < end; ++i)
+        {
+            if (history->at(i).price < history->at(minIdx).price) minIdx = i;
+            if (history->at(i).price > history->at(maxIdx).price) maxIdx = i;
+        }
+
+        // 시간 순서대로 넣어야 선이 꼬이지 않음
+        int first = qMin(minIdx, maxIdx);
+        int second = qMax(minIdx, maxIdx);
+        points << QPointF(x, toY(history->at(first).price));
+        if (second != first)
+            points << QPointF(x, toY(history->at(second).price));
+    }
+
+    cache.revision = history->revision();
+    cache.size = size;
+    cache.points = points;
+    return cache.points;
+}
+
 QStringList StockTableModel::getAllSymbols() const
 {
     QStringList symbols;
@@ -184,6 +325,51 @@ QStringList StockTableModel::getAllSymbols() const
     return symbols;
 }
 
+const StockData* StockTableModel::stockAt(int row) const
+{
+    if (row < 0 || row >= m_data.size()) return nullptr;
+    return &m_data[row];
+}
+
+void StockTableModel::setIndicatorStore(IndicatorStore* store)
+{
+    beginResetModel();
+    if (m_indicators)
+        disconnect(m_indicators, nullptr, this, nullptr);
+    m_indicators = store;
+    endResetModel();
+
+    if (!m_indicators) return;
+
+    // 열 구성 변경 -> 열 다시 만들기
+    connect(m_indicators, &IndicatorStore::specsChanged, this, [this]()
+    {
+        beginResetModel();
+        endResetModel();
+    });
+
+    // 백필 완료 -> 해당 행의 지표 열만 갱신
+    connect(m_indicators, &IndicatorStore::valuesChanged, this, [this](const QString& symbol)
+    {
+        if (columnCount() <= ColumnCount) return;
+        for (int i = 0; i < m_data.size(); ++i)
+        {
+            if (m_data[i].symbol == symbol)
+            {
+                emit dataChanged(index(i, ColumnCount), index(i, columnCount() - 1));
+                return;
+            }
+        }
+    });
+}
+
+int StockTableModel::indicatorIndex(int column) const
+{
+    if (!m_indicators || column < ColumnCount) return -1;
+    const int spec = column - ColumnCount;
+    return spec < m_indicators->specs().size() ? spec : -1;
+}
+
 QString StockTableModel::formatNumber(double value) const
 {
     // 정수인지 확인 (한국 주식은 보통 소수점이 없음)
@@ -2,7 +2,13 @@
 
 #include <QAbstractTableModel>
 #include <vector>
+#include <QHash>
+#include <QPolygonF>
+#include <QPixmap>
 #include "core/StockData.h"
+#include "core/TickHistory.h"
+
+class IndicatorStore;
 
 class StockTableModel : public QAbstractTableModel
 {
@@ -23,20 +29,42 @@ public:
 	void clear();
 	void updateOrInsert(const StockData& data);
 	void updateLogo(const QString& symbol, const QPixmap& logo);
+	// 지난 실행의 마지막 시세로 행을 채움 (흐리게 표시, 틱 기록에는 안 넣음)
+	void restoreStale(const QVector<StockData>& quotes);
 
 	bool isPriceChanged(int row) const;
+	const TickHistory* tickHistory(int row) const;
+	QPolygonF sparkline(int row, const QSizeF& size) const;
 	QStringList getAllSymbols() const;
+	const StockData* stockAt(int row) const;
+
+	// 고정 열 뒤에 지표 열을 붙임 (지표 구성이 바뀌면 열도 다시 만듦)
+	void setIndicatorStore(IndicatorStore* store);
+	int indicatorIndex(int column) const;	// 지표 열이 아니면 -1
 
 	enum Column
 	{
 		Symbol = 0,
 		Price,
 		Change,
+		Trend,
 		ColumnCount
 	};
 
 private:
 	std::vector<StockData> m_data;
+	IndicatorStore* m_indicators = nullptr;
+	QHash<QString, TickHistory> m_history;	// 종목별 최근 틱
+	QHash<QString, QPixmap> m_logos;		// 종목별 로고 (24x24, 시세보다 먼저 와도 보관)
+
+	// 스파크라인 캐시 (새 틱이 들어오거나 셀 크기가 바뀔 때만 다시 계산)
+	struct SparklineCache
+	{
+		quint64 revision = 0;
+		QSizeF size;
+		QPolygonF points;
+	};
+	mutable QHash<QString, SparklineCache> m_sparklines;
 
 	QString formatNumber(double value) const;
 };
\ No newline at end of file
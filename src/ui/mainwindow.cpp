@@ -1,9 +1,13 @@
 ﻿#include "mainwindow.h"
 #include "ui_mainwindow.h"
 #include "StockItemDelegate.h"
-#include "core/FinnhubAPI.h"
-#include "core/KisAPI.h"
+#include "PriceChartWidget.h"
+#include "DepthLadderWidget.h"
+#include "MetricsPanel.h"
+#include "PortfolioPanel.h"
+#include "ScreenerPanel.h"
 #include "core/Config.h"
+#include "core/QuoteSnapshot.h"
 #include <QMessageBox>
 #include <QRegularExpression>
 #include <QPushButton>
@@ -13,9 +17,55 @@
 #include <QStringListModel>
 #include <QMenu>
 #include <QSettings>
+#include <QStandardPaths>
+#include <QSystemTrayIcon>
+#include <QInputDialog>
+#include <QApplication>
+#include <QDir>
+#include <QFile>
+#include <QStyle>
+
+namespace
+{
+    // 틱 저널 설정 (기본 꺼짐)
+    const char* KEY_JOURNAL_ENABLED = "journal/enabled";
+    const char* KEY_JOURNAL_DIR = "journal/dir";
+
+    // 공유 메모리 시세판 (기본 켜짐)
+    const char* KEY_QUOTEBOARD_ENABLED = "quoteboard/enabled";
+    const char* KEY_QUOTEBOARD_KEY = "quoteboard/key";
+
+    // 지표 설정 ("SMA(20)" 같은 문자열 목록)
+    const char* KEY_INDICATOR_COLUMNS = "indicators/columns";
+    const char* KEY_INDICATOR_OVERLAYS = "indicators/overlays";
 
-MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent), ui(new Ui::MainWindow)
+    QVector<IndicatorSpec> loadIndicatorSpecs(const char* key, const QStringList& defaults)
+    {
+        QSettings settings(Config::SETTINGS_COMPANY, Config::SETTINGS_APP);
+        QVector<IndicatorSpec> specs;
+        for (const QString& text : settings.value(key, defaults).toStringList())
+        {
+            IndicatorSpec spec;
+            if (IndicatorSpec::fromString(text, spec))
+                specs.append(spec);
+        }
+        return specs;
+    }
+
+    void saveIndicatorSpecs(const char* key, const QVector<IndicatorSpec>& specs)
+    {
+        QStringList list;
+        for (const IndicatorSpec& spec : specs)
+            list << spec.toString();
+        QSettings settings(Config::SETTINGS_COMPANY, Config::SETTINGS_APP);
+        settings.setValue(key, list);
+    }
+}
+
+MainWindow::MainWindow(QWidget* parent, StockAPI* replay)
+    : QMainWindow(parent), ui(new Ui::MainWindow), m_replayMode(replay != nullptr)
 {
+    m_launchTimer.start();
     ui->setupUi(this);
 
     // 초기설정
@@ -33,14 +83,27 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent), ui(new Ui::MainWi
     StockItemDelegate* delegate = new StockItemDelegate(this);
     ui->tableView->setItemDelegate(delegate);
 
+    // 지난 실행의 마지막 시세로 첫 화면부터 채움 (회색, 실시간 시세가 오면 덮임)
+    ui->tableView->viewport()->installEventFilter(this);
+    if (!m_replayMode)
+        restoreSnapshot();
+
     m_searchModel = new QStringListModel(this);
 
-    // API 객체 생성
-    m_usApi = new FinnhubAPI(this);
-    m_krApi = new KisAPI(this);
+    // 지연 시간 패널 (기본 숨김, F12로 토글)
+    m_metricsPanel = new MetricsPanel(this);
+    addDockWidget(Qt::RightDockWidgetArea, m_metricsPanel);
+    m_metricsPanel->hide();
+    QAction* metricsAction = m_metricsPanel->toggleViewAction();
+    metricsAction->setShortcut(Qt::Key_F12);
+    addAction(metricsAction);
+
+    // 시세 제공자 (전용 I/O 스레드에서 동작, 재생 API도 넘겨받음)
+    m_provider = new ProviderService(replay, true, this);
 
     // 미국 주식 심볼 전체 가져오기
-    m_usApi->fetchAllUSSymblos();
+    if (!m_replayMode)
+        m_provider->fetchAllUSSymbols();
 
     // 버튼 및 입력
     ui->btnRefresh->setShortcut(Qt::Key_F5);
@@ -48,50 +111,236 @@ MainWindow::MainWindow(QWidget* parent) : QMainWindow(parent), ui(new Ui::MainWi
     connect(ui->editSearch, &QLineEdit::returnPressed, ui->btnSearch, &QPushButton::click);
     connect(ui->btnSearch, &QPushButton::clicked, this, &MainWindow::onSearchClicked);
     connect(ui->tableView, &QTableView::customContextMenuRequested, this, &MainWindow::onTableContextMenu);
+    connect(ui->tableView, &QTableView::doubleClicked, this, &MainWindow::onTableDoubleClicked);
+
+    // 지표 (틱은 onQuotesReceived에서 받음)
+    m_indicators = new IndicatorStore(CandleResolution::Day, this);
+    m_indicators->setSpecs(loadIndicatorSpecs(KEY_INDICATOR_COLUMNS, { "SMA(20)", "RSI(14)" }));
+    m_stockModel->setIndicatorStore(m_indicators);
+
+    // 헤더 우클릭으로 지표 열 구성
+    ui->tableView->horizontalHeader()->setContextMenuPolicy(Qt::CustomContextMenu);
+    connect(ui->tableView->horizontalHeader(), &QHeaderView::customContextMenuRequested, this, &MainWindow::onHeaderContextMenu);
+
+    // 데이터 수신: 화면 쪽(테이블/차트/포트폴리오/스크리너)은 I/O 스레드가 넣은 우편함에서
+    // 프레임마다 바뀐 종목의 최신 시세만 받음. 지표/알림/저널은 모든 틱을 묶음으로 받음
+    m_mailbox = new QuoteMailbox(this);
+    m_provider->setMailbox(m_mailbox);
+    connect(m_provider, &ProviderService::quotesReceived, this, &MainWindow::onQuotesReceived);
+    connect(m_mailbox, &QuoteMailbox::dataReceived, this, &MainWindow::updateUI);
+
+    // 가격 알림 (수신 즉시 판정)
+    m_alertEngine = new AlertEngine(this);
+    m_alertEngine->load(alertFilePath());
+    connect(m_alertEngine, &AlertEngine::alertTriggered, this, &MainWindow::onAlertTriggered);
+
+    m_trayIcon = nullptr;
+    if (QSystemTrayIcon::isSystemTrayAvailable())
+    {
+        QIcon icon = windowIcon();
+        if (icon.isNull())
+            icon = style()->standardIcon(QStyle::SP_ComputerIcon);
+        m_trayIcon = new QSystemTrayIcon(icon, this);
+        m_trayIcon->setToolTip("StockFlow");
+        m_trayIcon->show();
+    }
 
-    // 데이터 수신
-    connect(m_usApi, &StockAPI::dataReceived, this, &MainWindow::updateUI);
-    connect(m_krApi, &KisAPI::dataReceived, this, &MainWindow::updateUI);
+    // 포트폴리오 (기본 숨김, F11로 토글)
+    m_portfolio = new Portfolio(this);
+    m_portfolio->load(portfolioFilePath());
+    connect(m_mailbox, &QuoteMailbox::dataReceived, m_portfolio, &Portfolio::onTick);
+
+    m_portfolioPanel = new PortfolioPanel(m_portfolio, this);
+    addDockWidget(Qt::RightDockWidgetArea, m_portfolioPanel);
+    m_portfolioPanel->hide();
+    QAction* portfolioAction = m_portfolioPanel->toggleViewAction();
+    portfolioAction->setShortcut(Qt::Key_F11);
+    addAction(portfolioAction);
+    connect(m_portfolioPanel, &PortfolioPanel::portfolioEdited, this, &MainWindow::savePortfolio);
+
+    // 환율 (5분마다, 재생 모드는 저장된 값 사용)
+    connect(m_provider, &ProviderService::fxRateReceived, this,
+        [this](const QString& base, const QString& quote, double rate)
+        {
+            if (base == "USD" && quote == "KRW")
+                m_portfolio->setUsdKrw(rate);
+        });
+    m_fxTimer = new QTimer(this);
+    connect(m_fxTimer, &QTimer::timeout, this, [this]() { m_provider->fetchFxRate("USD", "KRW"); });
+    if (!m_replayMode)
+    {
+        m_fxTimer->start(5 * 60 * 1000);
+        m_provider->fetchFxRate("USD", "KRW");
+    }
 
-    // 로고
-    connect(m_usApi, &StockAPI::logoReceived, this,
-        [this](QString symbol, QPixmap logo) { m_stockModel->updateLogo(symbol, logo); });
-    connect(m_krApi, &StockAPI::logoReceived, this,
-        [this](QString symbol, QPixmap logo) { m_stockModel->updateLogo(symbol, logo); });
+    // 스크리너 (기본 숨김, F10으로 토글). 결과 더블클릭 = 관심종목 추가
+    m_master.load("kospi_code.mst", Market::Kospi);
+    m_master.load("kosdaq_code.mst", Market::Kosdaq);
+    m_screener = new Screener(this);
+    m_screener->loadUniverse(m_master);
+
+    // MST 파일이 바뀌면 (신규 상장/폐지) 재시작 없이 변경분만 반영
+    m_mstWatcher = new MstWatcher(this);
+    m_mstWatcher->addFile("kospi_code.mst", Market::Kospi);
+    m_mstWatcher->addFile("kosdaq_code.mst", Market::Kosdaq);
+    m_mstWatcher->start(m_master);
+    connect(m_mstWatcher, &MstWatcher::masterReloaded, this, &MainWindow::onMasterReloaded);
+    connect(m_mailbox, &QuoteMailbox::dataReceived, m_screener, &Screener::onTick);
+
+    m_screenerPanel = new ScreenerPanel(m_screener, this);
+    addDockWidget(Qt::RightDockWidgetArea, m_screenerPanel);
+    m_screenerPanel->hide();
+    QAction* screenerAction = m_screenerPanel->toggleViewAction();
+    screenerAction->setShortcut(Qt::Key_F10);
+    addAction(screenerAction);
+    connect(m_screenerPanel, &ScreenerPanel::symbolActivated, this, [this](const QString& code)
+    {
+        m_provider->fetchStock(code);
+        m_provider->fetchLogo(code);
+    });
+
+    // 과거 봉 (차트)
+    connect(m_provider, &ProviderService::candlesReceived, this, &MainWindow::onCandlesReceived);
+
+    // 로고 (I/O 스레드에서 QImage로 풀어서 옴)
+    connect(m_provider, &ProviderService::logoReceived, this,
+        [this](const QString& symbol, const QImage& logo)
+        {
+            m_stockModel->updateLogo(symbol, QPixmap::fromImage(logo));
+            if (!m_replayMode)
+                cacheLogo(symbol, logo);
+        });
+
+    // 호가 (열려있는 호가창에만)
+    connect(m_provider, &ProviderService::orderBookReceived, this, [this](const QString& symbol, const OrderBook& book)
+    {
+        auto it = m_depthLadders.constFind(symbol);
+        if (it != m_depthLadders.cend() && it.value())
+            it.value()->applyOrderBook(book);
+    });
 
     // 한국투자증권 로그인 토큰 발급
-    connect(m_krApi, &KisAPI::authenticated, this, [this]() { this->onRefreshClicked(); });
-    m_krApi->authenticate();
+    connect(m_provider, &ProviderService::authenticated, this, [this]() { this->onRefreshClicked(); });
+    if (!m_replayMode)
+        m_provider->authenticate();
+
+    // 틱 저널
+    QSettings settings(Config::SETTINGS_COMPANY, Config::SETTINGS_APP);
+    if (settings.value(KEY_JOURNAL_ENABLED, false).toBool())
+    {
+        QString dir = settings.value(KEY_JOURNAL_DIR,
+            QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/journal").toString();
+        m_journal = std::make_unique<TickJournal>(dir);
+        if (!m_journal->start())
+            m_journal.reset();
+    }
+
+    // 공유 메모리 시세판 (재생 시세는 다른 도구에 내보내지 않음)
+    if (!m_replayMode && settings.value(KEY_QUOTEBOARD_ENABLED, true).toBool())
+    {
+        m_quoteBoard = std::make_unique<QuoteBoardWriter>(
+            settings.value(KEY_QUOTEBOARD_KEY, QuoteBoardLayout::DefaultKey).toString());
+        if (!m_quoteBoard->open())
+            m_quoteBoard.reset();
+    }
 
     // 자동 갱신
     m_timer = new QTimer(this);
     connect(m_timer, &QTimer::timeout, this, &MainWindow::onRefreshClicked);
     connect(m_timer, &QTimer::timeout, []() { qDebug() << "Auto refresh time out"; });
-    m_timer->start(10000);
+    if (!m_replayMode)
+        m_timer->start(10000);
+
+    // 마지막 시세 스냅샷 (1분마다 + 종료할 때). 비정상 종료해도 최근 값으로 시작
+    m_snapshotTimer = new QTimer(this);
+    connect(m_snapshotTimer, &QTimer::timeout, this, &MainWindow::saveSnapshot);
+    if (!m_replayMode)
+        m_snapshotTimer->start(60 * 1000);
 
     // 검색
-    connect(m_usApi, &FinnhubAPI::symbolsReceived, this, &MainWindow::updateSearchCompleter);
+    connect(m_provider, &ProviderService::symbolsReceived, this, &MainWindow::updateSearchCompleter);
     m_debounceTimer = new QTimer(this);
     m_debounceTimer->setSingleShot(true);
     m_debounceTimer->setInterval(300);
     connect(m_debounceTimer, &QTimer::timeout, this, &MainWindow::performSearch);
     connect(ui->editSearch, &QLineEdit::textEdited, this, &MainWindow::onSearchTextEdited);
 
+    // 재생 모드는 서버 심볼 목록을 기다리지 않음 (MST만으로 검색)
+    if (m_replayMode)
+    {
+        setWindowTitle(windowTitle() + " [Replay]");
+        updateSearchCompleter();
+        return;
+    }
+
     // 시작하자마자 한번 가져오기
     onRefreshClicked();
 }
 
 MainWindow::~MainWindow()
 {
-    // 앱 종료 직전에 현재 테이블의 모든 심볼 저장
-    QSettings settings(Config::SETTINGS_COMPANY, Config::SETTINGS_APP);
-    settings.setValue(Config::KEY_FAVORITES, m_stockModel->getAllSymbols());
+    // I/O 스레드가 우편함에 쓰는 중일 수 있으므로 먼저 멈춤
+    m_provider->stop();
+
+    // 앱 종료 직전에 현재 테이블의 모든 심볼 저장 (재생 모드는 관심종목을 덮어쓰지 않음)
+    if (!m_replayMode)
+    {
+        QSettings settings(Config::SETTINGS_COMPANY, Config::SETTINGS_APP);
+        settings.setValue(Config::KEY_FAVORITES, m_stockModel->getAllSymbols());
+        m_alertEngine->save(alertFilePath());
+        m_portfolio->save(portfolioFilePath());
+        saveSnapshot();
+    }
     delete ui;
 }
 
 void MainWindow::updateUI(const StockData& data)
 {
     m_stockModel->updateOrInsert(data);
+
+    if (!m_firstLiveLogged)
+    {
+        m_firstLiveLogged = true;
+        qDebug() << "[Startup] 첫 실시간 시세:" << m_launchTimer.elapsed() << "ms" << data.symbol;
+    }
+
+    // 처음 보는 종목이면 지표 계산용 과거 일봉 요청 (캐시에 있으면 네트워크 안 씀)
+    if (m_indicators->needsBackfill(data.symbol))
+    {
+        m_indicators->markBackfillRequested(data.symbol);
+        QDateTime now = QDateTime::currentDateTime();
+        m_provider->fetchCandles(data.symbol, CandleResolution::Day, now.addYears(-1), now);
+    }
+
+    if (m_quoteBoard)
+    {
+        QuoteBoardQuote quote;
+        quote.timestamp = data.timestamp;
+        quote.price = data.currentPrice;
+        quote.open = data.openPrice;
+        quote.high = data.highPrice;
+        quote.low = data.lowPrice;
+        quote.prevClose = data.prevClose;
+        quote.volume = data.volume;
+        m_quoteBoard->publish(data.symbol, quote);
+    }
+
+    // 열려있는 차트에 실시간 틱 추가
+    auto it = m_charts.constFind(data.symbol);
+    if (it != m_charts.cend() && it.value())
+        it.value()->appendTick(data);
+}
+
+void MainWindow::onQuotesReceived(const QVector<StockData>& quotes)
+{
+    // 지표/알림/저널은 병합 없이 모든 틱
+    for (const StockData& data : quotes)
+    {
+        m_indicators->onTick(data);
+        m_alertEngine->onTick(data);
+        if (m_journal)
+            m_journal->record(data);
+    }
 }
 
 void MainWindow::onRefreshClicked()
@@ -105,20 +354,7 @@ void MainWindow::onRefreshClicked()
             symbols = { "AAPL", "GOOGL", "NVDA" , "005930", "000660", "005380" };
     }
     
-    QRegularExpression re("^[0-9]{6}$");    // 숫자 6자리 (한국 종목 패턴)
-    for (const QString& sym : symbols)
-    {
-        if (re.match(sym).hasMatch())
-        {
-            m_krApi->fetchStock(sym);
-            m_krApi->fetchLogo(sym);
-        }
-        else
-        {
-            m_usApi->fetchStock(sym);
-            m_usApi->fetchLogo(sym);
-        }
-    }
+    m_provider->fetchStocks(symbols, true);
 }
 
 void MainWindow::onSearchClicked()
@@ -152,18 +388,8 @@ void MainWindow::onSearchClicked()
         }
     }
 
-    bool isKorean = QRegularExpression("^[0-9]{6}$").match(targetSymbol).hasMatch();
-
-    if (isKorean)
-    {
-        m_krApi->fetchStock(targetSymbol);
-        m_krApi->fetchLogo(targetSymbol);
-    }
-    else
-    {
-        m_usApi->fetchStock(targetSymbol);
-        m_usApi->fetchLogo(targetSymbol);
-    }
+    m_provider->fetchStock(targetSymbol);
+    m_provider->fetchLogo(targetSymbol);
 
     ui->editSearch->clear();
 }
@@ -180,8 +406,23 @@ void MainWindow::onTableContextMenu(const QPoint& pos)
     QModelIndex index = ui->tableView->indexAt(pos);
     if (!index.isValid()) return;
 
+    // 메뉴가 떠 있는 동안에도 시세가 들어오므로 복사해둠
+    const StockData* current = m_stockModel->stockAt(index.row());
+    if (!current) return;
+    const StockData stock = *current;
+    const int alertCount = m_alertEngine->rulesFor(stock.symbol).size();
+
     QMenu menu(this);
     QAction* deleteAction = menu.addAction("삭제 (delete)");
+    menu.addSeparator();
+    QAction* addAlertAction = menu.addAction("가격 알림 추가...");
+    QAction* clearAlertsAction = menu.addAction(QString("알림 모두 삭제 (%1개)").arg(alertCount));
+    clearAlertsAction->setEnabled(alertCount > 0);
+    menu.addSeparator();
+    QAction* tradeAction = menu.addAction("매매 기록...");
+    QAction* depthAction = menu.addAction("호가 보기");
+    static const QRegularExpression domestic("^[0-9]{6}$");    // 호가는 국내 종목만
+    depthAction->setEnabled(!m_replayMode && domestic.match(stock.symbol).hasMatch());
     // 메뉴 띄우고 기다림
     QAction* selectedItem = menu.exec(ui->tableView->viewport()->mapToGlobal(pos));
     if (selectedItem == nullptr) return; // 사용자가 메뉴 밖을 클릭해서 취소함
@@ -192,7 +433,297 @@ void MainWindow::onTableContextMenu(const QPoint& pos)
 
         // 모델에서 삭제
         m_stockModel->removeRow(row);
+        m_indicators->remove(stock.symbol);
+    }
+    else if (selectedItem == addAlertAction)
+    {
+        addAlertFor(stock);
+    }
+    else if (selectedItem == clearAlertsAction)
+    {
+        m_alertEngine->removeRules(stock.symbol);
+        if (!m_replayMode)
+            m_alertEngine->save(alertFilePath());
+    }
+    else if (selectedItem == tradeAction)
+    {
+        m_portfolioPanel->show();
+        m_portfolioPanel->recordTrade(stock.symbol, stock.currentPrice);
+    }
+    else if (selectedItem == depthAction)
+    {
+        openDepthLadder(stock.symbol, stock.name);
+    }
+}
+
+void MainWindow::openDepthLadder(const QString& symbol, const QString& name)
+{
+    // 이미 열려있으면 앞으로 가져오기만
+    QPointer<DepthLadderWidget> ladder = m_depthLadders.value(symbol);
+    if (!ladder)
+    {
+        ladder = new DepthLadderWidget(symbol, name, this);
+        ladder->setWindowFlag(Qt::Window);
+        ladder->setAttribute(Qt::WA_DeleteOnClose);
+        ladder->resize(320, 520);
+        m_depthLadders.insert(symbol, ladder);
+
+        // 창을 닫으면 구독도 해제 (열린 호가창이 없으면 조회/실시간 모두 멈춤)
+        connect(ladder, &QObject::destroyed, this, [this, symbol]()
+        {
+            m_depthLadders.remove(symbol);
+            m_provider->unsubscribeOrderBook(symbol);
+        });
+        m_provider->subscribeOrderBook(symbol);
+    }
+
+    ladder->show();
+    ladder->raise();
+    ladder->activateWindow();
+}
+
+void MainWindow::addAlertFor(const StockData& stock)
+{
+    bool ok = false;
+    double level = QInputDialog::getDouble(this, "가격 알림",
+        QString("%1 알림 가격 (현재 %2)").arg(stock.name, QString::number(stock.currentPrice)),
+        stock.currentPrice, 0, 1e12, 2, &ok);
+    if (!ok || level <= 0) return;
+
+    // 현재가보다 높으면 상승 돌파, 낮으면 하락 이탈 알림
+    // 재무장 폭 0.2%, 같은 알림은 1분에 한 번까지
+    AlertRule rule;
+    rule.symbol = stock.symbol;
+    rule.kind = level >= stock.currentPrice ? AlertKind::PriceAbove : AlertKind::PriceBelow;
+    rule.level = level;
+    rule.hysteresis = level * 0.002;
+    rule.cooldownMs = 60 * 1000;
+    m_alertEngine->addRule(rule);
+
+    if (!m_replayMode)
+        m_alertEngine->save(alertFilePath());
+}
+
+void MainWindow::onAlertTriggered(const AlertEvent& event)
+{
+    const AlertRule& rule = event.rule;
+    const bool percent = rule.kind == AlertKind::PercentAbove || rule.kind == AlertKind::PercentBelow;
+    const bool upward = rule.kind == AlertKind::PriceAbove || rule.kind == AlertKind::CrossAbove
+        || rule.kind == AlertKind::PercentAbove;
+
+    QString name = StockCodeMap::getName(rule.symbol);
+    QString title = QString("%1 %2").arg(name, upward ? "상승 알림" : "하락 알림");
+    QString message = percent
+        ? QString("등락률 %1% (기준 %2%)").arg(event.value, 0, 'f', 2).arg(rule.level, 0, 'f', 2)
+        : QString("현재가 %1 (기준 %2)").arg(QString::number(event.value), QString::number(rule.level));
+    if (!rule.note.isEmpty())
+        message += "\n" + rule.note;
+
+    qDebug() << "[Alert]" << title << message;
+
+    if (m_trayIcon)
+        m_trayIcon->showMessage(title, message, QSystemTrayIcon::Information, 5000);
+    else
+        QApplication::alert(this);  // 트레이가 없으면 작업 표시줄 깜빡임
+}
+
+QString MainWindow::alertFilePath() const
+{
+    QString dir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir().mkpath(dir);
+    return dir + "/alerts.json";
+}
+
+QString MainWindow::portfolioFilePath() const
+{
+    QString dir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir().mkpath(dir);
+    return dir + "/portfolio.json";
+}
+
+QString MainWindow::snapshotFilePath() const
+{
+    QString dir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation);
+    QDir().mkpath(dir);
+    return dir + "/quotes.snapshot";
+}
+
+QString MainWindow::logoCacheDir() const
+{
+    QString dir = QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/logos";
+    QDir().mkpath(dir);
+    return dir;
+}
+
+void MainWindow::restoreSnapshot()
+{
+    QVector<QuoteSnapshot::Entry> entries;
+    qint64 savedAt = 0;
+    if (!QuoteSnapshot::load(snapshotFilePath(), entries, &savedAt)) return;
+
+    QVector<StockData> quotes;
+    quotes.reserve(entries.size());
+    for (const QuoteSnapshot::Entry& entry : entries)
+        quotes.append(entry.quote);
+    m_stockModel->restoreStale(quotes);
+    m_restoredCount = quotes.size();
+
+    // 로고도 네트워크 대신 로컬 캐시에서
+    const QString dir = logoCacheDir();
+    for (const QuoteSnapshot::Entry& entry : entries)
+    {
+        if (entry.logoFile.isEmpty()) continue;
+        QPixmap logo(dir + "/" + entry.logoFile);
+        if (!logo.isNull())
+            m_stockModel->updateLogo(entry.quote.symbol, logo);
+    }
+
+    qDebug() << "[Snapshot]" << m_restoredCount << "종목 복원, 저장 시각"
+             << QDateTime::fromMSecsSinceEpoch(savedAt).toString("yyyy-MM-dd HH:mm:ss");
+}
+
+void MainWindow::saveSnapshot()
+{
+    const QString dir = logoCacheDir();
+
+    QVector<QuoteSnapshot::Entry> entries;
+    entries.reserve(m_stockModel->rowCount());
+    for (int row = 0; row < m_stockModel->rowCount(); ++row)
+    {
+        const StockData* stock = m_stockModel->stockAt(row);
+        if (!stock) continue;
+
+        QuoteSnapshot::Entry entry;
+        entry.quote = *stock;
+        const QString logoFile = stock->symbol + ".png";
+        if (QFile::exists(dir + "/" + logoFile))
+            entry.logoFile = logoFile;
+        entries.append(entry);
+    }
+
+    QuoteSnapshot::save(snapshotFilePath(), entries, QDateTime::currentMSecsSinceEpoch());
+}
+
+void MainWindow::cacheLogo(const QString& symbol, const QImage& logo)
+{
+    // 자동 갱신 때마다 로고가 다시 오므로 캐시에 없을 때만 씀 (표시 크기로 줄여서)
+    const QString path = logoCacheDir() + "/" + symbol + ".png";
+    if (QFile::exists(path)) return;
+    logo.scaled(24, 24, Qt::KeepAspectRatio, Qt::SmoothTransformation).save(path, "PNG");
+}
+
+void MainWindow::savePortfolio()
+{
+    // 재생 모드는 실제 보유 기록을 덮어쓰지 않음
+    if (!m_replayMode)
+        m_portfolio->save(portfolioFilePath());
+}
+
+void MainWindow::onMasterReloaded(const MstTable& master, const MstDelta& delta)
+{
+    // 검색 사전은 바뀐 코드만 고침 (전체 다시 만들지 않음)
+    for (const QString& code : delta.removed)
+        StockCodeMap::removeStock(code);
+    for (const MstDelta::Entry& entry : delta.added)
+        StockCodeMap::addStock(entry.code, entry.name);
+    for (const MstDelta::Entry& entry : delta.renamed)
+        StockCodeMap::addStock(entry.code, entry.name);
+
+    m_screener->applyDelta(master, delta);
+    m_master = master;
+
+    qDebug() << "[Master] 신규" << delta.added.size() << "폐지" << delta.removed.size()
+             << "이름 변경" << delta.renamed.size();
+}
+
+void MainWindow::onTableDoubleClicked(const QModelIndex& index)
+{
+    const StockData* stock = m_stockModel->stockAt(index.row());
+    if (!stock) return;
+
+    // 이미 열려있으면 앞으로 가져오기만
+    QPointer<PriceChartWidget> chart = m_charts.value(stock->symbol);
+    if (!chart)
+    {
+        chart = new PriceChartWidget(stock->symbol, stock->name, this);
+        chart->setWindowFlag(Qt::Window);
+        chart->setAttribute(Qt::WA_DeleteOnClose);
+        chart->resize(720, 400);
+        chart->setOverlays(loadIndicatorSpecs(KEY_INDICATOR_OVERLAYS, { "SMA(20)", "BBU(20,2)", "BBL(20,2)" }));
+
+        // 지금까지 쌓인 틱으로 먼저 채움
+        if (const TickHistory* history = m_stockModel->tickHistory(index.row()))
+            chart->loadHistory(*history);
+
+        m_charts.insert(stock->symbol, chart);
+
+        // 최근 1년 일봉 (캐시에 있는 구간은 네트워크 요청 안 함)
+        QDateTime now = QDateTime::currentDateTime();
+        m_provider->fetchCandles(stock->symbol, CandleResolution::Day, now.addYears(-1), now);
     }
+
+    chart->show();
+    chart->raise();
+    chart->activateWindow();
+}
+
+void MainWindow::onCandlesReceived(const QString& symbol, CandleResolution resolution, const QVector<Candle>& candles)
+{
+    if (resolution == m_indicators->resolution())
+        m_indicators->backfill(symbol, candles);
+
+    auto it = m_charts.constFind(symbol);
+    if (it != m_charts.cend() && it.value())
+        it.value()->loadCandles(candles, resolution);
+}
+
+void MainWindow::onHeaderContextMenu(const QPoint& pos)
+{
+    QHeaderView* header = ui->tableView->horizontalHeader();
+    const int column = header->logicalIndexAt(pos);
+    const int specIndex = m_stockModel->indicatorIndex(column);
+    QVector<IndicatorSpec> specs = m_indicators->specs();
+
+    QMenu menu(this);
+    QAction* addAction = menu.addAction("지표 열 추가...");
+    QAction* editAction = nullptr;
+    QAction* removeAction = nullptr;
+    if (specIndex >= 0)
+    {
+        editAction = menu.addAction(QString("%1 변경...").arg(specs[specIndex].toString()));
+        removeAction = menu.addAction(QString("%1 열 삭제").arg(specs[specIndex].toString()));
+    }
+
+    QAction* selected = menu.exec(header->mapToGlobal(pos));
+    if (selected == nullptr) return;
+
+    if (selected == removeAction)
+    {
+        specs.removeAt(specIndex);
+    }
+    else
+    {
+        const QString current = (selected == editAction) ? specs[specIndex].toString() : "EMA(20)";
+        bool ok = false;
+        QString text = QInputDialog::getText(this, "지표 열",
+            "SMA(n), EMA(n), VWAP(n, 0=누적), RSI(n), BBU(n,k), BBL(n,k)", QLineEdit::Normal, current, &ok);
+        if (!ok) return;
+
+        IndicatorSpec spec;
+        if (!IndicatorSpec::fromString(text, spec))
+        {
+            QMessageBox::warning(this, "지표 열", "형식이 올바르지 않습니다: " + text);
+            return;
+        }
+
+        if (selected == editAction)
+            specs[specIndex] = spec;
+        else
+            specs.append(spec);
+    }
+
+    m_indicators->setSpecs(specs);
+    saveIndicatorSpecs(KEY_INDICATOR_COLUMNS, specs);
 }
 
 void MainWindow::updateSearchCompleter()
@@ -249,5 +780,14 @@ bool MainWindow::eventFilter(QObject* obj, QEvent* event)
         return false;
     }
 
+    // 시작 ~ 종목이 보이는 첫 화면 (스냅샷이 있으면 인증/네트워크 전에 그려짐)
+    if (!m_firstFrameLogged && obj == ui->tableView->viewport() && event->type() == QEvent::Paint
+        && m_stockModel->rowCount() > 0)
+    {
+        m_firstFrameLogged = true;
+        qDebug() << "[Startup] 첫 화면:" << m_launchTimer.elapsed() << "ms"
+                 << (m_restoredCount > 0 ? QString("(스냅샷 %1종목)").arg(m_restoredCount) : QString("(실시간)"));
+    }
+
     return QMainWindow::eventFilter(obj, event);
 }
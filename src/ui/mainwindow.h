@@ -2,12 +2,30 @@
 
 #include <QMainWindow>
 #include <QTimer>
+#include <QElapsedTimer>
 #include "StockTableModel.h"
-#include "core/KisAPI.h"
-#include "core/FinnhubAPI.h"
+#include "core/ProviderService.h"
 #include <QStringListModel>
 #include <QEvent>
 #include <QInputMethodEvent>
+#include <QHash>
+#include <QPointer>
+#include <memory>
+#include "core/TickJournal.h"
+#include "core/AlertEngine.h"
+#include "core/IndicatorStore.h"
+#include "core/Portfolio.h"
+#include "core/Screener.h"
+#include "core/MstWatcher.h"
+#include "core/QuoteMailbox.h"
+#include "quoteboard/QuoteBoardWriter.h"
+
+class PriceChartWidget;
+class DepthLadderWidget;
+class MetricsPanel;
+class PortfolioPanel;
+class ScreenerPanel;
+class QSystemTrayIcon;
 
 QT_BEGIN_NAMESPACE
 namespace Ui { class MainWindow; }
@@ -18,29 +36,70 @@ class MainWindow : public QMainWindow
     Q_OBJECT
 
 public:
-    explicit MainWindow(QWidget* parent = nullptr);
+    // replay가 주어지면 실서버 대신 기록된 시세로 동작 (인증/자동 갱신 생략)
+    explicit MainWindow(QWidget* parent = nullptr, StockAPI* replay = nullptr);
     ~MainWindow();
 
+    // 프로세스 시작 시각 기준으로 첫 화면까지 시간을 잼 (안 부르면 창을 만든 시각 기준)
+    void setLaunchTimer(const QElapsedTimer& timer) { m_launchTimer = timer; }
+
 private slots:
     void onRefreshClicked();
     void updateUI(const StockData& data);
+    void onQuotesReceived(const QVector<StockData>& quotes);
     void onSearchClicked();
     void onSearchTextEdited(const QString &text);
     void onTableContextMenu(const QPoint& pos);
+    void onTableDoubleClicked(const QModelIndex& index);
+    void onCandlesReceived(const QString& symbol, CandleResolution resolution, const QVector<Candle>& candles);
+    void onAlertTriggered(const AlertEvent& event);
+    void onHeaderContextMenu(const QPoint& pos);
+    void onMasterReloaded(const MstTable& master, const MstDelta& delta);
 
 private:
     Ui::MainWindow* ui;
-    FinnhubAPI *m_usApi;
-    KisAPI *m_krApi;
+    ProviderService* m_provider;                        // Finnhub/KIS/재생 API (I/O 스레드)
+    bool m_replayMode;                                  // 기록된 시세로 실행 중 (인증/저장/자동 갱신 생략)
     StockTableModel* m_stockModel;
     QStringList m_symbols;
     QTimer* m_timer;                    // 갱신타이머
     QStringListModel* m_searchModel;
     QTimer* m_debounceTimer;            // 검색지연타이머
     QString m_pendingText;
+    QHash<QString, QPointer<PriceChartWidget>> m_charts;   // 열려있는 차트 (심볼별)
+    QHash<QString, QPointer<DepthLadderWidget>> m_depthLadders; // 열려있는 호가창 (심볼별, 닫으면 구독 해제)
+    std::unique_ptr<TickJournal> m_journal;             // 수신 시세 기록 (설정에서 켠 경우만)
+    MetricsPanel* m_metricsPanel;                       // 지연 시간 패널 (F12)
+    AlertEngine* m_alertEngine;                         // 가격 알림
+    IndicatorStore* m_indicators;                       // 종목별 지표 (테이블 지표 열)
+    QSystemTrayIcon* m_trayIcon;                        // 알림 표시 (트레이가 없는 환경이면 nullptr)
+    Portfolio* m_portfolio;                             // 보유 종목
+    PortfolioPanel* m_portfolioPanel;                   // 포트폴리오 패널 (F11)
+    QTimer* m_fxTimer;                                  // 환율 갱신타이머
+    MstTable m_master;                                  // KOSPI/KOSDAQ 종목 마스터 전체 필드
+    MstWatcher* m_mstWatcher;                           // MST 파일 변경 감시 (변경분만 반영)
+    Screener* m_screener;                               // 국내 전 종목 스크리너
+    ScreenerPanel* m_screenerPanel;                     // 스크리너 패널 (F10)
+    QuoteMailbox* m_mailbox;                            // 종목별 최신 시세만 남겨 프레임 주기로 화면에 전달
+    std::unique_ptr<QuoteBoardWriter> m_quoteBoard;     // 다른 프로세스용 공유 메모리 시세판 (설정에서 끈 경우 nullptr)
+    QTimer* m_snapshotTimer;                            // 마지막 시세 스냅샷 주기 저장
+    QElapsedTimer m_launchTimer;                        // 시작 ~ 첫 화면/첫 실시간 시세
+    int m_restoredCount = 0;                            // 스냅샷에서 복원한 종목 수
+    bool m_firstFrameLogged = false;
+    bool m_firstLiveLogged = false;
 
     void updateSearchCompleter();
     void performSearch();
+    void addAlertFor(const StockData& stock);
+    void openDepthLadder(const QString& symbol, const QString& name);
+    QString alertFilePath() const;
+    QString portfolioFilePath() const;
+    QString snapshotFilePath() const;
+    QString logoCacheDir() const;
+    void restoreSnapshot();
+    void saveSnapshot();
+    void cacheLogo(const QString& symbol, const QImage& logo);
+    void savePortfolio();
 
 protected:
     bool eventFilter(QObject* obj, QEvent* event) override;